@@ -19,7 +19,8 @@ namespace celeritas
 /*!
  * Energy deposition event in the detector.
  *
- * Note that most of the data is discarded at integration time.
+ * The deposited energy is scored with the statistical weight of the track that
+ * produced it. Note that most of the data is discarded at integration time.
  */
 struct Hit
 {
@@ -28,6 +29,7 @@ struct Hit
     ThreadId         thread;
     real_type        time;
     units::MevEnergy energy_deposited;
+    real_type        weight = 1;
 };
 
 //---------------------------------------------------------------------------//
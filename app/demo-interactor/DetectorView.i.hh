@@ -29,6 +29,7 @@ CELER_FUNCTION void DetectorView::operator()(const Hit& hit)
     CELER_EXPECT(hit.thread);
     CELER_EXPECT(hit.time > 0);
     CELER_EXPECT(hit.energy_deposited > zero_quantity());
+    CELER_EXPECT(hit.weight > 0);
 
     // Allocate and assign the given hit
     Hit* allocated = this->allocate_(1);
@@ -65,7 +65,7 @@ void HostDetectorStore::bin_buffer()
         }
         CELER_ASSERT(bin < tally_deposition_.size());
 
-        tally_deposition_[bin] += hit.energy_deposited.value();
+        tally_deposition_[bin] += hit.weight * hit.energy_deposited.value();
     }
 
     // Clear the hit buffer
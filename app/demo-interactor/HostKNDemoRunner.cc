@@ -152,9 +152,12 @@ auto HostKNDemoRunner::operator()(demo_interactor::KNDemoRunArgs args)
                 continue;
             }
 
-            // Construct the KN interactor
-            KleinNishinaInteractor interact(
-                kn_pointers_, particle, direction, allocate_secondaries);
+            // Construct the KN interactor without a production cut
+            KleinNishinaInteractor interact(kn_pointers_,
+                                            particle,
+                                            direction,
+                                            allocate_secondaries,
+                                            zero_quantity());
 
             // Perform interactions - emits a single particle
             auto interaction = interact(rng);
@@ -129,9 +129,13 @@ __global__ void interact_kernel(ParamsDeviceRef const            params,
         return;
     }
 
-    // Construct RNG and interaction interfaces
-    KleinNishinaInteractor interact(
-        params.kn_interactor, particle, h.dir, allocate_secondaries);
+    // Construct RNG and interaction interfaces (no production cut: the
+    // secondary is always emitted and then deposited below)
+    KleinNishinaInteractor interact(params.kn_interactor,
+                                    particle,
+                                    h.dir,
+                                    allocate_secondaries,
+                                    zero_quantity());
 
     // Perform interaction: should emit a single particle (an electron)
     Interaction interaction = interact(rng);
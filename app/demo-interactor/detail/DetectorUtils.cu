@@ -39,9 +39,9 @@ __global__ void bin_buffer_kernel(DetectorPointers const detector)
         else
             bin = grid.find(z_pos);
 
-        // Add energy deposition (NOTE: very slow on arch 600)
+        // Add weighted energy deposition (NOTE: very slow on arch 600)
         atomic_add(&detector.tally_deposition[bin],
-                   hit.energy_deposited.value());
+                   hit.weight * hit.energy_deposited.value());
     }
 }
 
@@ -0,0 +1,219 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AdaptiveTrace.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+#include "base/Assert.hh"
+#include "ImageTrackView.hh"
+#include "RDemoTrace.hh"
+
+namespace demo_rasterizer
+{
+//---------------------------------------------------------------------------//
+//! Segments crossed along a single image line
+using VecSegment = std::vector<LineSegment>;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Evenly spaced lines of an image that always include the last line.
+ */
+struct CoarseLines
+{
+    unsigned int spacing;
+    unsigned int last_line;
+
+    //! Number of bands between coarse lines
+    unsigned int num_bands() const
+    {
+        return (last_line + spacing - 1) / spacing;
+    }
+
+    //! Line index of the given coarse line
+    unsigned int operator()(unsigned int i) const
+    {
+        return std::min(i * spacing, last_line);
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Save the segments generated by another segment source.
+ */
+template<class F>
+class RecordingSegments
+{
+  public:
+    //! Construct with the source and the segments to append to
+    RecordingSegments(F& next_segment, VecSegment* segments)
+        : next_segment_(next_segment), segments_(segments)
+    {
+        CELER_EXPECT(segments_ && segments_->empty());
+    }
+
+    //! Get and save the next segment
+    LineSegment operator()()
+    {
+        segments_->push_back(next_segment_());
+        return segments_->back();
+    }
+
+  private:
+    F&          next_segment_;
+    VecSegment* segments_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Generate segments by interpolating between two lines.
+ *
+ * The two lines must cross the same sequence of volumes. The length of each
+ * segment is interpolated linearly, so the boundary crossings of planar
+ * surfaces are reproduced exactly (up to roundoff).
+ */
+class InterpolatedSegments
+{
+  public:
+    using real_type = celeritas::real_type;
+
+    //! Construct with neighboring lines and the fractional distance between
+    InterpolatedSegments(const VecSegment& lower,
+                         const VecSegment& upper,
+                         real_type         frac)
+        : lower_(lower), upper_(upper), frac_(frac)
+    {
+        CELER_EXPECT(!lower_.empty() && lower_.size() == upper_.size());
+        CELER_EXPECT(frac_ > 0 && frac_ < 1);
+    }
+
+    //! Get the next interpolated segment
+    LineSegment operator()()
+    {
+        LineSegment result;
+        if (i_ == lower_.size())
+        {
+            // Roundoff moved the last boundary into the image: extend the
+            // final segment across the remainder of the line
+            result.volume   = lower_.back().volume;
+            result.distance = std::numeric_limits<real_type>::infinity();
+            return result;
+        }
+
+        CELER_ASSERT(lower_[i_].volume == upper_[i_].volume);
+        result.volume   = lower_[i_].volume;
+        result.distance = (1 - frac_) * lower_[i_].distance
+                          + frac_ * upper_[i_].distance;
+        ++i_;
+        return result;
+    }
+
+  private:
+    const VecSegment& lower_;
+    const VecSegment& upper_;
+    real_type         frac_;
+    std::size_t       i_ = 0;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether two lines cross the same sequence of volumes.
+ */
+inline bool same_volumes(const VecSegment& a, const VecSegment& b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (std::size_t i = 0; i != a.size(); ++i)
+    {
+        if (a[i].volume != b[i].volume)
+            return false;
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Trace a line through the geometry and save the segments it crosses.
+ *
+ * The pixels are identical to those from \c trace_line.
+ */
+template<class GTV>
+inline void trace_recorded_line(GTV&                 geo,
+                                const ImagePointers& image,
+                                unsigned int         line,
+                                VecSegment*          segments)
+{
+    ImageTrackView        image_line(image, celeritas::ThreadId{line});
+    GeoSegmentWalker<GTV> walk(
+        geo, image_line.start_pos(), image_line.start_dir());
+    RecordingSegments<GeoSegmentWalker<GTV>> next_segment(walk, segments);
+    rasterize_line(next_segment, image_line);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Fill the lines between two traced lines by interpolation.
+ */
+inline void interpolate_lines(const ImagePointers& image,
+                              unsigned int         lower,
+                              unsigned int         upper,
+                              const VecSegment&    lower_segments,
+                              const VecSegment&    upper_segments)
+{
+    using celeritas::real_type;
+    CELER_EXPECT(lower < upper);
+
+    const real_type inv_width = real_type(1) / (upper - lower);
+    for (unsigned int line = lower + 1; line < upper; ++line)
+    {
+        ImageTrackView       image_line(image, celeritas::ThreadId{line});
+        InterpolatedSegments next_segment(
+            lower_segments, upper_segments, (line - lower) * inv_width);
+        rasterize_line(next_segment, image_line);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Fill the lines between two traced lines, subdividing where they differ.
+ *
+ * If the bounding lines cross the same sequence of volumes, the lines between
+ * are interpolated. Otherwise the middle line is traced and each half is
+ * refined recursively. Adjacent traced lines leave nothing to fill, so
+ * regions that are subdivided down to single lines are traced exactly. The
+ * segments of newly traced lines are saved, and the number of them is
+ * returned.
+ */
+template<class GTV>
+inline unsigned int refine_lines(GTV&                     geo,
+                                 const ImagePointers&     image,
+                                 unsigned int             lower,
+                                 unsigned int             upper,
+                                 std::vector<VecSegment>* segments)
+{
+    CELER_EXPECT(segments && upper < segments->size());
+    CELER_EXPECT(lower < upper);
+
+    if (upper - lower == 1)
+        return 0;
+
+    std::vector<VecSegment>& seg = *segments;
+    if (same_volumes(seg[lower], seg[upper]))
+    {
+        interpolate_lines(image, lower, upper, seg[lower], seg[upper]);
+        return 0;
+    }
+
+    const unsigned int mid = lower + (upper - lower) / 2;
+    trace_recorded_line(geo, image, mid, &seg[mid]);
+    return 1 + refine_lines(geo, image, lower, mid, segments)
+           + refine_lines(geo, image, mid, upper, segments);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace demo_rasterizer
@@ -0,0 +1,329 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file HostRDemoRunner.cc
+//---------------------------------------------------------------------------//
+#include "HostRDemoRunner.hh"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+#include "celeritas_config.h"
+#include "base/ColorUtils.hh"
+#include "base/ParallelFor.hh"
+#include "base/Range.hh"
+#include "base/Stopwatch.hh"
+#include "comm/Logger.hh"
+#include "geometry/GeoStateStore.hh"
+#include "geometry/GeoTrackView.hh"
+#include "AdaptiveTrace.hh"
+#include "ImageTrackView.hh"
+#include "RDemoTrace.hh"
+
+#if CELERITAS_USE_OPENMP
+#    include <omp.h>
+#endif
+
+using namespace celeritas;
+
+namespace demo_rasterizer
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Index of the calling host thread
+ThreadId host_thread_id()
+{
+#if CELERITAS_USE_OPENMP
+    return ThreadId(omp_get_thread_num());
+#else
+    return ThreadId{0};
+#endif
+}
+
+//---------------------------------------------------------------------------//
+//! Stream a range of completed lines to the image file
+void write_lines(const ImagePointers& image,
+                 unsigned int         begin,
+                 unsigned int         end,
+                 ImageWriter*         writer)
+{
+    CELER_EXPECT(begin >= image.first_line);
+    const unsigned int num_pixels = image.dims[1];
+    (*writer)(begin,
+              image.image.subspan((begin - image.first_line) * num_pixels,
+                                  (end - begin) * num_pixels));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Work items from several images in a single queue.
+ *
+ * Items are numbered consecutively across images so that a single parallel
+ * loop distributes the work of every image among the threads.
+ */
+class ImageWorkQueue
+{
+  public:
+    //! Image index and item index within the image
+    struct Item
+    {
+        size_type    image;
+        unsigned int index;
+    };
+
+    //! Append the items of the next image
+    void push_back(unsigned int count)
+    {
+        offsets_.push_back(offsets_.back() + count);
+    }
+
+    //! Total number of items
+    size_type size() const { return offsets_.back(); }
+
+    //! Find the image of a work item
+    Item operator[](size_type i) const
+    {
+        CELER_EXPECT(i < this->size());
+        auto iter = std::upper_bound(offsets_.begin(), offsets_.end(), i);
+        size_type image = iter - offsets_.begin() - 1;
+        return {image, static_cast<unsigned int>(i - offsets_[image])};
+    }
+
+  private:
+    std::vector<size_type> offsets_ = {0};
+};
+
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with geometry and tracing options.
+ */
+HostRDemoRunner::HostRDemoRunner(SPConstGeo geometry, const Options& options)
+    : geo_params_(std::move(geometry)), options_(options)
+{
+    CELER_EXPECT(geo_params_);
+    CELER_EXPECT(options_.tile_lines > 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Trace an image, optionally streaming completed lines to a file.
+ */
+void HostRDemoRunner::operator()(ImageStore* image, ImageWriter* writer) const
+{
+    (*this)(VecImage{image}, VecWriter{writer});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Trace several images through a single work queue.
+ *
+ * The writers, if given, correspond to the images; null writers are ignored.
+ */
+void HostRDemoRunner::operator()(const VecImage&  images,
+                                 const VecWriter& writers) const
+{
+    CELER_EXPECT(!images.empty());
+    CELER_EXPECT(writers.empty() || writers.size() == images.size());
+    CELER_EXPECT(std::all_of(images.begin(), images.end(), [](ImageStore* i) {
+        return i && i->memspace() == MemSpace::host;
+    }));
+
+    VecWriter all_writers = writers;
+    all_writers.resize(images.size(), nullptr);
+
+    Stopwatch get_time;
+    if (options_.coarse_lines > 0)
+    {
+        this->trace_adaptive(images, all_writers);
+    }
+    else
+    {
+        this->trace_full(images, all_writers);
+    }
+    CELER_LOG(diagnostic) << color_code('x') << "... " << get_time() << " s"
+                          << color_code(' ');
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number of host threads that will trace the image.
+ *
+ * With OpenMP this is controlled by the \c OMP_NUM_THREADS environment
+ * variable.
+ */
+size_type HostRDemoRunner::num_threads()
+{
+#if CELERITAS_USE_OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Trace every line of each image.
+ *
+ * Images that aren't stored are traced one tile at a time into a buffer for
+ * each thread, which is written out as soon as the tile is complete.
+ */
+void HostRDemoRunner::trace_full(const VecImage&  images,
+                                 const VecWriter& writers) const
+{
+    // One navigation state per host thread
+    GeoStateStore geo_state(*geo_params_, HostRDemoRunner::num_threads());
+
+    const GeoParamsPointers geo_ref   = geo_params_->host_pointers();
+    const GeoStatePointers  state_ref = geo_state.host_pointers();
+
+    // Queue the tiles of every image
+    const unsigned int         tile_lines = options_.tile_lines;
+    std::vector<ImagePointers> image_refs;
+    ImageWorkQueue             tiles;
+    size_type                  max_tile_size = 0;
+    for (auto i : range(images.size()))
+    {
+        const ImageStore& image = *images[i];
+        CELER_EXPECT(image.is_stored() || writers[i]);
+        image_refs.push_back(images[i]->host_interface());
+        tiles.push_back((image.dims()[0] + tile_lines - 1) / tile_lines);
+        if (!image.is_stored())
+        {
+            max_tile_size
+                = std::max<size_type>(max_tile_size,
+                                      tile_lines * image.dims()[1]);
+        }
+    }
+
+    // Tile buffers for images that are only streamed
+    std::vector<std::vector<int>> tile_buffers(
+        max_tile_size > 0 ? geo_state.size() : 0,
+        std::vector<int>(max_tile_size));
+
+    CELER_LOG(status) << "Tracing geometry for " << images.size()
+                      << " image(s) with " << geo_state.size()
+                      << " host threads";
+    parallel_for(tiles.size(), [&](size_type i) {
+        GeoTrackView geo(geo_ref, state_ref, host_thread_id());
+
+        const ImageWorkQueue::Item tile      = tiles[i];
+        ImagePointers              image_ref = image_refs[tile.image];
+        const unsigned int         begin     = tile.index * tile_lines;
+        const unsigned int         end
+            = std::min(begin + tile_lines, image_ref.dims[0]);
+        if (!image_ref)
+        {
+            // Store only the lines of this tile
+            std::vector<int>& buffer = tile_buffers[host_thread_id().get()];
+            image_ref.image = make_span(buffer).subspan(
+                0, (end - begin) * image_ref.dims[1]);
+            image_ref.first_line = begin;
+        }
+        for (unsigned int line = begin; line != end; ++line)
+        {
+            ImageTrackView image_line(image_ref, ThreadId{line});
+            trace_line(geo, image_line);
+        }
+        if (ImageWriter* writer = writers[tile.image])
+        {
+            write_lines(image_ref, begin, end, writer);
+        }
+    });
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Trace coarse lines of each image and refine between them.
+ *
+ * The bands between coarse lines are independent, so they're distributed
+ * among the host threads just like the tiles of a full trace. The images
+ * must be stored, since each coarse line is traced before the bands on
+ * either side of it.
+ */
+void HostRDemoRunner::trace_adaptive(const VecImage&  images,
+                                     const VecWriter& writers) const
+{
+    // One navigation state per host thread
+    GeoStateStore geo_state(*geo_params_, HostRDemoRunner::num_threads());
+
+    const GeoParamsPointers geo_ref   = geo_params_->host_pointers();
+    const GeoStatePointers  state_ref = geo_state.host_pointers();
+
+    // Queue the coarse lines and the bands between them for every image
+    std::vector<ImagePointers>           image_refs;
+    std::vector<CoarseLines>             coarse_lines;
+    std::vector<std::vector<VecSegment>> segments;
+    ImageWorkQueue                       lines;
+    ImageWorkQueue                       bands;
+    size_type                            num_lines = 0;
+    for (ImageStore* image : images)
+    {
+        CELER_EXPECT(image->is_stored());
+        image_refs.push_back(image->host_interface());
+        coarse_lines.push_back({options_.coarse_lines, image->dims()[0] - 1});
+        segments.emplace_back(image->dims()[0]);
+        lines.push_back(coarse_lines.back().num_bands() + 1);
+        bands.push_back(coarse_lines.back().num_bands());
+        num_lines += image->dims()[0];
+    }
+
+    CELER_LOG(status) << "Adaptively tracing geometry for " << images.size()
+                      << " image(s) with " << geo_state.size()
+                      << " host threads";
+    parallel_for(lines.size(), [&](size_type i) {
+        GeoTrackView geo(geo_ref, state_ref, host_thread_id());
+
+        const ImageWorkQueue::Item item = lines[i];
+        const unsigned int         line = coarse_lines[item.image](item.index);
+        trace_recorded_line(geo,
+                            image_refs[item.image],
+                            line,
+                            &segments[item.image][line]);
+    });
+
+    for (auto i : range(images.size()))
+    {
+        if (writers[i] && coarse_lines[i].num_bands() == 0)
+        {
+            // Single-line image
+            write_lines(image_refs[i], 0, 1, writers[i]);
+        }
+    }
+
+    std::vector<unsigned int> num_refined(bands.size(), 0);
+    parallel_for(bands.size(), [&](size_type i) {
+        GeoTrackView geo(geo_ref, state_ref, host_thread_id());
+
+        const ImageWorkQueue::Item band      = bands[i];
+        const CoarseLines&         coarse    = coarse_lines[band.image];
+        const ImagePointers&       image_ref = image_refs[band.image];
+        num_refined[i] = refine_lines(geo,
+                                      image_ref,
+                                      coarse(band.index),
+                                      coarse(band.index + 1),
+                                      &segments[band.image]);
+        if (ImageWriter* writer = writers[band.image])
+        {
+            // The last band also owns the last line
+            const unsigned int end = (band.index + 1 == coarse.num_bands()
+                                          ? image_ref.dims[0]
+                                          : coarse(band.index + 1));
+            write_lines(image_ref, coarse(band.index), end, writer);
+        }
+    });
+
+    const size_type num_traced = std::accumulate(
+        num_refined.begin(), num_refined.end(), lines.size());
+    CELER_LOG(diagnostic) << "Traced " << num_traced << " of " << num_lines
+                          << " lines";
+}
+
+//---------------------------------------------------------------------------//
+} // namespace demo_rasterizer
@@ -0,0 +1,87 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file HostRDemoRunner.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "geometry/GeoParams.hh"
+#include "ImageStore.hh"
+#include "ImageWriter.hh"
+
+namespace demo_rasterizer
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Rasterize an image on the host CPU.
+ *
+ * This is an analog to \c RDemoRunner that traces the image with host
+ * threads. The image is split into tiles of whole lines, which are
+ * distributed dynamically among the threads, and each thread navigates with
+ * its own geometry state. Lines are traced with the same function as the
+ * device kernel, so the images should be identical; the
+ * app/demo-rasterizer-host-device test compares them in CUDA builds.
+ *
+ * In adaptive mode, only every \c coarse_lines -th line is traced at first.
+ * Each band between neighboring coarse lines is then filled by interpolating
+ * the boundary crossings if both lines cross the same sequence of volumes, or
+ * else subdivided by tracing its middle line. Bands that are subdivided down
+ * to single lines are identical to the full trace; features that lie
+ * entirely between two coarse lines with matching volumes are not resolved.
+ *
+ * If an image writer is given, each tile (or band, in adaptive mode) is
+ * streamed to it as soon as it is complete. A fully traced image then needn't
+ * be stored: each thread traces its tile into a small buffer instead.
+ *
+ * Multiple images (e.g. a set of slices for geometry validation) can be traced
+ * in a single pass: the tiles of every image share one work queue, so the
+ * threads stay busy even when the images are small.
+ */
+class HostRDemoRunner
+{
+  public:
+    //!@{
+    //! Type aliases
+    using SPConstGeo = std::shared_ptr<const celeritas::GeoParams>;
+    using VecImage   = std::vector<ImageStore*>;
+    using VecWriter  = std::vector<ImageWriter*>;
+    //!@}
+
+    //! Tracing options
+    struct Options
+    {
+        unsigned int tile_lines   = 8; //!< Lines per tile
+        unsigned int coarse_lines = 0; //!< Adaptive line spacing (0 for off)
+    };
+
+  public:
+    // Construct with geometry and tracing options
+    HostRDemoRunner(SPConstGeo geometry, const Options& options);
+
+    // Trace an image, optionally streaming completed lines to a file
+    void operator()(ImageStore* image, ImageWriter* writer = nullptr) const;
+
+    // Trace several images through a single work queue
+    void operator()(const VecImage& images, const VecWriter& writers) const;
+
+    // Number of host threads that will trace the image
+    static celeritas::size_type num_threads();
+
+  private:
+    SPConstGeo geo_params_;
+    Options    options_;
+
+    // Trace every line of each image
+    void trace_full(const VecImage& images, const VecWriter& writers) const;
+
+    // Trace coarse lines of each image and refine between them
+    void
+    trace_adaptive(const VecImage& images, const VecWriter& writers) const;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace demo_rasterizer
@@ -27,6 +27,9 @@ struct ImagePointers
     celeritas::Array<unsigned int, 2> dims;        //!< Image dimensions (j, i)
     celeritas::Span<int>              image;       //!< Stored image [j][i]
 
+    //! Index j of the first stored line, if only a tile is stored
+    unsigned int first_line = 0;
+
     //! Whether the interface is initialized
     explicit CELER_FUNCTION operator bool() const { return !image.empty(); }
 };
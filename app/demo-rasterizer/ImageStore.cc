@@ -18,12 +18,16 @@ namespace demo_rasterizer
 /*!
  * Construct with image slice and extents.
  */
-ImageStore::ImageStore(ImageRunArgs params)
+ImageStore::ImageStore(ImageRunArgs params,
+                       MemSpace     memspace,
+                       Storage      storage)
+    : memspace_(memspace)
 {
     CELER_EXPECT(celeritas::is_soft_unit_vector(
         params.rightward_ax, celeritas::SoftEqual<real_type>{}));
     CELER_EXPECT(params.lower_left != params.upper_right);
     CELER_EXPECT(params.vertical_pixels > 0);
+    CELER_EXPECT(storage == Storage::full || memspace == MemSpace::host);
 
     // Normalize rightward axis
     right_ax_ = params.rightward_ax;
@@ -63,17 +67,32 @@ ImageStore::ImageStore(ImageRunArgs params)
     }
 
     // Allocate storage
-    dims_  = {num_y, num_x};
-    image_ = celeritas::DeviceVector<int>(num_y * num_x);
-    CELER_ENSURE(!image_.empty());
+    dims_ = {num_y, num_x};
+    if (storage == Storage::streamed)
+    {
+        // Tiles are traced into temporary buffers
+    }
+    else if (memspace_ == MemSpace::device)
+    {
+        image_ = celeritas::DeviceVector<int>(num_y * num_x);
+    }
+    else
+    {
+        host_image_.resize(num_y * num_x);
+    }
+    CELER_ENSURE(this->is_stored() == (storage == Storage::full));
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Access image on host for initializing.
+ * Access image on host for writing.
+ *
+ * The image span is empty if the pixels aren't stored.
  */
 ImagePointers ImageStore::host_interface()
 {
+    CELER_EXPECT(memspace_ == MemSpace::host);
+
     ImagePointers result;
 
     result.origin      = origin_;
@@ -81,6 +100,7 @@ ImagePointers ImageStore::host_interface()
     result.right_ax    = right_ax_;
     result.pixel_width = pixel_width_;
     result.dims        = dims_;
+    result.image       = celeritas::make_span(host_image_);
 
     return result;
 }
@@ -91,6 +111,8 @@ ImagePointers ImageStore::host_interface()
  */
 ImagePointers ImageStore::device_interface()
 {
+    CELER_EXPECT(memspace_ == MemSpace::device);
+
     ImagePointers result;
 
     result.origin      = origin_;
@@ -109,6 +131,12 @@ ImagePointers ImageStore::device_interface()
  */
 auto ImageStore::data_to_host() const -> VecInt
 {
+    CELER_EXPECT(this->is_stored());
+    if (memspace_ == MemSpace::host)
+    {
+        return host_image_;
+    }
+
     VecInt result(dims_[0] * dims_[1]);
     image_.copy_to_host(celeritas::make_span(result));
     return result;
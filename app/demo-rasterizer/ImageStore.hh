@@ -20,6 +20,10 @@ namespace demo_rasterizer
 //---------------------------------------------------------------------------//
 /*!
  * Initialization and storage for a raster image.
+ *
+ * The image is stored either on the device, for the CUDA rasterizer, or on
+ * the host, for the multithreaded host rasterizer. A host image that is
+ * streamed to disk tile by tile needn't be stored at all.
  */
 class ImageStore
 {
@@ -30,18 +34,28 @@ class ImageStore
     using UInt2     = celeritas::Array<unsigned int, 2>;
     using Real3     = celeritas::Real3;
     using VecInt    = std::vector<int>;
+    using MemSpace  = celeritas::MemSpace;
     //!@}
 
+    //! Pixel storage
+    enum class Storage
+    {
+        full,    //!< Store every pixel of the image
+        streamed //!< Store nothing: the host runner writes tiles as it goes
+    };
+
   public:
-    // Construct with defaults
-    explicit ImageStore(ImageRunArgs);
+    // Construct with image slice and extents
+    explicit ImageStore(ImageRunArgs,
+                        MemSpace memspace = MemSpace::device,
+                        Storage  storage  = Storage::full);
 
     //// DEVICE ACCESSORS ////
 
-    //! Access image on host for initializing
+    // Access image on host for writing
     ImagePointers host_interface();
 
-    //! Access image on device for writing
+    // Access image on device for writing
     ImagePointers device_interface();
 
     //// HOST ACCESSORS ////
@@ -61,6 +75,12 @@ class ImageStore
     //! Dimensions {j, i} of the image
     const UInt2& dims() const { return dims_; }
 
+    //! Memory space where the image is stored
+    MemSpace memspace() const { return memspace_; }
+
+    //! Whether every pixel of the image is stored
+    bool is_stored() const { return !image_.empty() || !host_image_.empty(); }
+
     // Copy out the image to the host
     VecInt data_to_host() const;
 
@@ -70,7 +90,9 @@ class ImageStore
     Real3                        right_ax_;
     real_type                    pixel_width_;
     UInt2                        dims_;
+    MemSpace                     memspace_;
     celeritas::DeviceVector<int> image_;
+    VecInt                       host_image_;
 };
 
 //---------------------------------------------------------------------------//
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "base/OpaqueId.hh"
 #include "ImageInterface.hh"
 
 namespace demo_rasterizer
@@ -45,6 +46,9 @@ class ImageTrackView
         return shared_.pixel_width;
     }
 
+    //! Number of pixels along the line
+    CELER_FUNCTION unsigned int num_pixels() const { return shared_.dims[1]; }
+
     // Set pixel value
     inline CELER_FUNCTION void set_pixel(unsigned int i, int value);
 
@@ -38,11 +38,14 @@ CELER_FUNCTION auto ImageTrackView::start_pos() const -> Real3
 //---------------------------------------------------------------------------//
 /*!
  * Set the value for a pixel.
+ *
+ * The stored image may be a tile that starts partway down the full image.
  */
 CELER_FUNCTION void ImageTrackView::set_pixel(unsigned int i, int value)
 {
     CELER_EXPECT(i < shared_.dims[1]);
-    unsigned int idx = j_index_ * shared_.dims[1] + i;
+    CELER_EXPECT(j_index_ >= shared_.first_line);
+    unsigned int idx = (j_index_ - shared_.first_line) * shared_.dims[1] + i;
 
     CELER_ASSERT(idx < shared_.image.size());
     shared_.image[idx] = value;
@@ -0,0 +1,160 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ImageWriter.cc
+//---------------------------------------------------------------------------//
+#include "ImageWriter.hh"
+
+#include "base/Assert.hh"
+
+namespace demo_rasterizer
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! File format identifier and version
+const char          magic[] = "CELERIMG";
+const std::uint32_t version = 1;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Encode pixels as (count, value) pairs.
+ */
+void append_run_length(ImageWriter::SpanConstInt pixels,
+                       std::vector<std::uint32_t>* words)
+{
+    auto iter = pixels.begin();
+    while (iter != pixels.end())
+    {
+        const int     value = *iter;
+        std::uint32_t count = 0;
+        for (; iter != pixels.end() && *iter == value; ++iter)
+        {
+            ++count;
+        }
+        words->push_back(count);
+        words->push_back(static_cast<std::uint32_t>(value));
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Open the file and write the header.
+ */
+ImageWriter::ImageWriter(const std::string& filename,
+                         UInt2              dims,
+                         Encoding           encoding)
+    : filename_(filename)
+    , dims_(dims)
+    , encoding_(encoding)
+    , os_(filename, std::ios::binary)
+{
+    CELER_EXPECT(dims_[0] > 0 && dims_[1] > 0);
+    CELER_VALIDATE(os_, "Failed to open image file '" << filename_ << "'");
+
+    os_.write(magic, sizeof(magic) - 1);
+    this->write({version,
+                 static_cast<std::uint32_t>(encoding_),
+                 dims_[0],
+                 dims_[1]});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write a tile of whole lines.
+ *
+ * This may be called concurrently from multiple threads.
+ */
+void ImageWriter::operator()(unsigned int first_line, SpanConstInt pixels)
+{
+    CELER_EXPECT(pixels.size() % dims_[1] == 0);
+    const unsigned int num_lines = pixels.size() / dims_[1];
+    CELER_EXPECT(num_lines > 0 && first_line + num_lines <= dims_[0]);
+
+    // Encode the tile outside of the lock
+    VecWord words = {first_line, num_lines, 0};
+    if (encoding_ == Encoding::run_length)
+    {
+        append_run_length(pixels, &words);
+    }
+    else
+    {
+        for (int value : pixels)
+        {
+            words.push_back(static_cast<std::uint32_t>(value));
+        }
+    }
+    words[2] = words.size() - 3;
+
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    this->write(words);
+    num_lines_written_ += num_lines;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number of lines written so far.
+ */
+unsigned int ImageWriter::num_lines_written() const
+{
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    return num_lines_written_;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write words to the file as little-endian bytes.
+ */
+void ImageWriter::write(const VecWord& words)
+{
+    std::vector<char> bytes;
+    bytes.reserve(words.size() * 4);
+    for (std::uint32_t word : words)
+    {
+        for (int shift = 0; shift < 32; shift += 8)
+        {
+            bytes.push_back(static_cast<char>((word >> shift) & 0xffu));
+        }
+    }
+    os_.write(bytes.data(), bytes.size());
+    CELER_VALIDATE(os_, "Failed to write to image file '" << filename_ << "'");
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the encoding from a string.
+ */
+ImageWriter::Encoding to_encoding(const std::string& name)
+{
+    if (name == "raw")
+        return ImageWriter::Encoding::raw;
+    CELER_VALIDATE(name == "rle",
+                   "Invalid image encoding '" << name
+                                              << "' (expected 'raw' or "
+                                                 "'rle')");
+    return ImageWriter::Encoding::run_length;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the string name of an encoding.
+ */
+const char* to_cstring(ImageWriter::Encoding encoding)
+{
+    switch (encoding)
+    {
+        case ImageWriter::Encoding::raw:
+            return "raw";
+        case ImageWriter::Encoding::run_length:
+            return "rle";
+    }
+    CELER_ASSERT_UNREACHABLE();
+}
+
+//---------------------------------------------------------------------------//
+} // namespace demo_rasterizer
@@ -0,0 +1,90 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ImageWriter.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "base/Array.hh"
+#include "base/Span.hh"
+
+namespace demo_rasterizer
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Stream a volume ID image to a compact binary file.
+ *
+ * The file is a header followed by tiles of whole lines, which may appear in
+ * any order so that they can be written as soon as they're traced. All
+ * values are 32-bit little-endian integers:
+ *
+ * \verbatim
+   header: "CELERIMG" version encoding num_lines num_pixels
+   tile:   first_line num_lines num_words word[num_words]
+   \endverbatim
+ *
+ * The words of a raw tile are the volume IDs (-1 for outside) of each pixel
+ * in row-major order. A run-length tile has (count, volume ID) pairs.
+ *
+ * Tiles are encoded by the calling thread, and only the file write is
+ * serialized, so multiple host threads can write concurrently.
+ */
+class ImageWriter
+{
+  public:
+    //!@{
+    //! Type aliases
+    using UInt2        = celeritas::Array<unsigned int, 2>;
+    using SpanConstInt = celeritas::Span<const int>;
+    //!@}
+
+    //! Pixel encoding for each tile
+    enum class Encoding : std::uint32_t
+    {
+        raw        = 0,
+        run_length = 1
+    };
+
+  public:
+    // Open the file and write the header
+    ImageWriter(const std::string& filename, UInt2 dims, Encoding encoding);
+
+    // Write a tile of whole lines
+    void operator()(unsigned int first_line, SpanConstInt pixels);
+
+    // Number of lines written so far
+    unsigned int num_lines_written() const;
+
+    //! Pixel encoding
+    Encoding encoding() const { return encoding_; }
+
+  private:
+    using VecWord = std::vector<std::uint32_t>;
+
+    std::string        filename_;
+    UInt2              dims_;
+    Encoding           encoding_;
+    mutable std::mutex write_mutex_;
+    std::ofstream      os_;
+    unsigned int       num_lines_written_ = 0;
+
+    // Write words to the file as little-endian bytes
+    void write(const VecWord& words);
+};
+
+//---------------------------------------------------------------------------//
+// Get the encoding from a string (\c "raw" or \c "rle")
+ImageWriter::Encoding to_encoding(const std::string& name);
+
+// Get the string name of an encoding
+const char* to_cstring(ImageWriter::Encoding encoding);
+
+//---------------------------------------------------------------------------//
+} // namespace demo_rasterizer
@@ -11,6 +11,7 @@
 #include "base/KernelParamCalculator.cuda.hh"
 #include "geometry/GeoTrackView.hh"
 #include "ImageTrackView.hh"
+#include "RDemoTrace.hh"
 
 using namespace celeritas;
 using namespace demo_rasterizer;
@@ -23,13 +24,6 @@ namespace
 // KERNELS
 //---------------------------------------------------------------------------//
 
-__device__ int geo_id(const GeoTrackView& geo)
-{
-    if (geo.is_outside())
-        return -1;
-    return geo.volume_id().get();
-}
-
 __global__ void trace_kernel(const GeoParamsPointers geo_params,
                              const GeoStatePointers  geo_state,
                              const ImagePointers     image_state)
@@ -40,51 +34,7 @@ __global__ void trace_kernel(const GeoParamsPointers geo_params,
 
     ImageTrackView image(image_state, tid);
     GeoTrackView   geo(geo_params, geo_state, tid);
-
-    // Start track at the leftmost point in the requested direction
-    geo = GeoStateInitializer{image.start_pos(), image.start_dir()};
-
-    int cur_id = geo_id(geo);
-    geo.find_next_step();
-    real_type geo_dist = geo.next_step();
-
-    // Track along each pixel
-    for (unsigned int i = 0; i < image_state.dims[1]; ++i)
-    {
-        real_type pix_dist = image_state.pixel_width;
-        real_type max_dist = 0;
-        int       max_id   = cur_id;
-        while (geo_dist <= pix_dist)
-        {
-            // Move to geometry boundary
-            pix_dist -= geo_dist;
-
-            if (max_id == cur_id)
-            {
-                max_dist += geo_dist;
-            }
-            else if (geo_dist > max_dist)
-            {
-                max_dist = geo_dist;
-                max_id   = cur_id;
-            }
-
-            // Cross surface
-            geo.move_next_step();
-            cur_id = geo_id(geo);
-            geo.find_next_step();
-            geo_dist = geo.next_step();
-        }
-
-        // Move to pixel boundary
-        geo_dist -= pix_dist;
-        if (pix_dist > max_dist)
-        {
-            max_dist = pix_dist;
-            max_id   = cur_id;
-        }
-        image.set_pixel(i, max_id);
-    }
+    trace_line(geo, image);
 }
 } // namespace
 
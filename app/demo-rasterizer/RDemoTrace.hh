@@ -0,0 +1,152 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RDemoTrace.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "ImageTrackView.hh"
+
+namespace demo_rasterizer
+{
+//---------------------------------------------------------------------------//
+/*!
+ * A straight section of a line inside a single volume.
+ */
+struct LineSegment
+{
+    int                  volume;   //!< Volume ID, or -1 if outside
+    celeritas::real_type distance; //!< Length of the segment
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the volume ID as an integer, or -1 if outside.
+ */
+template<class GTV>
+inline CELER_FUNCTION int geo_id(const GTV& geo)
+{
+    if (geo.is_outside())
+        return -1;
+    return geo.volume_id().get();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Generate the segments of a line by moving through the geometry.
+ *
+ * Each call returns the volume at the current point and the distance to its
+ * next boundary, and the following call first crosses that boundary.
+ */
+template<class GTV>
+class GeoSegmentWalker
+{
+  public:
+    //! Construct and initialize the geometry state
+    CELER_FUNCTION GeoSegmentWalker(GTV&                    geo,
+                                    const celeritas::Real3& pos,
+                                    const celeritas::Real3& dir)
+        : geo_(geo)
+    {
+        using Initializer_t = typename GTV::Initializer_t;
+        geo_                = Initializer_t{pos, dir};
+    }
+
+    //! Get the next segment
+    CELER_FUNCTION LineSegment operator()()
+    {
+        if (started_)
+        {
+            // Cross surface
+            geo_.move_next_step();
+        }
+        started_ = true;
+
+        LineSegment result;
+        result.volume = geo_id(geo_);
+        geo_.find_next_step();
+        result.distance = geo_.next_step();
+        return result;
+    }
+
+  private:
+    GTV& geo_;
+    bool started_ = false;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Assign pixel values along a line from a sequence of segments.
+ *
+ * Each pixel is assigned the volume with the longest path inside it.
+ */
+template<class F>
+inline CELER_FUNCTION void
+rasterize_line(F& next_segment, ImageTrackView& image)
+{
+    using celeritas::real_type;
+
+    LineSegment segment  = next_segment();
+    int         cur_id   = segment.volume;
+    real_type   geo_dist = segment.distance;
+
+    // Track along each pixel
+    for (unsigned int i = 0; i < image.num_pixels(); ++i)
+    {
+        real_type pix_dist = image.pixel_width();
+        real_type max_dist = 0;
+        int       max_id   = cur_id;
+        while (geo_dist <= pix_dist)
+        {
+            // Move to geometry boundary
+            pix_dist -= geo_dist;
+
+            if (max_id == cur_id)
+            {
+                max_dist += geo_dist;
+            }
+            else if (geo_dist > max_dist)
+            {
+                max_dist = geo_dist;
+                max_id   = cur_id;
+            }
+
+            // Cross surface
+            segment  = next_segment();
+            cur_id   = segment.volume;
+            geo_dist = segment.distance;
+        }
+
+        // Move to pixel boundary
+        geo_dist -= pix_dist;
+        if (pix_dist > max_dist)
+        {
+            max_dist = pix_dist;
+            max_id   = cur_id;
+        }
+        image.set_pixel(i, max_id);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Trace a single line of the image.
+ *
+ * The track starts at the leftmost point of the line and moves rightward.
+ * Both the device kernel and the host rasterizer call this so that their
+ * images are identical.
+ */
+template<class GTV>
+inline CELER_FUNCTION void trace_line(GTV& geo, ImageTrackView& image)
+{
+    GeoSegmentWalker<GTV> next_segment(
+        geo, image.start_pos(), image.start_dir());
+    rasterize_line(next_segment, image);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace demo_rasterizer
@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+# Copyright 2021 UT-Battelle, LLC and other Celeritas Developers.
+# See the top-level COPYRIGHT file for details.
+# SPDX-License-Identifier: (Apache-2.0 OR MIT)
+"""
+Check that the host rasterizer reproduces the device image exactly.
+"""
+import json
+import subprocess
+from os import environ
+from os.path import dirname, realpath
+from sys import exit, argv, path
+
+path.insert(0, dirname(realpath(__file__)))
+from visualize import read_image
+
+try:
+    (gdml_filename,) = argv[1:]
+except ValueError:
+    print("usage: {} inp.gdml".format(argv[0]))
+    exit(2)
+
+exe = environ.get('CELERITAS_DEMO_EXE', './demo-rasterizer')
+
+inp = {
+    'image': {
+        'lower_left': [-10, -10, 0],
+        'upper_right': [10, 10, 0],
+        'rightward_ax': [1, 0, 0],
+        'vertical_pixels': 128
+    },
+    'input': gdml_filename,
+}
+
+
+def run(name, env):
+    result = subprocess.run([exe, '-'],
+                            input=json.dumps(dict(
+                                inp, output='compare-{}.bin'.format(name)
+                            )).encode(),
+                            stdout=subprocess.PIPE,
+                            env=dict(environ, **env))
+    if result.returncode:
+        print("Run failed with error", result.returncode)
+        exit(result.returncode)
+    return json.loads(result.stdout.decode())
+
+
+device = run('device', {})
+if not device['runtime']['device']:
+    print("error: no GPU is available to compare against")
+    exit(1)
+host = run('host', {'CELER_DISABLE_DEVICE': '1'})
+assert not host['runtime']['device']
+
+expected = read_image(device)
+image = read_image(host)
+if image.shape != expected.shape:
+    print("error: host image has shape", image.shape, "but device image has",
+          expected.shape)
+    exit(1)
+num_diff = (image != expected).sum()
+if num_diff:
+    print("error: {} of {} host pixels differ from the device image".format(
+        num_diff, image.size))
+    exit(1)
+print("Host and device images with shape", image.shape, "are identical")
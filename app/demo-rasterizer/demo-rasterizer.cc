@@ -8,13 +8,16 @@
 #include <cstddef>
 #include <iostream>
 #include <fstream>
+#include <memory>
 #include <string>
 #include <vector>
 #include <nlohmann/json.hpp>
 
+#include "celeritas_config.h"
 #include "celeritas_version.h"
 #include "base/ColorUtils.hh"
 #include "base/Range.hh"
+#include "base/Stopwatch.hh"
 #include "comm/Communicator.hh"
 #include "comm/Device.hh"
 #include "comm/DeviceIO.json.hh"
@@ -23,7 +26,11 @@
 #include "comm/Logger.hh"
 #include "comm/ScopedMpiInit.hh"
 
-#include "RDemoRunner.hh"
+#include "HostRDemoRunner.hh"
+#include "ImageWriter.hh"
+#if CELERITAS_USE_CUDA
+#    include "RDemoRunner.hh"
+#endif
 
 using namespace celeritas;
 using std::cerr;
@@ -32,9 +39,71 @@ using std::endl;
 
 namespace demo_rasterizer
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Image slice to render and the file to write it to
+struct View
+{
+    ImageRunArgs image;
+    std::string  output;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read the views to render: either a list of views or a single image.
+ */
+std::vector<View> read_views(const nlohmann::json& inp)
+{
+    std::vector<View> result;
+    if (inp.count("views"))
+    {
+        for (const auto& view : inp.at("views"))
+        {
+            result.push_back({view.at("image").get<ImageRunArgs>(),
+                              view.at("output").get<std::string>()});
+        }
+    }
+    else
+    {
+        result.push_back({inp.at("image").get<ImageRunArgs>(),
+                          inp.at("output").get<std::string>()});
+    }
+    CELER_VALIDATE(!result.empty(), "No views were given to render");
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the parts of a traced image that weren't streamed to disk.
+ */
+void write_image(const ImageStore&  image,
+                 const std::string& filename,
+                 ImageWriter*       writer)
+{
+    if (!writer)
+    {
+        auto image_data = image.data_to_host();
+        std::ofstream(filename, std::ios::binary)
+            .write(
+                reinterpret_cast<const char*>(image_data.data()),
+                image_data.size() * sizeof(decltype(image_data)::value_type));
+    }
+    else if (writer->num_lines_written() == 0)
+    {
+        // Device images are written in a single tile after tracing
+        auto image_data = image.data_to_host();
+        (*writer)(0, celeritas::make_span(image_data));
+    }
+    CELER_ASSERT(!writer || writer->num_lines_written() == image.dims()[0]);
+}
+} // namespace
+
 //---------------------------------------------------------------------------//
 /*!
  * Run, launch, and output.
+ *
+ * All views share the loaded geometry and are traced in a single pass.
  */
 void run(std::istream& is)
 {
@@ -45,17 +114,79 @@ void run(std::istream& is)
     auto geo_params = std::make_shared<GeoParams>(
         inp.at("input").get<std::string>().c_str());
 
-    if (inp.count("cuda_stack_size"))
+    if (celeritas::device() && inp.count("cuda_stack_size"))
     {
         GeoParams::set_cuda_stack_size(inp.at("cuda_stack_size").get<int>());
     }
 
-    // Construct image
-    ImageStore image(inp.at("image").get<ImageRunArgs>());
+    // Construct images on the device if available, otherwise on the host,
+    // and stream compact binary images if an encoding is given
+    const std::vector<View> views = read_views(inp);
+    const MemSpace          memspace
+        = celeritas::device() ? MemSpace::device : MemSpace::host;
 
-    // Construct runner
-    RDemoRunner run(geo_params);
-    run(&image);
+    // Host images that are fully traced and streamed needn't be stored
+    const unsigned int adaptive_lines = inp.value("adaptive_lines", 0u);
+    const bool         streamed       = (memspace == MemSpace::host
+                                   && inp.count("output_encoding")
+                                   && adaptive_lines == 0);
+    std::vector<std::unique_ptr<ImageStore>>  images;
+    std::vector<std::unique_ptr<ImageWriter>> writers;
+    for (const View& view : views)
+    {
+        images.push_back(std::make_unique<ImageStore>(
+            view.image,
+            memspace,
+            streamed ? ImageStore::Storage::streamed
+                     : ImageStore::Storage::full));
+        writers.emplace_back();
+        if (inp.count("output_encoding"))
+        {
+            writers.back() = std::make_unique<ImageWriter>(
+                view.output,
+                images.back()->dims(),
+                to_encoding(inp.at("output_encoding").get<std::string>()));
+        }
+    }
+
+    // Trace the images
+    Stopwatch get_time;
+    if (memspace == MemSpace::device)
+    {
+#if CELERITAS_USE_CUDA
+        if (adaptive_lines > 0)
+        {
+            CELER_LOG(warning) << "Ignoring 'adaptive_lines': adaptive "
+                                  "tracing is only implemented on the host";
+        }
+        RDemoRunner run(geo_params);
+        for (auto& image : images)
+        {
+            run(image.get());
+        }
+#else
+        CELER_ASSERT_UNREACHABLE();
+#endif
+    }
+    else
+    {
+        HostRDemoRunner::Options options;
+        if (inp.count("tile_lines"))
+        {
+            options.tile_lines = inp.at("tile_lines").get<unsigned int>();
+        }
+        options.coarse_lines = adaptive_lines;
+        HostRDemoRunner            run(geo_params, options);
+        HostRDemoRunner::VecImage  image_ptrs;
+        HostRDemoRunner::VecWriter writer_ptrs;
+        for (auto i : celeritas::range(images.size()))
+        {
+            image_ptrs.push_back(images[i].get());
+            writer_ptrs.push_back(writers[i].get());
+        }
+        run(image_ptrs, writer_ptrs);
+    }
+    const double trace_time = get_time();
 
     // Get geometry names
     std::vector<std::string> vol_names;
@@ -65,19 +196,28 @@ void run(std::istream& is)
             geo_params->id_to_label(celeritas::VolumeId(vol_id)));
     }
 
-    // Write image
-    CELER_LOG(status) << "Transferring image from GPU to disk";
-    std::string out_filename = inp.at("output");
-    auto        image_data   = image.data_to_host();
-    std::ofstream(out_filename, std::ios::binary)
-        .write(reinterpret_cast<const char*>(image_data.data()),
-               image_data.size() * sizeof(decltype(image_data)::value_type));
+    // Write images
+    CELER_LOG(status) << "Transferring images to disk";
+    nlohmann::json view_outp = nlohmann::json::array();
+    for (auto i : celeritas::range(views.size()))
+    {
+        write_image(*images[i], views[i].output, writers[i].get());
+
+        nlohmann::json outp = {
+            {"metadata", *images[i]},
+            {"data", views[i].output},
+        };
+        if (writers[i])
+        {
+            outp["encoding"] = to_cstring(writers[i]->encoding());
+        }
+        view_outp.push_back(std::move(outp));
+        CELER_LOG(info) << "Exported image to " << views[i].output;
+    }
 
     // Construct json output
     CELER_LOG(status) << "Exporting JSON metadata";
     nlohmann::json outp = {
-        {"metadata", image},
-        {"data", out_filename},
         {"volumes", vol_names},
         {
             "runtime",
@@ -85,11 +225,23 @@ void run(std::istream& is)
                 {"version", std::string(celeritas_version)},
                 {"device", celeritas::device()},
                 {"kernels", celeritas::kernel_diagnostics()},
+                {"host_threads",
+                 memspace == MemSpace::host ? HostRDemoRunner::num_threads()
+                                            : 0},
+                {"time", trace_time},
             },
         },
     };
+    if (inp.count("views"))
+    {
+        outp["views"] = std::move(view_outp);
+    }
+    else
+    {
+        // Single image: keep its output at the top level
+        outp.update(view_outp.front());
+    }
     cout << outp.dump() << endl;
-    CELER_LOG(info) << "Exported image to " << out_filename;
 }
 
 } // namespace demo_rasterizer
@@ -137,13 +289,14 @@ int main(int argc, char* argv[])
         instream_ptr = &std::cin;
     }
 
-    // Initialize GPU
-    celeritas::activate_device(Device(0));
-
-    if (!celeritas::device())
+    // Initialize GPU if available; otherwise trace on the host
+    if (Device::num_devices() > 0)
     {
-        CELER_LOG(critical) << "CUDA capability is disabled";
-        return EXIT_FAILURE;
+        celeritas::activate_device(Device(0));
+    }
+    else
+    {
+        CELER_LOG(info) << "No GPU is available: rasterizing on the host";
     }
 
     try
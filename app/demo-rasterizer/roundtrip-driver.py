@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+# Copyright 2021 UT-Battelle, LLC and other Celeritas Developers.
+# See the top-level COPYRIGHT file for details.
+# SPDX-License-Identifier: (Apache-2.0 OR MIT)
+"""
+Check that every image output format reads back as the same image, and that
+views rendered together match the same views rendered separately.
+"""
+import json
+import subprocess
+from os import environ
+from os.path import dirname, realpath
+from sys import exit, argv, path
+
+path.insert(0, dirname(realpath(__file__)))
+from visualize import read_image
+
+try:
+    (gdml_filename,) = argv[1:]
+except ValueError:
+    print("usage: {} inp.gdml".format(argv[0]))
+    exit(2)
+
+exe = environ.get('CELERITAS_DEMO_EXE', './demo-rasterizer')
+
+
+slice_image = {
+    'lower_left': [-10, -10, 0],
+    'upper_right': [10, 10, 0],
+    'rightward_ax': [1, 0, 0],
+    'vertical_pixels': 32
+}
+side_image = {
+    'lower_left': [0, -10, -10],
+    'upper_right': [0, 10, 10],
+    'rightward_ax': [0, 1, 0],
+    'vertical_pixels': 20
+}
+
+
+def run(inp):
+    inp = dict(inp, input=gdml_filename, tile_lines=3)
+    result = subprocess.run([exe, '-'],
+                            input=json.dumps(inp).encode(),
+                            stdout=subprocess.PIPE)
+    if result.returncode:
+        print("Run failed with error", result.returncode)
+        exit(result.returncode)
+    return json.loads(result.stdout.decode())
+
+
+def check_same(expected, image, what):
+    if image.shape != expected.shape or (image != expected).any():
+        print("error:", what, "differs")
+        exit(1)
+    print("Read", what + ": identical")
+
+
+def run_image(image, name, encoding=None):
+    inp = {'image': image, 'output': 'roundtrip-{}.bin'.format(name)}
+    if encoding:
+        inp['output_encoding'] = encoding
+    return read_image(run(inp))
+
+
+expected = run_image(slice_image, 'native')
+print("Read native image with shape", expected.shape)
+for encoding in ['raw', 'rle']:
+    image = run_image(slice_image, encoding, encoding)
+    check_same(expected, image, "image with {} encoding".format(encoding))
+
+side = run_image(side_image, 'side')
+for encoding in [None, 'rle']:
+    # Streamed views of different widths share the host tile buffers
+    name = 'roundtrip-view{}' + ('-' + encoding if encoding else '') + '.bin'
+    inp = {'views': [
+        {'image': slice_image, 'output': name.format(0)},
+        {'image': side_image, 'output': name.format(1)},
+    ]}
+    if encoding:
+        inp['output_encoding'] = encoding
+    views = [read_image(view) for view in run(inp)['views']]
+    what = "of two views" + (" with {} encoding".format(encoding)
+                             if encoding else "")
+    check_same(expected, views[0], "first " + what)
+    check_same(side, views[1], "second " + what)
@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+# Copyright 2021 UT-Battelle, LLC and other Celeritas Developers.
+# See the top-level COPYRIGHT file for details.
+# SPDX-License-Identifier: (Apache-2.0 OR MIT)
+"""
+Measure the scaling of the host rasterizer over thread counts and image
+resolutions.
+
+The rasterizer is run on the host (with the GPU disabled) for each
+combination of image height and OpenMP thread count. The tracing times,
+speedups, and parallel efficiencies are printed and saved to a JSON file.
+"""
+import json
+import os
+import subprocess
+from sys import exit, argv
+
+try:
+    (gdml_filename,) = argv[1:]
+except ValueError:
+    print("usage: {} inp.gdml".format(argv[0]))
+    exit(2)
+
+exe = os.environ.get('CELERITAS_DEMO_EXE', './demo-rasterizer')
+max_threads = os.cpu_count() or 1
+thread_counts = sorted({2**i for i in range(max_threads.bit_length())}
+                       | {max_threads})
+resolutions = [256, 512, 1024, 2048]
+
+
+def run(vertical_pixels, num_threads):
+    inp = {
+        'image': {
+            'lower_left': [-100, -100, 0],
+            'upper_right': [100, 100, 0],
+            'rightward_ax': [1, 0, 0],
+            'vertical_pixels': vertical_pixels
+        },
+        'input': gdml_filename,
+        'output': 'scaling-benchmark.bin'
+    }
+    env = dict(os.environ)
+    env['CELER_DISABLE_DEVICE'] = '1'
+    env['CELER_DISABLE_PARALLEL'] = '1'
+    env['OMP_NUM_THREADS'] = str(num_threads)
+    result = subprocess.run([exe, '-'],
+                            input=json.dumps(inp).encode(),
+                            stdout=subprocess.PIPE,
+                            env=env)
+    if result.returncode:
+        print("Run failed with error", result.returncode)
+        exit(result.returncode)
+    runtime = json.loads(result.stdout.decode())['runtime']
+    assert runtime['host_threads'] == num_threads
+    return runtime['time']
+
+
+results = []
+print("{:>8s} {:>8s} {:>10s} {:>8s} {:>10s}".format(
+    "pixels", "threads", "time [s]", "speedup", "efficiency"))
+for vertical_pixels in resolutions:
+    serial_time = None
+    for num_threads in thread_counts:
+        time = run(vertical_pixels, num_threads)
+        if serial_time is None:
+            serial_time = time
+        speedup = serial_time / time
+        print("{:8d} {:8d} {:10.4f} {:8.2f} {:10.2f}".format(
+            vertical_pixels, num_threads, time, speedup,
+            speedup / num_threads))
+        results.append({'vertical_pixels': vertical_pixels,
+                        'threads': num_threads,
+                        'time': time})
+
+with open('scaling-benchmark.json', 'w') as f:
+    json.dump(results, f, indent=1)
@@ -4,18 +4,58 @@
 # See the top-level COPYRIGHT file for details.
 # SPDX-License-Identifier: (Apache-2.0 OR MIT)
 """
+Plot a rasterized image from the demo-rasterizer output.
+
+Images written with an "output_encoding" are in the compact tiled format
+written by ImageWriter; otherwise they're a raw dump of native integers.
+If several views were rendered, each is plotted to a separate file.
 """
 import json
-import matplotlib.pyplot as plt
 import numpy as np
+import os
 import sys
 
+MAGIC = b'CELERIMG'
+ENCODINGS = {0: 'raw', 1: 'rle'}
+LE_UINT32 = np.dtype('<u4')
+
+def read_celerimg(filename):
+    """Read a tiled, optionally run-length encoded, image file."""
+    words = np.fromfile(filename, dtype=np.uint8)
+    assert words[:len(MAGIC)].tobytes() == MAGIC, "not a celeritas image"
+    words = words[len(MAGIC):].view(LE_UINT32)
+    (version, encoding, num_lines, num_pixels) = words[:4]
+    assert version == 1, f"unknown image version {version}"
+    encoding = ENCODINGS[encoding]
+
+    image = np.empty((num_lines, num_pixels), dtype=np.int32)
+    written = np.zeros(num_lines, dtype=bool)
+    pos = 4
+    while pos < len(words):
+        (first_line, tile_lines, num_words) = words[pos:pos + 3]
+        pos += 3
+        data = words[pos:pos + num_words].astype(np.uint32).view(np.int32)
+        pos += num_words
+        if encoding == 'rle':
+            data = np.repeat(data[1::2], data[0::2])
+        lines = slice(first_line, first_line + tile_lines)
+        image[lines] = np.reshape(data, (tile_lines, num_pixels))
+        written[lines] = True
+    assert written.all(), "image file is missing lines"
+    return image
+
 def read_image(input):
+    if 'encoding' in input:
+        image = read_celerimg(input['data'])
+        assert list(image.shape) == input['metadata']['dims']
+        return image
     assert input['metadata']['int_size'] == 4
     image = np.fromfile(input['data'], dtype=np.int32)
     return np.reshape(image, input['metadata']['dims'])
 
 def main():
+    import matplotlib.pyplot as plt
+
     try:
         (json_input, imgname) = sys.argv[1:]
     except ValueError:
@@ -27,11 +67,19 @@ def main():
     else:
         input = json.load(sys.stdin)
 
-    image = read_image(input)
+    if 'views' in input:
+        (stem, ext) = os.path.splitext(imgname)
+        outputs = [(view, "{}-{}{}".format(stem, i, ext))
+                   for (i, view) in enumerate(input['views'])]
+    else:
+        outputs = [(input, imgname)]
+
+    for (view, filename) in outputs:
+        image = read_image(view)
 
-    (fig, ax) = plt.subplots()
-    ax.imshow(image)
-    fig.savefig(imgname)
+        (fig, ax) = plt.subplots()
+        ax.imshow(image)
+        fig.savefig(filename)
 
 if __name__ == '__main__':
     main()
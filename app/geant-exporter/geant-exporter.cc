@@ -19,6 +19,8 @@
 #include <G4ParticleTable.hh>
 #include <G4Material.hh>
 #include <G4MaterialTable.hh>
+#include <G4ProductionCuts.hh>
+#include <G4ProductionCutsTable.hh>
 #include <G4SystemOfUnits.hh>
 #include <G4Transportation.hh>
 
@@ -50,6 +52,7 @@ using celeritas::ImportElement;
 using celeritas::ImportMaterial;
 using celeritas::ImportMaterialState;
 using celeritas::ImportParticle;
+using celeritas::ImportProductionCut;
 using celeritas::ImportVolume;
 using celeritas::mat_id;
 using celeritas::real_type;
@@ -305,6 +308,26 @@ void store_geometry(TFile*                       root_file,
             material.elements_fractions.insert({elid, elem_mass_fraction});
             material.elements_num_fractions.insert({elid, elem_num_fraction});
         }
+
+        // Populate production cuts for this material-cuts couple
+        const G4ProductionCuts* g4cuts = g4material_cuts->GetProductionCuts();
+        CELER_ASSERT(g4cuts);
+        for (const auto& pdg_index : {
+                 std::make_pair(celer_pdg::gamma(), idxG4GammaCut),
+                 std::make_pair(celer_pdg::electron(), idxG4ElectronCut),
+                 std::make_pair(celer_pdg::positron(), idxG4PositronCut),
+                 std::make_pair(celer_pdg::proton(), idxG4ProtonCut),
+             })
+        {
+            const auto* energy_cuts
+                = g4production_cuts.GetEnergyCutsVector(pdg_index.second);
+            CELER_ASSERT(energy_cuts);
+
+            ImportProductionCut cut;
+            cut.energy = energy_cuts->at(g4material_cuts->GetIndex()) / MeV;
+            cut.range  = g4cuts->GetProductionCut(pdg_index.second) / cm;
+            material.pdg_cutoffs.insert({pdg_index.first.get(), cut});
+        }
         // Add material to the global material map
         geometry.add_material(g4material_cuts->GetIndex(), material);
     }
@@ -116,10 +116,10 @@ inline CELER_FUNCTION Real3 from_spherical(real_type costheta, real_type phi)
  *
  * There is some extra code in here to deal with loss of precision when the
  * incident direction is along the \em z axis. As \c rot approaches \em z, the
- * azimuthal angle \em phi must be calculated carefully from both the x and y
- * components of the vector, not independently. If \c rot actually equals \em z
- * then the azimuthal angle is completely indeterminate so we arbitrarily
- * choose \c phi = 0.
+ * polar and azimuthal angles must be calculated from the x and y
+ * components of the vector rather than from the z component. If \c rot
+ * actually equals \em z then the azimuthal angle is completely indeterminate
+ * so we arbitrarily choose \c phi = 0.
  *
  * This function is often used for calculating exiting scattering angles. In
  * that case, \c dir is the exiting angle from the scattering calculation, and
@@ -151,19 +151,19 @@ inline CELER_FUNCTION Real3 rotate(const Real3& dir, const Real3& rot)
     real_type cosphi;
     real_type sinphi;
 
-    if (sintheta >= sqrt_eps)
+    if (!(sintheta >= sqrt_eps))
+    {
+        // Near the z axis, 1 - z^2 loses all precision (especially in single
+        // precision): calculate from the transverse components instead
+        sintheta = std::sqrt(rot[X] * rot[X] + rot[Y] * rot[Y]);
+    }
+
+    if (sintheta > 0)
     {
-        // Typical case: far enough from z axis to calculate correctly
         const real_type inv_sintheta = 1 / (sintheta);
         cosphi                       = rot[X] * inv_sintheta;
         sinphi                       = rot[Y] * inv_sintheta;
     }
-    else if (sintheta > 0)
-    {
-        // Gives "correct" answers as long as x or y is not zero
-        cosphi = rot[X] / std::sqrt(rot[X] * rot[X] + rot[Y] * rot[Y]);
-        sinphi = std::sqrt(1 - cosphi * cosphi);
-    }
     else
     {
         // NaN or 0: choose an arbitrary azimuthal angle for the incident dir
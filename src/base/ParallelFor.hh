@@ -0,0 +1,22 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ParallelFor.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+// Call a function for each index, using host threads if available
+template<class F>
+inline void parallel_for(size_type count, F&& func);
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "ParallelFor.i.hh"
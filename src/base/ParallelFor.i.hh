@@ -0,0 +1,69 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ParallelFor.i.hh
+//---------------------------------------------------------------------------//
+#include <exception>
+#include "celeritas_config.h"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Call a function for each index in [0, count), using host threads if
+ * available.
+ *
+ * When built with OpenMP, the iterations are dynamically distributed among
+ * the threads of a parallel region, so the function must be safe to call
+ * concurrently for different indices. Callers that need deterministic output
+ * should write each result into a preallocated slot for its index and combine
+ * the results serially afterward.
+ *
+ * Exceptions can't propagate out of a parallel region, so the first exception
+ * thrown by any iteration is captured and rethrown after all iterations
+ * complete.
+ *
+ * \code
+    std::vector<Result> results(inputs.size());
+    parallel_for(inputs.size(),
+                 [&](size_type i) { results[i] = calc_result(inputs[i]); });
+   \endcode
+ */
+template<class F>
+void parallel_for(size_type count, F&& func)
+{
+    std::exception_ptr error;
+
+#if CELERITAS_USE_OPENMP
+#    pragma omp parallel for schedule(dynamic)
+#endif
+    for (size_type i = 0; i < count; ++i)
+    {
+        try
+        {
+            func(i);
+        }
+        catch (...)
+        {
+#if CELERITAS_USE_OPENMP
+#    pragma omp critical(celeritas_parallel_for)
+#endif
+            {
+                if (!error)
+                {
+                    error = std::current_exception();
+                }
+            }
+        }
+    }
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -22,7 +22,11 @@ using size_type = std::size_t;
 #endif
 
 //! Numerical type for real numbers
+#if CELERITAS_SINGLE_PRECISION
+using real_type = float;
+#else
 using real_type = double;
+#endif
 
 //! Equivalent to std::size_t but compatible with CUDA atomics
 using ull_int = unsigned long long int;
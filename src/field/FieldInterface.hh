@@ -0,0 +1,115 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file FieldInterface.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Array.hh"
+#include "base/Collection.hh"
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "base/Units.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Position and momentum of a charged track along its path.
+ *
+ * The momentum is in units of MeV / c, and the position is in native units.
+ */
+struct OdeState
+{
+    Real3 pos; //!< Position
+    Real3 mom; //!< Momentum [MeV / c]
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Result of integrating the equation of motion over a substep.
+ *
+ * The midpoint is used to estimate how far the path deviates from its chord,
+ * and the error estimate is used to control the integration accuracy.
+ */
+struct StepperResult
+{
+    OdeState mid_state; //!< State halfway along the substep
+    OdeState end_state; //!< State at the end of the substep
+    OdeState err_state; //!< Estimated integration error of the end state
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tolerances for propagating a track in a magnetic field.
+ *
+ * The defaults match the Geant4 chord finder: the curved path is
+ * approximated by chords whose distance from the path is at most
+ * \c delta_chord , and a boundary crossing is accepted when the chord
+ * intersection is within \c delta_intersection of the path.
+ */
+struct FieldOptions
+{
+    //! Maximum distance between a chord and the curved path
+    real_type delta_chord = 0.25 * units::millimeter;
+    //! Maximum distance between a boundary intersection and the path
+    real_type delta_intersection = 1e-3 * units::millimeter;
+    //! Maximum relative integration error of a substep
+    real_type epsilon_step = 1e-5;
+    //! Smallest substep that will be attempted
+    real_type minimum_step = 1e-5 * units::millimeter;
+    //! Maximum number of substeps in a single propagation
+    size_type max_substeps = 100;
+
+    //! Whether the options are valid
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return delta_chord > 0 && delta_intersection > 0 && epsilon_step > 0
+               && minimum_step > 0 && max_substeps > 0;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Magnetic field values on a regular 3D grid.
+ *
+ * The field is stored at \c dims grid points along each axis, with the first
+ * point at \c lower and a constant \c delta between points. Values are
+ * stored with the z index varying fastest.
+ *
+ * \sa FieldMapParams (owns the pointed-to data)
+ * \sa FieldMapView (uses the pointed-to data in a kernel)
+ */
+template<Ownership W, MemSpace M>
+struct FieldMapData
+{
+    Array<size_type, 3>     dims{0, 0, 0};
+    Real3                   lower{0, 0, 0};
+    Real3                   delta{0, 0, 0};
+    Collection<Real3, W, M> values;
+
+    //// MEMBER FUNCTIONS ////
+
+    //! Whether the data is assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return dims[0] > 1 && dims[1] > 1 && dims[2] > 1 && !values.empty();
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    FieldMapData& operator=(const FieldMapData<W2, M2>& other)
+    {
+        CELER_EXPECT(other);
+        dims   = other.dims;
+        lower  = other.lower;
+        delta  = other.delta;
+        values = other.values;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
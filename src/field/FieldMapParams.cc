@@ -0,0 +1,54 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file FieldMapParams.cc
+//---------------------------------------------------------------------------//
+#include "FieldMapParams.hh"
+
+#include "base/Assert.hh"
+#include "base/CollectionBuilder.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from grid values.
+ */
+FieldMapParams::FieldMapParams(const Input& inp)
+{
+    size_type num_points = 1;
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        CELER_VALIDATE(inp.dims[ax] >= 2,
+                       "Field map needs at least two points along axis "
+                           << ax);
+        CELER_VALIDATE(inp.lower[ax] < inp.upper[ax],
+                       "Field map has invalid extents along axis " << ax);
+        num_points *= inp.dims[ax];
+    }
+    CELER_VALIDATE(inp.values.size() == num_points,
+                   "Field map has " << inp.values.size()
+                                    << " values but " << num_points
+                                    << " grid points");
+
+    FieldMapData<Ownership::value, MemSpace::host> host_data;
+    host_data.dims  = inp.dims;
+    host_data.lower = inp.lower;
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        host_data.delta[ax] = (inp.upper[ax] - inp.lower[ax])
+                              / (inp.dims[ax] - 1);
+    }
+    make_builder(&host_data.values)
+        .insert_back(inp.values.begin(), inp.values.end());
+
+    // Move to mirrored data, copying to device
+    data_ = CollectionMirror<FieldMapData>{std::move(host_data)};
+
+    CELER_ENSURE(data_);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,60 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file FieldMapParams.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+#include "base/CollectionMirror.hh"
+#include "base/Types.hh"
+#include "FieldInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Magnetic field values on a regular 3D grid.
+ *
+ * The input values are at the grid points, with the z index varying fastest:
+ * the value at grid point (i, j, k) is at index
+ * <code>(i * dims[1] + j) * dims[2] + k</code>.
+ */
+class FieldMapParams
+{
+  public:
+    //!@{
+    //! Type aliases
+    using HostRef   = FieldMapData<Ownership::const_reference, MemSpace::host>;
+    using DeviceRef
+        = FieldMapData<Ownership::const_reference, MemSpace::device>;
+    //!@}
+
+    //! Input data to construct this class
+    struct Input
+    {
+        Array<size_type, 3> dims;   //!< Number of grid points along each axis
+        Real3               lower;  //!< Position of the first grid point
+        Real3               upper;  //!< Position of the last grid point
+        std::vector<Real3>  values; //!< Field [native units] at grid points
+    };
+
+  public:
+    // Construct from grid values
+    explicit FieldMapParams(const Input& inp);
+
+    //! Access data on the host
+    const HostRef& host_pointers() const { return data_.host(); }
+
+    //! Access data on the device
+    const DeviceRef& device_pointers() const { return data_.device(); }
+
+  private:
+    // Host/device storage and reference
+    CollectionMirror<FieldMapData> data_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
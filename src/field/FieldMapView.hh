@@ -0,0 +1,54 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file FieldMapView.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "FieldInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Evaluate a magnetic field map by trilinear interpolation.
+ *
+ * \code
+    FieldMapView field(field_map_ref);
+    Real3 value = field(pos);
+   \endcode
+ *
+ * The field is zero outside the grid.
+ */
+class FieldMapView
+{
+  public:
+    //!@{
+    //! Type aliases
+    using FieldMapRef
+        = FieldMapData<Ownership::const_reference, MemSpace::native>;
+    //!@}
+
+  public:
+    // Construct from shared field map data
+    explicit inline CELER_FUNCTION FieldMapView(const FieldMapRef& data);
+
+    // Field at a point
+    inline CELER_FUNCTION Real3 operator()(const Real3& pos) const;
+
+  private:
+    const FieldMapRef& data_;
+
+    // Field value at a grid point
+    inline CELER_FUNCTION const Real3&
+    at(size_type i, size_type j, size_type k) const;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "FieldMapView.i.hh"
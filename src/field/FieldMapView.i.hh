@@ -0,0 +1,82 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file FieldMapView.i.hh
+//---------------------------------------------------------------------------//
+#include <cmath>
+#include "base/Algorithms.hh"
+#include "base/Assert.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from shared field map data.
+ */
+CELER_FUNCTION FieldMapView::FieldMapView(const FieldMapRef& data)
+    : data_(data)
+{
+    CELER_EXPECT(data_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Field at a point.
+ *
+ * Points on the upper faces of the grid use the last grid cell.
+ */
+CELER_FUNCTION Real3 FieldMapView::operator()(const Real3& pos) const
+{
+    Array<size_type, 3> index;
+    Real3               frac;
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        const real_type t     = (pos[ax] - data_.lower[ax]) / data_.delta[ax];
+        const auto      max_t = static_cast<real_type>(data_.dims[ax] - 1);
+        if (!(t >= 0 && t <= max_t))
+        {
+            // Outside the grid (or NaN)
+            return {0, 0, 0};
+        }
+        index[ax] = celeritas::min(static_cast<size_type>(t),
+                                   data_.dims[ax] - 2);
+        frac[ax]  = t - index[ax];
+    }
+
+    Real3 result = {0, 0, 0};
+    for (int corner = 0; corner < 8; ++corner)
+    {
+        // Bits of the corner index select the lower or upper grid point
+        const int di = (corner >> 2) & 1;
+        const int dj = (corner >> 1) & 1;
+        const int dk = corner & 1;
+
+        const real_type weight = (di ? frac[0] : 1 - frac[0])
+                                 * (dj ? frac[1] : 1 - frac[1])
+                                 * (dk ? frac[2] : 1 - frac[2]);
+        const Real3& value
+            = this->at(index[0] + di, index[1] + dj, index[2] + dk);
+        for (int ax = 0; ax < 3; ++ax)
+        {
+            result[ax] += weight * value[ax];
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Field value at a grid point.
+ */
+CELER_FUNCTION const Real3&
+FieldMapView::at(size_type i, size_type j, size_type k) const
+{
+    CELER_EXPECT(i < data_.dims[0] && j < data_.dims[1] && k < data_.dims[2]);
+    return data_.values[ItemId<Real3>{
+        (i * data_.dims[1] + j) * data_.dims[2] + k}];
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,90 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file FieldPropagator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "physics/base/Units.hh"
+#include "FieldInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Propagate (move) a charged particle along a curved path in a field.
+ *
+ * \code
+    UniformField field(value);
+    HelixStepper stepper(field, particle.charge());
+    FieldPropagator<HelixStepper, GeoTrackView> propagate(
+        options, stepper, particle.momentum(), &geo);
+    auto result = propagate(step);
+   \endcode
+ *
+ * The stepper integrates the equation of motion: use \c HelixStepper for a
+ * uniform field and \c RungeKuttaStepper for a general field map. The
+ * geometry track view can be any type with the \c GeoTrackView interface.
+ *
+ * The curved path is divided into substeps whose chords are within
+ * \c FieldOptions::delta_chord of the path, and each chord is checked
+ * against the geometry as a straight line. Substeps inside the safety sphere
+ * (recalculated when the cached safety is exhausted) skip the boundary
+ * search. When a chord crosses a boundary, the
+ * path length to the crossing is estimated from the fraction of the chord
+ * before the boundary: if the path at that length is within
+ * \c FieldOptions::delta_intersection of the chord intersection, the track
+ * is moved to the boundary; otherwise the shorter substep is retried.
+ *
+ * After propagation the track's direction is along the momentum, and the
+ * geometry's next step is invalid.
+ */
+template<class StepperT, class GTV>
+class FieldPropagator
+{
+  public:
+    //! Result of propagating a proposed step
+    struct Propagation
+    {
+        real_type distance;     //!< Path length moved
+        bool      boundary;     //!< Whether the track moved to a new volume
+        size_type num_substeps; //!< Number of accepted chords
+    };
+
+  public:
+    // Construct with shared options, the stepper, and the track state
+    inline CELER_FUNCTION FieldPropagator(const FieldOptions& options,
+                                          const StepperT&     stepper,
+                                          units::MevMomentum  momentum,
+                                          GTV*                track);
+
+    // Move up to the given path length, stopping at the next boundary
+    inline CELER_FUNCTION Propagation operator()(real_type step);
+
+  private:
+    //! An accepted substep
+    struct Substep
+    {
+        StepperResult result;     //!< Integrated states
+        real_type     step;       //!< Path length of the substep
+        real_type     next_trial; //!< Suggested length of the next substep
+    };
+
+    const FieldOptions& options_;
+    const StepperT&     stepper_;
+    real_type           momentum_;
+    GTV&                track_;
+
+    // Find a substep whose chord is close to the path
+    inline CELER_FUNCTION Substep find_substep(real_type       trial,
+                                               const OdeState& beg) const;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "FieldPropagator.i.hh"
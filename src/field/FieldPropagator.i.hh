@@ -0,0 +1,226 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file FieldPropagator.i.hh
+//---------------------------------------------------------------------------//
+#include <cmath>
+#include "base/Algorithms.hh"
+#include "base/ArrayUtils.hh"
+#include "base/Assert.hh"
+#include "base/NumericLimits.hh"
+#include "detail/FieldUtils.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with shared options, the stepper, and the track state.
+ */
+template<class StepperT, class GTV>
+CELER_FUNCTION
+FieldPropagator<StepperT, GTV>::FieldPropagator(const FieldOptions& options,
+                                                const StepperT&     stepper,
+                                                units::MevMomentum  momentum,
+                                                GTV*                track)
+    : options_(options)
+    , stepper_(stepper)
+    , momentum_(momentum.value())
+    , track_(*track)
+{
+    CELER_EXPECT(options_);
+    CELER_EXPECT(momentum_ > 0);
+    CELER_EXPECT(track);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Move up to the given path length, stopping at the next boundary.
+ *
+ * If the maximum number of substeps is reached first (e.g. for a low-energy
+ * track looping in a strong field), the track stops short of the requested
+ * path length.
+ */
+template<class StepperT, class GTV>
+CELER_FUNCTION auto FieldPropagator<StepperT, GTV>::operator()(real_type step)
+    -> Propagation
+{
+    CELER_EXPECT(step > 0);
+    CELER_EXPECT(!track_.is_outside());
+
+    Propagation result;
+    result.distance     = 0;
+    result.boundary     = false;
+    result.num_substeps = 0;
+
+    OdeState state;
+    state.pos = track_.pos();
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        state.mom[ax] = momentum_ * track_.dir()[ax];
+    }
+
+    real_type trial     = step;
+    size_type num_iters = 0;
+    while (result.distance < step && !result.boundary
+           && num_iters++ < options_.max_substeps)
+    {
+        const real_type remaining = step - result.distance;
+        const Substep   sub
+            = this->find_substep(celeritas::min(trial, remaining), state);
+        const OdeState& end = sub.result.end_state;
+        trial               = sub.next_trial;
+
+        // Path length after the substep, avoiding roundoff at the end
+        const real_type next_distance
+            = (sub.step < remaining ? result.distance + sub.step : step);
+
+        if (sub.step <= track_.safety() || sub.step <= track_.find_safety())
+        {
+            // The whole substep is inside the (cached or updated) safety
+            // sphere
+            track_.pos() = end.pos;
+            track_.safety() -= sub.step;
+            state           = end;
+            result.distance = next_distance;
+            ++result.num_substeps;
+            continue;
+        }
+
+        // Check the chord against the geometry
+        Real3 chord_dir = end.pos;
+        axpy(real_type(-1), state.pos, &chord_dir);
+        const real_type chord_len = norm(chord_dir);
+        CELER_ASSERT(chord_len > 0);
+        for (int ax = 0; ax < 3; ++ax)
+        {
+            chord_dir[ax] /= chord_len;
+        }
+        track_.dir() = chord_dir;
+        track_.find_next_step();
+
+        if (chord_len < track_.next_step())
+        {
+            // Move to the end of the chord inside the current volume
+            track_.pos()    = end.pos;
+            track_.safety() = celeritas::max<real_type>(
+                track_.safety() - chord_len, 0);
+            state           = end;
+            result.distance = next_distance;
+            ++result.num_substeps;
+            continue;
+        }
+
+        // Estimate the path length to the boundary from the chord fraction
+        const real_type boundary_step = sub.step * track_.next_step()
+                                        / chord_len;
+        OdeState boundary_state = state;
+        if (boundary_step > 0)
+        {
+            boundary_state = stepper_(boundary_step, state).end_state;
+        }
+        Real3 intersect = state.pos;
+        axpy(track_.next_step(), chord_dir, &intersect);
+
+        if (boundary_step <= options_.minimum_step
+            || detail::calc_distance(boundary_state.pos, intersect)
+                   <= options_.delta_intersection)
+        {
+            // Move to the boundary and into the next volume
+            track_.move_next_step();
+            state.pos       = track_.pos();
+            state.mom       = boundary_state.mom;
+            result.distance = celeritas::min(result.distance + boundary_step,
+                                             step);
+            result.boundary = true;
+            ++result.num_substeps;
+        }
+        else
+        {
+            // Retry with a substep that ends near the boundary
+            trial = boundary_step;
+        }
+    }
+
+    // Update the direction; the boundary distance is no longer valid
+    const real_type inv_mom = 1 / norm(state.mom);
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        track_.dir()[ax] = inv_mom * state.mom[ax];
+    }
+    track_.next_step() = numeric_limits<real_type>::quiet_NaN();
+
+    CELER_ENSURE(result.distance <= step);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE MEMBER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Find a substep whose chord is close to the path.
+ *
+ * The trial substep is shortened until the midpoint of the path is within
+ * \c delta_chord of the chord and the integration error is within
+ * \c epsilon_step . The sagitta scales with the square of the substep length
+ * and the relative error of a fourth-order integrator with its fourth power,
+ * which gives the length to try next.
+ */
+template<class StepperT, class GTV>
+CELER_FUNCTION auto
+FieldPropagator<StepperT, GTV>::find_substep(real_type       trial,
+                                             const OdeState& beg) const
+    -> Substep
+{
+    CELER_EXPECT(trial > 0);
+
+    constexpr real_type safety_factor = 0.9;
+    constexpr real_type max_grow      = 5;
+    constexpr real_type max_shrink    = 0.1;
+
+    Substep result;
+    result.step = trial;
+    for (;;)
+    {
+        result.result = stepper_(result.step, beg);
+
+        const real_type sagitta
+            = detail::calc_distance_to_chord(beg.pos,
+                                             result.result.end_state.pos,
+                                             result.result.mid_state.pos);
+        const real_type error = celeritas::max(
+            norm(result.result.err_state.pos) / result.step,
+            norm(result.result.err_state.mom) / momentum_);
+
+        // Ratio of the substep that would just satisfy the tolerances
+        real_type scale = max_grow;
+        if (sagitta > 0)
+        {
+            scale = celeritas::min<real_type>(
+                scale, std::sqrt(options_.delta_chord / sagitta));
+        }
+        if (error > 0)
+        {
+            scale = celeritas::min<real_type>(
+                scale, std::sqrt(std::sqrt(options_.epsilon_step / error)));
+        }
+
+        if ((sagitta <= options_.delta_chord
+             && error <= options_.epsilon_step)
+            || result.step <= options_.minimum_step)
+        {
+            result.next_trial = result.step * safety_factor * scale;
+            break;
+        }
+
+        result.step = celeritas::max(
+            result.step
+                * celeritas::max(safety_factor * scale, max_shrink),
+            options_.minimum_step);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,58 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file HelixStepper.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "physics/base/Units.hh"
+#include "FieldInterface.hh"
+#include "UniformField.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Move a charged particle along an exact helix in a uniform field.
+ *
+ * This is the fast path for uniform fields: it has the same interface as
+ * \c RungeKuttaStepper but evaluates the analytic solution of the equation
+ * of motion, so there is no integration error and each substep is limited
+ * only by how far the helix deviates from its chord.
+ *
+ * The direction rotates about the field axis by an angle equal to the path
+ * length times the signed curvature \f$ k = q c B / p \f$ :
+ * \f[
+   \hat{u}(s) = \hat{u}_\parallel + \hat{u}_\perp \cos k s
+              + (\hat{u}_\perp \times \hat{b}) \sin k s
+ * \f]
+ * and the position is its integral.
+ */
+class HelixStepper
+{
+  public:
+    // Construct with a uniform field and the particle charge
+    inline CELER_FUNCTION HelixStepper(const UniformField&     field,
+                                       units::ElementaryCharge charge);
+
+    // Move along the helix
+    inline CELER_FUNCTION StepperResult operator()(real_type       step,
+                                                   const OdeState& beg) const;
+
+  private:
+    Real3     field_dir_; //!< Unit vector along the field
+    real_type coeff_;     //!< Curvature times momentum [1/len * MeV/c]
+
+    // Move along the helix by a path length
+    inline CELER_FUNCTION OdeState move(real_type       step,
+                                        const OdeState& beg) const;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "HelixStepper.i.hh"
@@ -0,0 +1,107 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file HelixStepper.i.hh
+//---------------------------------------------------------------------------//
+#include <cmath>
+#include "base/ArrayUtils.hh"
+#include "base/Assert.hh"
+#include "detail/FieldUtils.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with a uniform field and the particle charge.
+ */
+CELER_FUNCTION HelixStepper::HelixStepper(const UniformField&     field,
+                                          units::ElementaryCharge charge)
+    : field_dir_{0, 0, 0}, coeff_(0)
+{
+    CELER_EXPECT(charge.value() != 0);
+
+    const real_type field_mag = norm(field.value());
+    if (field_mag > 0)
+    {
+        for (int ax = 0; ax < 3; ++ax)
+        {
+            field_dir_[ax] = field.value()[ax] / field_mag;
+        }
+        coeff_ = detail::calc_lorentz_coeff(charge) * field_mag;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Move along the helix.
+ *
+ * The error estimate is zero since the solution is exact.
+ */
+CELER_FUNCTION StepperResult HelixStepper::operator()(real_type       step,
+                                                      const OdeState& beg) const
+{
+    CELER_EXPECT(step > 0);
+
+    StepperResult result;
+    result.mid_state = this->move(step / 2, beg);
+    result.end_state = this->move(step, beg);
+    result.err_state = {{0, 0, 0}, {0, 0, 0}};
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Move along the helix by a path length.
+ *
+ * The one-minus-cosine term is evaluated with a half-angle sine to avoid
+ * cancellation for short steps.
+ */
+CELER_FUNCTION OdeState HelixStepper::move(real_type       step,
+                                           const OdeState& beg) const
+{
+    const real_type mom = norm(beg.mom);
+    Real3           dir;
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        dir[ax] = beg.mom[ax] / mom;
+    }
+
+    OdeState result = beg;
+    if (coeff_ == 0)
+    {
+        // No field: straight line
+        axpy(step, dir, &result.pos);
+        return result;
+    }
+
+    // Decompose the direction along and perpendicular to the field
+    const real_type cos_par = dot_product(dir, field_dir_);
+    Real3           dir_perp = dir;
+    axpy(-cos_par, field_dir_, &dir_perp);
+    const Real3 dir_normal = cross_product(dir_perp, field_dir_);
+
+    const real_type curvature     = coeff_ / mom;
+    const real_type angle         = curvature * step;
+    const real_type sin_angle     = std::sin(angle);
+    const real_type half_sin      = std::sin(angle / 2);
+    const real_type one_minus_cos = 2 * half_sin * half_sin;
+    const real_type cos_angle     = 1 - one_minus_cos;
+
+    axpy(step * cos_par, field_dir_, &result.pos);
+    axpy(sin_angle / curvature, dir_perp, &result.pos);
+    axpy(one_minus_cos / curvature, dir_normal, &result.pos);
+
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        result.mom[ax] = mom
+                         * (cos_par * field_dir_[ax]
+                            + cos_angle * dir_perp[ax]
+                            + sin_angle * dir_normal[ax]);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
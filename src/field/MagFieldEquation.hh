@@ -0,0 +1,45 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file MagFieldEquation.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "physics/base/Units.hh"
+#include "FieldInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Equation of motion of a charged particle in a magnetic field.
+ *
+ * The independent variable is the path length, so the result is the
+ * derivative of the position (the direction) and of the momentum (the
+ * Lorentz force divided by the speed). The field type must be a functor that
+ * returns the field at a position, e.g. \c UniformField or \c FieldMapView .
+ */
+template<class FieldT>
+class MagFieldEquation
+{
+  public:
+    // Construct with a field and the particle charge
+    inline CELER_FUNCTION
+    MagFieldEquation(const FieldT& field, units::ElementaryCharge charge);
+
+    // Evaluate the derivative of the state along the path
+    inline CELER_FUNCTION OdeState operator()(const OdeState& y) const;
+
+  private:
+    FieldT    field_;
+    real_type coeff_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "MagFieldEquation.i.hh"
@@ -0,0 +1,51 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file MagFieldEquation.i.hh
+//---------------------------------------------------------------------------//
+#include "base/ArrayUtils.hh"
+#include "base/Assert.hh"
+#include "detail/FieldUtils.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with a field and the particle charge.
+ */
+template<class FieldT>
+CELER_FUNCTION
+MagFieldEquation<FieldT>::MagFieldEquation(const FieldT&           field,
+                                           units::ElementaryCharge charge)
+    : field_(field), coeff_(detail::calc_lorentz_coeff(charge))
+{
+    CELER_EXPECT(charge.value() != 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Evaluate the derivative of the state along the path.
+ */
+template<class FieldT>
+CELER_FUNCTION OdeState
+MagFieldEquation<FieldT>::operator()(const OdeState& y) const
+{
+    const real_type inv_mom = 1 / norm(y.mom);
+
+    OdeState result;
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        result.pos[ax] = inv_mom * y.mom[ax];
+    }
+    result.mom = cross_product(result.pos, field_(y.pos));
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        result.mom[ax] *= coeff_;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,55 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RungeKuttaStepper.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "FieldInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Integrate the equation of motion with the classical fourth-order
+ * Runge-Kutta method.
+ *
+ * \code
+    MagFieldEquation<FieldMapView> equation(field, charge);
+    RungeKuttaStepper<MagFieldEquation<FieldMapView>> integrate(equation);
+    StepperResult result = integrate(step, state);
+   \endcode
+ *
+ * The error is estimated by step doubling: the substep is integrated once in
+ * full and once as two halves, which also provides the midpoint. The result
+ * is the more accurate two-half solution with a Richardson extrapolation
+ * correction, as in Geant4's \c G4MagErrorStepper .
+ */
+template<class EquationT>
+class RungeKuttaStepper
+{
+  public:
+    // Construct with the equation of motion
+    explicit inline CELER_FUNCTION RungeKuttaStepper(const EquationT& eq);
+
+    // Integrate over a path length
+    inline CELER_FUNCTION StepperResult operator()(real_type       step,
+                                                   const OdeState& beg) const;
+
+  private:
+    EquationT equation_;
+
+    // Calculate the increment of a single fourth-order step
+    inline CELER_FUNCTION OdeState rk4(real_type       step,
+                                       const OdeState& beg,
+                                       const OdeState& dydx) const;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "RungeKuttaStepper.i.hh"
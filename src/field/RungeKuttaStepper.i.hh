@@ -0,0 +1,88 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RungeKuttaStepper.i.hh
+//---------------------------------------------------------------------------//
+#include "base/Assert.hh"
+#include "detail/FieldUtils.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the equation of motion.
+ */
+template<class EquationT>
+CELER_FUNCTION
+RungeKuttaStepper<EquationT>::RungeKuttaStepper(const EquationT& eq)
+    : equation_(eq)
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Integrate over a path length.
+ *
+ * The solutions are compared as increments from the starting state so that
+ * the error estimate isn't dominated by roundoff in the position.
+ */
+template<class EquationT>
+CELER_FUNCTION StepperResult
+RungeKuttaStepper<EquationT>::operator()(real_type       step,
+                                         const OdeState& beg) const
+{
+    CELER_EXPECT(step > 0);
+    using detail::ode_axpy;
+
+    const real_type half_step = step / 2;
+    const OdeState  dydx      = equation_(beg);
+
+    // Integrate the first half, the second half, and the full step
+    const OdeState first_half = this->rk4(half_step, beg, dydx);
+    StepperResult  result;
+    result.mid_state = ode_axpy(1, first_half, beg);
+    OdeState two_half
+        = this->rk4(half_step, result.mid_state, equation_(result.mid_state));
+    two_half = ode_axpy(1, first_half, two_half);
+
+    // Difference between the two-half and full-step solutions
+    result.err_state = ode_axpy(-1, this->rk4(step, beg, dydx), two_half);
+
+    // Fourth-order method: the two-half solution's error is 1/15 of the
+    // difference
+    two_half         = ode_axpy(real_type(1) / 15, result.err_state, two_half);
+    result.end_state = ode_axpy(1, two_half, beg);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the increment of a single fourth-order step.
+ */
+template<class EquationT>
+CELER_FUNCTION OdeState
+RungeKuttaStepper<EquationT>::rk4(real_type       step,
+                                  const OdeState& beg,
+                                  const OdeState& dydx) const
+{
+    using detail::ode_axpy;
+
+    const real_type half_step = step / 2;
+
+    OdeState k2 = equation_(ode_axpy(half_step, dydx, beg));
+    OdeState k3 = equation_(ode_axpy(half_step, k2, beg));
+    OdeState k4 = equation_(ode_axpy(step, k3, beg));
+
+    // h/6 (k1 + 2 k2 + 2 k3 + k4)
+    const OdeState zero   = {{0, 0, 0}, {0, 0, 0}};
+    OdeState       result = ode_axpy(step / 6, dydx, zero);
+    result                = ode_axpy(step / 3, k2, result);
+    result                = ode_axpy(step / 3, k3, result);
+    result                = ode_axpy(step / 6, k4, result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,44 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file UniformField.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * A magnetic field that is the same everywhere.
+ *
+ * The field value is in native units (see \c units::tesla ). Tracks in a
+ * uniform field can be propagated exactly with the \c HelixStepper .
+ */
+class UniformField
+{
+  public:
+    //! Construct with a field vector
+    explicit CELER_FUNCTION UniformField(const Real3& value) : value_(value)
+    {
+    }
+
+    //! Field at a point
+    CELER_FUNCTION const Real3& operator()(const Real3&) const
+    {
+        return value_;
+    }
+
+    //! Field value
+    CELER_FUNCTION const Real3& value() const { return value_; }
+
+  private:
+    Real3 value_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,94 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file FieldUtils.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+#include "base/ArrayUtils.hh"
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "physics/base/Units.hh"
+#include "../FieldInterface.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate y + a * x for the position and momentum of an ODE state.
+ */
+inline CELER_FUNCTION OdeState ode_axpy(real_type       a,
+                                        const OdeState& x,
+                                        const OdeState& y)
+{
+    OdeState result;
+    for (int i = 0; i < 3; ++i)
+    {
+        result.pos[i] = y.pos[i] + a * x.pos[i];
+        result.mom[i] = y.mom[i] + a * x.mom[i];
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Coefficient of the Lorentz force for momentum in MeV / c.
+ *
+ * The rate of change of the momentum (in MeV / c) along the path is this
+ * coefficient times the cross product of the direction and the field (in
+ * native units).
+ */
+inline CELER_FUNCTION real_type
+calc_lorentz_coeff(units::ElementaryCharge charge)
+{
+    return charge.value()
+           * (units::EElectron::value() * units::CLight::value()
+              / units::Mev::value());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Distance from a point to the line through the ends of a chord.
+ *
+ * This is the sagitta when the point is the middle of the curved path.
+ */
+inline CELER_FUNCTION real_type calc_distance_to_chord(const Real3& beg,
+                                                       const Real3& end,
+                                                       const Real3& point)
+{
+    Real3 chord;
+    Real3 delta;
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        chord[ax] = end[ax] - beg[ax];
+        delta[ax] = point[ax] - beg[ax];
+    }
+    const real_type chord_sq = dot_product(chord, chord);
+    if (chord_sq == 0)
+    {
+        return norm(delta);
+    }
+    const real_type proj = dot_product(delta, chord) / chord_sq;
+    axpy(-proj, chord, &delta);
+    return norm(delta);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Distance between two points.
+ */
+inline CELER_FUNCTION real_type calc_distance(const Real3& a, const Real3& b)
+{
+    Real3 delta = b;
+    axpy(real_type(-1), a, &delta);
+    return norm(delta);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
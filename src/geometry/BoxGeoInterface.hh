@@ -0,0 +1,183 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BoxGeoInterface.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Array.hh"
+#include "base/Collection.hh"
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "Types.hh"
+
+#ifndef __CUDA_ARCH__
+#    include "base/CollectionBuilder.hh"
+#endif
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+// TYPES
+//---------------------------------------------------------------------------//
+struct BoxDef;
+struct BoxBvhNode;
+
+//! Index of a placed box in the flattened geometry hierarchy
+using BoxId = ItemId<BoxDef>;
+
+//! Index of a node in a bounding volume hierarchy
+using BoxBvhNodeId = ItemId<BoxBvhNode>;
+
+//---------------------------------------------------------------------------//
+// PARAMS
+//---------------------------------------------------------------------------//
+/*!
+ * A placed axis-aligned box with its bounds in global coordinates.
+ *
+ * Every placement of a volume is a separate box, so nested placements are
+ * flattened into a tree rooted at the world box (\c BoxId{0}). The daughters
+ * of each box are stored in a bounding volume hierarchy whose root is \c bvh
+ * (which is null if the box has no daughters).
+ */
+struct BoxDef
+{
+    Real3        lower;  //!< Lower corner [cm]
+    Real3        upper;  //!< Upper corner [cm]
+    VolumeId     volume; //!< Volume ID reported by the track view
+    BoxId        parent; //!< Enclosing box (null for the world)
+    BoxBvhNodeId bvh;    //!< Root of the daughter hierarchy
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Node in a bounding volume hierarchy of daughter boxes.
+ *
+ * Leaf nodes reference a single daughter box; interior nodes reference two
+ * child nodes. The bounds enclose all the boxes below the node.
+ */
+struct BoxBvhNode
+{
+    Real3        lower; //!< Lower corner of the bounding box [cm]
+    Real3        upper; //!< Upper corner of the bounding box [cm]
+    BoxBvhNodeId left;  //!< First child (interior only)
+    BoxBvhNodeId right; //!< Second child (interior only)
+    BoxId        box;   //!< Daughter box (leaf only)
+
+    //! Whether this is a leaf node
+    CELER_FUNCTION bool is_leaf() const { return static_cast<bool>(box); }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Persistent data for the native axis-aligned box geometry.
+ *
+ * \sa BoxGeoParams (owns the pointed-to data)
+ * \sa BoxGeoTrackView (uses the pointed-to data in a kernel)
+ */
+template<Ownership W, MemSpace M>
+struct BoxGeoParamsData
+{
+    template<class T>
+    using Items = celeritas::Collection<T, W, M>;
+
+    Items<BoxDef>     boxes;
+    Items<BoxBvhNode> bvh_nodes;
+
+    //! Maximum number of BVH nodes that can be pending during traversal
+    static CELER_CONSTEXPR_FUNCTION size_type max_bvh_stack() { return 64; }
+
+    //// MEMBER FUNCTIONS ////
+
+    //! Whether the data is assigned
+    explicit CELER_FUNCTION operator bool() const { return !boxes.empty(); }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    BoxGeoParamsData& operator=(const BoxGeoParamsData<W2, M2>& other)
+    {
+        CELER_EXPECT(other);
+        boxes     = other.boxes;
+        bvh_nodes = other.bvh_nodes;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// STATE
+//---------------------------------------------------------------------------//
+/*!
+ * Data required to initialize a box geometry state.
+ */
+struct BoxGeoStateInitializer
+{
+    Real3 pos;
+    Real3 dir;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Geometry state of a single track in the box geometry.
+ *
+ * The box is null if the track is outside the world.
+ */
+struct BoxGeoTrackState
+{
+    Real3     pos;
+    Real3     dir;
+    BoxId     box;
+    BoxId     next_box;
+    real_type next_step;
+    real_type safety;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Geometry states for multiple tracks.
+ *
+ * \sa BoxGeoTrackView (uses the pointed-to data in a kernel)
+ */
+template<Ownership W, MemSpace M>
+struct BoxGeoStateData
+{
+    template<class T>
+    using Items = celeritas::StateCollection<T, W, M>;
+
+    Items<BoxGeoTrackState> state;
+
+    //! Whether the interface is assigned
+    explicit CELER_FUNCTION operator bool() const { return !state.empty(); }
+
+    //! State size
+    CELER_FUNCTION size_type size() const { return state.size(); }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    BoxGeoStateData& operator=(BoxGeoStateData<W2, M2>& other)
+    {
+        CELER_EXPECT(other);
+        state = other.state;
+        return *this;
+    }
+};
+
+#ifndef __CUDA_ARCH__
+//---------------------------------------------------------------------------//
+/*!
+ * Resize a box geometry state in host code.
+ */
+template<MemSpace M>
+inline void
+resize(BoxGeoStateData<Ownership::value, M>* data,
+       const BoxGeoParamsData<Ownership::const_reference, MemSpace::host>&,
+       size_type size)
+{
+    CELER_EXPECT(size > 0);
+    make_builder(&data->state).resize(size);
+}
+#endif
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
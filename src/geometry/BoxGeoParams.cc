@@ -0,0 +1,277 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BoxGeoParams.cc
+//---------------------------------------------------------------------------//
+#include "BoxGeoParams.hh"
+
+#include <algorithm>
+#include "base/Assert.hh"
+#include "base/CollectionBuilder.hh"
+#include "base/Range.hh"
+#include "comm/Logger.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// HELPER CLASSES
+//---------------------------------------------------------------------------//
+/*!
+ * Build a bounding volume hierarchy over the daughters of a box.
+ *
+ * The boxes are recursively split at the median of their centers along the
+ * axis with the largest extent, so the tree is balanced and its depth is
+ * logarithmic in the number of daughters.
+ */
+class BvhBuilder
+{
+  public:
+    using VecBox  = std::vector<BoxDef>;
+    using VecNode = std::vector<BoxBvhNode>;
+    using VecId   = std::vector<BoxId>;
+
+    BvhBuilder(const VecBox& boxes, VecNode* nodes)
+        : boxes_(boxes), nodes_(*nodes)
+    {
+    }
+
+    // Build the hierarchy and return the root node
+    BoxBvhNodeId operator()(VecId daughters)
+    {
+        CELER_EXPECT(!daughters.empty());
+        return this->build(daughters.begin(), daughters.end(), 1);
+    }
+
+    //! Maximum depth of any node built so far
+    size_type max_depth() const { return max_depth_; }
+
+  private:
+    const VecBox& boxes_;
+    VecNode&      nodes_;
+    size_type     max_depth_ = 0;
+
+    BoxBvhNodeId
+    build(VecId::iterator first, VecId::iterator last, size_type depth)
+    {
+        max_depth_ = std::max(max_depth_, depth);
+
+        // Calculate the bounds of all the boxes
+        BoxBvhNode node;
+        node.lower = boxes_[first->get()].lower;
+        node.upper = boxes_[first->get()].upper;
+        for (auto iter = first + 1; iter != last; ++iter)
+        {
+            const BoxDef& box = boxes_[iter->get()];
+            for (int ax = 0; ax < 3; ++ax)
+            {
+                node.lower[ax] = std::min(node.lower[ax], box.lower[ax]);
+                node.upper[ax] = std::max(node.upper[ax], box.upper[ax]);
+            }
+        }
+
+        BoxBvhNodeId result(nodes_.size());
+        nodes_.push_back(node);
+        if (last - first == 1)
+        {
+            nodes_[result.get()].box = *first;
+            return result;
+        }
+
+        // Split along the longest axis at the median box center
+        int split_ax = 0;
+        for (int ax = 1; ax < 3; ++ax)
+        {
+            if (node.upper[ax] - node.lower[ax]
+                > node.upper[split_ax] - node.lower[split_ax])
+            {
+                split_ax = ax;
+            }
+        }
+        auto mid = first + (last - first) / 2;
+        std::nth_element(
+            first, mid, last, [this, split_ax](BoxId lhs, BoxId rhs) {
+                const BoxDef& l = boxes_[lhs.get()];
+                const BoxDef& r = boxes_[rhs.get()];
+                return l.lower[split_ax] + l.upper[split_ax]
+                       < r.lower[split_ax] + r.upper[split_ax];
+            });
+
+        BoxBvhNodeId left  = this->build(first, mid, depth + 1);
+        BoxBvhNodeId right = this->build(mid, last, depth + 1);
+        nodes_[result.get()].left  = left;
+        nodes_[result.get()].right = right;
+        return result;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+//! Whether the first box is inside or on the surface of the second
+bool is_enclosed(const BoxDef& inner, const BoxDef& outer)
+{
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        if (inner.lower[ax] < outer.lower[ax]
+            || inner.upper[ax] > outer.upper[ax])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+//! Whether the interiors of two boxes intersect
+bool is_overlapping(const BoxDef& a, const BoxDef& b)
+{
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        if (a.upper[ax] <= b.lower[ax] || b.upper[ax] <= a.lower[ax])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from box placements.
+ */
+BoxGeoParams::BoxGeoParams(const Input& inp) : labels_(inp.volume_labels)
+{
+    CELER_EXPECT(!inp.boxes.empty());
+    CELER_VALIDATE(!inp.boxes.front().parent,
+                   "The first (world) box cannot have a parent");
+
+    for (auto vol_id : range(VolumeId(labels_.size())))
+    {
+        label_to_id_.insert({labels_[vol_id.get()], vol_id});
+    }
+
+    // Convert and validate box placements
+    std::vector<BoxDef>             boxes;
+    std::vector<std::vector<BoxId>> daughters(inp.boxes.size());
+    std::vector<size_type>          depth(inp.boxes.size(), 1);
+    for (auto box_id : range(BoxId(inp.boxes.size())))
+    {
+        const BoxInput& box_inp = inp.boxes[box_id.get()];
+        CELER_VALIDATE(box_inp.volume < labels_.size(),
+                       "Box " << box_id.get() << " has invalid volume ID");
+
+        BoxDef box;
+        box.lower  = box_inp.lower;
+        box.upper  = box_inp.upper;
+        box.volume = box_inp.volume;
+        box.parent = box_inp.parent;
+        for (int ax = 0; ax < 3; ++ax)
+        {
+            CELER_VALIDATE(box.lower[ax] < box.upper[ax],
+                           "Box " << box_id.get() << " ('"
+                                  << labels_[box.volume.get()]
+                                  << "') has nonpositive extent");
+        }
+
+        if (box_id != BoxId{0})
+        {
+            CELER_VALIDATE(box.parent < box_id,
+                           "Box " << box_id.get()
+                                  << " must be listed after its parent");
+            CELER_VALIDATE(is_enclosed(box, boxes[box.parent.get()]),
+                           "Box " << box_id.get() << " ('"
+                                  << labels_[box.volume.get()]
+                                  << "') extends outside its parent");
+            daughters[box.parent.get()].push_back(box_id);
+            depth[box_id.get()] = depth[box.parent.get()] + 1;
+            max_depth_ = std::max<int>(max_depth_, depth[box_id.get()]);
+        }
+        boxes.push_back(box);
+    }
+    max_depth_ = std::max<int>(max_depth_, 1);
+
+    // Check for overlapping siblings by sweeping along x
+    for (auto& siblings : daughters)
+    {
+        std::vector<BoxId> sorted = siblings;
+        std::sort(
+            sorted.begin(), sorted.end(), [&boxes](BoxId lhs, BoxId rhs) {
+                return boxes[lhs.get()].lower[0] < boxes[rhs.get()].lower[0];
+            });
+        for (auto i : range(sorted.size()))
+        {
+            const BoxDef& box = boxes[sorted[i].get()];
+            for (auto j = i + 1; j < sorted.size()
+                                 && boxes[sorted[j].get()].lower[0]
+                                        < box.upper[0];
+                 ++j)
+            {
+                CELER_VALIDATE(!is_overlapping(box, boxes[sorted[j].get()]),
+                               "Boxes " << sorted[i].get() << " and "
+                                        << sorted[j].get() << " overlap");
+            }
+        }
+    }
+
+    // Build the daughter hierarchy for each box
+    std::vector<BoxBvhNode> nodes;
+    BvhBuilder              build_bvh(boxes, &nodes);
+    for (auto i : range(boxes.size()))
+    {
+        if (!daughters[i].empty())
+        {
+            boxes[i].bvh = build_bvh(std::move(daughters[i]));
+        }
+    }
+    CELER_ASSERT(build_bvh.max_depth() <= HostRef::max_bvh_stack());
+    CELER_LOG(debug) << "Built box geometry with " << boxes.size()
+                     << " placements, " << nodes.size()
+                     << " hierarchy nodes, and a maximum depth of "
+                     << max_depth_;
+
+    // Move to mirrored data, copying to device
+    BoxGeoParamsData<Ownership::value, MemSpace::host> host_data;
+    make_builder(&host_data.boxes).insert_back(boxes.begin(), boxes.end());
+    make_builder(&host_data.bvh_nodes).insert_back(nodes.begin(), nodes.end());
+    data_ = CollectionMirror<BoxGeoParamsData>{std::move(host_data)};
+
+    CELER_ENSURE(data_);
+    CELER_ENSURE(this->num_boxes() == inp.boxes.size());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the label for a volume ID.
+ */
+const std::string& BoxGeoParams::id_to_label(VolumeId vol_id) const
+{
+    CELER_EXPECT(vol_id < labels_.size());
+    return labels_[vol_id.get()];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the ID corresponding to a label.
+ *
+ * If multiple volumes share a label, the first one is returned. A null ID is
+ * returned if the label is not found.
+ */
+VolumeId BoxGeoParams::label_to_id(const std::string& label) const
+{
+    auto iter = label_to_id_.find(label);
+    if (iter == label_to_id_.end())
+    {
+        return {};
+    }
+    return iter->second;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,99 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BoxGeoParams.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "base/CollectionMirror.hh"
+#include "base/Types.hh"
+#include "BoxGeoInterface.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Shared parameters for a native geometry of nested axis-aligned boxes.
+ *
+ * This is an alternative to the VecGeom-based \c GeoParams for shielding and
+ * calorimeter problems made of unrotated boxes and slabs. It needs no
+ * external navigator and no virtual dispatch: each box stores its global
+ * bounds and its daughters are found with a bounding volume hierarchy. The
+ * geometry backend is chosen at setup time by constructing this class and
+ * using \c BoxGeoTrackView in place of \c GeoTrackView .
+ *
+ * The input boxes are placements: the first box is the world, and each
+ * subsequent box must lie inside its parent and must not overlap its
+ * siblings. Multiple placements can share a volume ID.
+ */
+class BoxGeoParams
+{
+  public:
+    //!@{
+    //! References to constructed data
+    using HostRef
+        = BoxGeoParamsData<Ownership::const_reference, MemSpace::host>;
+    using DeviceRef
+        = BoxGeoParamsData<Ownership::const_reference, MemSpace::device>;
+    //!@}
+
+    //! A placed box in global coordinates
+    struct BoxInput
+    {
+        VolumeId volume; //!< Volume ID of this placement
+        Real3    lower;  //!< Lower corner [cm]
+        Real3    upper;  //!< Upper corner [cm]
+        BoxId    parent; //!< Index of the enclosing box (null for world)
+    };
+
+    //! Input data to construct this class
+    struct Input
+    {
+        std::vector<std::string> volume_labels; //!< Indexed by VolumeId
+        std::vector<BoxInput>    boxes;         //!< World first
+    };
+
+  public:
+    // Construct from box placements
+    explicit BoxGeoParams(const Input& inp);
+
+    //// HOST ACCESSORS ////
+
+    // Get the label for a volume ID
+    const std::string& id_to_label(VolumeId vol_id) const;
+
+    // Get the ID corresponding to a label
+    VolumeId label_to_id(const std::string& label) const;
+
+    //! Number of volumes
+    size_type num_volumes() const { return labels_.size(); }
+
+    //! Number of placed boxes
+    size_type num_boxes() const { return this->host_pointers().boxes.size(); }
+
+    //! Maximum nested geometry depth
+    int max_depth() const { return max_depth_; }
+
+    //! Access geometry data on the host
+    const HostRef& host_pointers() const { return data_.host(); }
+
+    //! Access geometry data on the device
+    const DeviceRef& device_pointers() const { return data_.device(); }
+
+  private:
+    std::vector<std::string>                  labels_;
+    std::unordered_map<std::string, VolumeId> label_to_id_;
+    int                                       max_depth_ = 0;
+
+    // Host/device storage and reference
+    CollectionMirror<BoxGeoParamsData> data_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,133 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BoxGeoTrackView.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "BoxGeoInterface.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Navigate a track through the native box geometry.
+ *
+ * This has the same interface as the VecGeom-based \c GeoTrackView so that
+ * transport code can be templated on the geometry track view.
+ *
+ * \code
+    BoxGeoTrackView geom(box_params_ref, box_state_ref, thread_id);
+   \endcode
+ *
+ * Boundary crossings use branch-light slab intersections against the
+ * current box and a bounding volume hierarchy of its daughters. The volume on
+ * the other side of a boundary is determined when the step is found, so
+ * moving to the next volume never requires a search.
+ */
+class BoxGeoTrackView
+{
+  public:
+    //!@{
+    //! Type aliases
+    using ParamsRef
+        = BoxGeoParamsData<Ownership::const_reference, MemSpace::native>;
+    using StateRef = BoxGeoStateData<Ownership::reference, MemSpace::native>;
+    using Initializer_t = BoxGeoStateInitializer;
+    //!@}
+
+    //! Helper struct for initializing from an existing geometry state
+    struct DetailedInitializer
+    {
+        BoxGeoTrackView& other; //!< Existing geometry
+        Real3            dir;   //!< New direction
+    };
+
+    //! Result of propagating a proposed step
+    struct Propagation
+    {
+        real_type distance;   //!< Distance moved
+        bool      boundary;   //!< Whether the track moved to a new volume
+        bool      safety_hit; //!< Whether the boundary search was skipped
+    };
+
+  public:
+    // Construct from persistent and state data
+    inline CELER_FUNCTION BoxGeoTrackView(const ParamsRef& params,
+                                          const StateRef&  states,
+                                          ThreadId         thread);
+
+    // Initialize the state
+    inline CELER_FUNCTION BoxGeoTrackView& operator=(const Initializer_t& init);
+    // Initialize the state from a parent state and new direction
+    inline CELER_FUNCTION BoxGeoTrackView&
+                          operator=(const DetailedInitializer& init);
+    // Find the distance to the next boundary
+    inline CELER_FUNCTION void find_next_step();
+    // Find the isotropic distance to the nearest boundary
+    inline CELER_FUNCTION real_type find_safety();
+    // Move up to the given distance, stopping at the next boundary
+    inline CELER_FUNCTION Propagation propagate(real_type step);
+    // Move to the next boundary
+    inline CELER_FUNCTION void move_next_step();
+
+    // Update current volume, called whenever move reaches boundary
+    inline CELER_FUNCTION void move_next_volume();
+
+    // Move a distance that may cross boundaries, and find the new volume
+    inline CELER_FUNCTION void move_and_relocate(real_type step);
+
+    //!@{
+    //! State accessors
+    CELER_FUNCTION const Real3& pos() const { return state_.pos; }
+    CELER_FUNCTION const Real3& dir() const { return state_.dir; }
+    CELER_FUNCTION real_type    next_step() const { return state_.next_step; }
+    CELER_FUNCTION real_type    safety() const { return state_.safety; }
+    //!@}
+
+    //!@{
+    //! State modifiers via non-const references
+    CELER_FUNCTION Real3& pos() { return state_.pos; }
+    CELER_FUNCTION Real3& dir() { return state_.dir; }
+    CELER_FUNCTION real_type& next_step() { return state_.next_step; }
+    CELER_FUNCTION real_type& safety() { return state_.safety; }
+    //!@}
+
+    // Get the volume ID in the current cell
+    inline CELER_FUNCTION VolumeId volume_id() const;
+
+    //! Whether the track is inside or outside the valid geometry region
+    CELER_FUNCTION bool is_outside() const { return !state_.box; }
+
+    //! A tiny push to make sure tracks do not get stuck at boundaries
+    static CELER_CONSTEXPR_FUNCTION real_type extra_push() { return 1e-13; }
+
+  private:
+    //! Shared/persistent geometry data
+    const ParamsRef& params_;
+
+    //! Referenced thread-local data
+    BoxGeoTrackState& state_;
+
+    //// HELPER FUNCTIONS ////
+
+    // Find the innermost box containing a point, searching from a box
+    inline CELER_FUNCTION BoxId locate(BoxId start, const Real3& pos) const;
+
+    // Find the daughter of a box that contains a point
+    inline CELER_FUNCTION BoxId find_daughter(const BoxDef& box,
+                                              const Real3&  pos) const;
+
+    // Calculate the isotropic distance to the current box's boundaries
+    inline CELER_FUNCTION real_type calc_safety() const;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "BoxGeoTrackView.i.hh"
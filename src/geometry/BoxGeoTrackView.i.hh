@@ -0,0 +1,342 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BoxGeoTrackView.i.hh
+//---------------------------------------------------------------------------//
+#include "base/Algorithms.hh"
+#include "base/Array.hh"
+#include "base/ArrayUtils.hh"
+#include "base/Assert.hh"
+#include "base/MiniStack.hh"
+#include "base/NumericLimits.hh"
+#include "detail/BoxUtils.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from persistent and state data.
+ */
+CELER_FUNCTION
+BoxGeoTrackView::BoxGeoTrackView(const ParamsRef& params,
+                                 const StateRef&  states,
+                                 ThreadId         thread)
+    : params_(params), state_(states.state[thread])
+{
+    CELER_EXPECT(params_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct the state by locating a point from the world volume.
+ */
+CELER_FUNCTION BoxGeoTrackView&
+BoxGeoTrackView::operator=(const Initializer_t& init)
+{
+    state_.pos       = init.pos;
+    state_.dir       = init.dir;
+    state_.box       = this->locate(BoxId{0}, init.pos);
+    state_.next_box  = {};
+    state_.next_step = numeric_limits<real_type>::quiet_NaN();
+    state_.safety    = 0;
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct the state from a direction and a copy of the parent state.
+ */
+CELER_FUNCTION BoxGeoTrackView&
+BoxGeoTrackView::operator=(const DetailedInitializer& init)
+{
+    if (this != &init.other)
+    {
+        state_.pos    = init.other.state_.pos;
+        state_.box    = init.other.state_.box;
+        state_.safety = init.other.state_.safety;
+    }
+    state_.dir       = init.dir;
+    state_.next_box  = {};
+    state_.next_step = numeric_limits<real_type>::quiet_NaN();
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the distance to the next geometric boundary.
+ *
+ * The candidates are the exit from the current box and the entry into any of
+ * its daughters; subtrees of the daughter hierarchy that can't be reached
+ * before the closest candidate so far are skipped. If the track leaves the
+ * current box, the next volume is located just past the exit point.
+ */
+CELER_FUNCTION void BoxGeoTrackView::find_next_step()
+{
+    CELER_EXPECT(!this->is_outside());
+
+    const BoxDef&   box     = params_.boxes[state_.box];
+    const Real3     inv_dir = detail::calc_inv_dir(state_.dir);
+    const real_type bump    = detail::calc_bump(state_.pos);
+
+    real_type distance
+        = detail::calc_box_exit(box.lower, box.upper, state_.pos, inv_dir);
+    BoxId next_box;
+    if (box.bvh)
+    {
+        Array<BoxBvhNodeId, ParamsRef::max_bvh_stack()> storage;
+        MiniStack<BoxBvhNodeId> stack(make_span(storage));
+        stack.push(box.bvh);
+        while (!stack.empty())
+        {
+            const BoxBvhNode& node = params_.bvh_nodes[stack.pop()];
+            real_type         entry = detail::calc_box_entry(
+                node.lower, node.upper, state_.pos, inv_dir, bump);
+            if (!(entry < distance))
+            {
+                continue;
+            }
+            if (node.is_leaf())
+            {
+                distance = entry;
+                next_box = node.box;
+            }
+            else
+            {
+                stack.push(node.right);
+                stack.push(node.left);
+            }
+        }
+    }
+
+    if (!next_box)
+    {
+        // Exiting the current box: find the volume just past the boundary
+        Real3 bumped = state_.pos;
+        axpy(distance + bump, state_.dir, &bumped);
+        next_box = this->locate(box.parent, bumped);
+    }
+
+    state_.next_step = distance;
+    state_.next_box  = next_box;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the isotropic distance to the nearest boundary.
+ *
+ * The result is cached so that subsequent steps shorter than the safety can
+ * skip the boundary calculation.
+ */
+CELER_FUNCTION real_type BoxGeoTrackView::find_safety()
+{
+    CELER_EXPECT(!this->is_outside());
+    state_.safety = this->calc_safety();
+    return state_.safety;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Move up to the given distance, stopping at the next boundary.
+ *
+ * If the proposed step is within the cached safety distance, the track is
+ * moved without navigating and the safety is decremented. Otherwise the
+ * distance to the next boundary (and a new safety) is calculated: if the
+ * boundary is closer than the proposed step, the track is moved to the
+ * boundary and into the next volume.
+ */
+CELER_FUNCTION auto BoxGeoTrackView::propagate(real_type step) -> Propagation
+{
+    CELER_EXPECT(step > 0);
+    CELER_EXPECT(!this->is_outside());
+
+    Propagation result;
+    result.distance   = step;
+    result.boundary   = false;
+    result.safety_hit = step <= state_.safety;
+    if (!result.safety_hit)
+    {
+        this->find_next_step();
+        state_.safety = this->calc_safety();
+    }
+
+    if (result.safety_hit || step < state_.next_step)
+    {
+        // Move within the current volume
+        axpy(step, state_.dir, &state_.pos);
+        state_.next_step -= step;
+        state_.safety = celeritas::max<real_type>(state_.safety - step, 0);
+    }
+    else
+    {
+        // Move to the next volume
+        result.distance = state_.next_step;
+        result.boundary = true;
+        this->move_next_step();
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Move to the next boundary and update volume accordingly.
+ */
+CELER_FUNCTION void BoxGeoTrackView::move_next_step()
+{
+    axpy(state_.next_step, state_.dir, &state_.pos);
+    this->move_next_volume();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Update state to next volume.
+ */
+CELER_FUNCTION void BoxGeoTrackView::move_next_volume()
+{
+    state_.box      = state_.next_box;
+    state_.next_box = {};
+    state_.safety   = 0;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Move a straight-line distance that may cross boundaries, then relocate.
+ *
+ * The new point is located by moving up the hierarchy from the current box
+ * until a box contains it, then searching down through the daughters.
+ */
+CELER_FUNCTION void BoxGeoTrackView::move_and_relocate(real_type step)
+{
+    CELER_EXPECT(step >= 0);
+    CELER_EXPECT(!this->is_outside());
+
+    axpy(step, state_.dir, &state_.pos);
+    state_.box       = this->locate(state_.box, state_.pos);
+    state_.next_box  = {};
+    state_.next_step = numeric_limits<real_type>::quiet_NaN();
+    state_.safety    = celeritas::max<real_type>(state_.safety - step, 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the volume ID in the current cell.
+ */
+CELER_FUNCTION VolumeId BoxGeoTrackView::volume_id() const
+{
+    CELER_EXPECT(!this->is_outside());
+    return params_.boxes[state_.box].volume;
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE MEMBER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Find the innermost box containing a point, searching from a box.
+ *
+ * The result is null if the point is outside the world (or on its boundary).
+ */
+CELER_FUNCTION BoxId BoxGeoTrackView::locate(BoxId        start,
+                                             const Real3& pos) const
+{
+    // Move up until the point is inside a box
+    BoxId result = start;
+    while (result
+           && !detail::is_inside_box(params_.boxes[result].lower,
+                                     params_.boxes[result].upper,
+                                     pos))
+    {
+        result = params_.boxes[result].parent;
+    }
+
+    // Move down through the daughters that contain the point
+    while (result)
+    {
+        BoxId daughter = this->find_daughter(params_.boxes[result], pos);
+        if (!daughter)
+        {
+            break;
+        }
+        result = daughter;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the daughter of a box that contains a point.
+ *
+ * Since sibling boxes don't overlap, the first leaf containing the point is
+ * the result. A null ID is returned if no daughter contains the point.
+ */
+CELER_FUNCTION BoxId BoxGeoTrackView::find_daughter(const BoxDef& box,
+                                                    const Real3&  pos) const
+{
+    if (!box.bvh)
+    {
+        return {};
+    }
+
+    Array<BoxBvhNodeId, ParamsRef::max_bvh_stack()> storage;
+    MiniStack<BoxBvhNodeId>                          stack(make_span(storage));
+    stack.push(box.bvh);
+    while (!stack.empty())
+    {
+        const BoxBvhNode& node = params_.bvh_nodes[stack.pop()];
+        if (!detail::is_inside_box(node.lower, node.upper, pos))
+        {
+            continue;
+        }
+        if (node.is_leaf())
+        {
+            return node.box;
+        }
+        stack.push(node.right);
+        stack.push(node.left);
+    }
+    return {};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the isotropic distance to the current box's boundaries.
+ *
+ * This is the smaller of the distance to the walls of the current box and
+ * the distance to the nearest daughter.
+ */
+CELER_FUNCTION real_type BoxGeoTrackView::calc_safety() const
+{
+    const BoxDef& box = params_.boxes[state_.box];
+
+    real_type result
+        = detail::calc_box_safety_inside(box.lower, box.upper, state_.pos);
+    if (box.bvh)
+    {
+        Array<BoxBvhNodeId, ParamsRef::max_bvh_stack()> storage;
+        MiniStack<BoxBvhNodeId> stack(make_span(storage));
+        stack.push(box.bvh);
+        while (!stack.empty())
+        {
+            const BoxBvhNode& node = params_.bvh_nodes[stack.pop()];
+            real_type         dist = detail::calc_box_safety_outside(
+                node.lower, node.upper, state_.pos);
+            if (!(dist < result))
+            {
+                continue;
+            }
+            if (node.is_leaf())
+            {
+                result = dist;
+            }
+            else
+            {
+                stack.push(node.right);
+                stack.push(node.left);
+            }
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
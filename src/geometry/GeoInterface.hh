@@ -76,12 +76,13 @@ struct GeoStatePointers
     Real3*     pos       = nullptr;
     Real3*     dir       = nullptr;
     real_type* next_step = nullptr;
+    real_type* safety    = nullptr;
 
     //! True if assigned
     explicit CELER_FUNCTION operator bool() const
     {
         return bool(size) && bool(vgmaxdepth) && bool(vgstate) && bool(vgnext)
-               && bool(pos) && bool(dir) && bool(next_step);
+               && bool(pos) && bool(dir) && bool(next_step) && bool(safety);
     }
 };
 
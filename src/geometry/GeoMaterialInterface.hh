@@ -0,0 +1,48 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file GeoMaterialInterface.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Collection.hh"
+#include "base/Macros.hh"
+#include "physics/material/Types.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Material ID of each geometry volume, indexed by volume ID.
+ *
+ * \sa GeoMaterialParams (owns the pointed-to data)
+ * \sa GeoMaterialView (uses the pointed-to data in a kernel)
+ */
+template<Ownership W, MemSpace M>
+struct GeoMaterialParamsData
+{
+    Collection<MaterialId, W, M, VolumeId> materials;
+
+    //// MEMBER FUNCTIONS ////
+
+    //! Whether the data is assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !materials.empty();
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    GeoMaterialParamsData& operator=(const GeoMaterialParamsData<W2, M2>& other)
+    {
+        CELER_EXPECT(other);
+        materials = other.materials;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
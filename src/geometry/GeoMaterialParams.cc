@@ -0,0 +1,95 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file GeoMaterialParams.cc
+//---------------------------------------------------------------------------//
+#include "GeoMaterialParams.hh"
+
+#include <map>
+#include "base/Assert.hh"
+#include "base/CollectionBuilder.hh"
+#include "base/Range.hh"
+#include "io/GdmlGeometryMap.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from a volume-to-material mapping.
+ */
+GeoMaterialParams::GeoMaterialParams(const Input& inp)
+{
+    CELER_EXPECT(inp.materials);
+    CELER_EXPECT(inp.num_volumes > 0);
+    CELER_VALIDATE(inp.volume_to_mat.size() == inp.num_volumes,
+                   "Volume-to-material map has "
+                       << inp.volume_to_mat.size()
+                       << " entries, but the geometry has "
+                       << inp.num_volumes << " volumes");
+
+    for (auto vol_id : range(VolumeId(inp.volume_to_mat.size())))
+    {
+        MaterialId mat_id = inp.volume_to_mat[vol_id.get()];
+        CELER_VALIDATE(mat_id,
+                       "Volume " << vol_id.get() << " has no material");
+        CELER_VALIDATE(mat_id < inp.materials->size(),
+                       "Volume " << vol_id.get() << " has material "
+                                 << mat_id.get()
+                                 << ", but only "
+                                 << inp.materials->size()
+                                 << " materials are defined");
+    }
+
+    GeoMaterialParamsData<Ownership::value, MemSpace::host> host_data;
+    make_builder(&host_data.materials)
+        .insert_back(inp.volume_to_mat.begin(), inp.volume_to_mat.end());
+
+    // Move to mirrored data, copying to device
+    data_ = CollectionMirror<GeoMaterialParamsData>{std::move(host_data)};
+
+    CELER_ENSURE(data_);
+    CELER_ENSURE(this->num_volumes() == inp.num_volumes);
+}
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Convert imported volume-material links to a dense volume-to-material map.
+ *
+ * The exported volume IDs index the result, and the exported material IDs are
+ * replaced by their position in the material map (which is how the imported
+ * \c MaterialParams are ordered). The result has one entry for each of the
+ * geometry's volumes: volumes without a material link have a null material
+ * ID.
+ */
+GeoMaterialParams::VecMaterialId
+to_volume_materials(const GdmlGeometryMap& geometry, size_type num_volumes)
+{
+    // Convert exported material IDs to their position in the material map
+    std::map<mat_id, MaterialId> mat_index;
+    for (const auto& mat_key : geometry.matid_to_material_map())
+    {
+        mat_index.insert({mat_key.first, MaterialId(mat_index.size())});
+    }
+
+    GeoMaterialParams::VecMaterialId result(num_volumes);
+    for (const auto& vol_mat : geometry.volid_to_matid_map())
+    {
+        CELER_VALIDATE(vol_mat.first < num_volumes,
+                       "Volume " << vol_mat.first
+                                 << " is out of range: the geometry has "
+                                 << num_volumes << " volumes");
+        auto iter = mat_index.find(vol_mat.second);
+        CELER_VALIDATE(iter != mat_index.end(),
+                       "Volume " << vol_mat.first << " has unknown material "
+                                 << vol_mat.second);
+        result[vol_mat.first] = iter->second;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,82 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file GeoMaterialParams.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "base/CollectionMirror.hh"
+#include "base/Types.hh"
+#include "physics/material/MaterialParams.hh"
+#include "GeoMaterialInterface.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+class GdmlGeometryMap;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Map geometry volumes to materials.
+ *
+ * The map is a dense array indexed by \c VolumeId , so a volume's material is
+ * found in constant time on host or device. The map must have one entry per
+ * geometry volume (e.g. \c GeoParams::num_volumes ), every volume must have a
+ * material, and every material must be defined in the material params.
+ */
+class GeoMaterialParams
+{
+  public:
+    //!@{
+    //! Type aliases
+    using SPConstMaterials = std::shared_ptr<const MaterialParams>;
+    using HostRef
+        = GeoMaterialParamsData<Ownership::const_reference, MemSpace::host>;
+    using DeviceRef
+        = GeoMaterialParamsData<Ownership::const_reference, MemSpace::device>;
+    using VecMaterialId = std::vector<MaterialId>;
+    //!@}
+
+    //! Input data to construct this class
+    struct Input
+    {
+        SPConstMaterials materials;
+        size_type        num_volumes{}; //!< Number of geometry volumes
+        VecMaterialId    volume_to_mat; //!< Indexed by VolumeId
+    };
+
+  public:
+    // Construct from a volume-to-material mapping
+    explicit GeoMaterialParams(const Input& inp);
+
+    //! Number of volumes
+    VolumeId::size_type num_volumes() const
+    {
+        return this->host_pointers().materials.size();
+    }
+
+    //! Access data on the host
+    const HostRef& host_pointers() const { return data_.host(); }
+
+    //! Access data on the device
+    const DeviceRef& device_pointers() const { return data_.device(); }
+
+  private:
+    // Host/device storage and reference
+    CollectionMirror<GeoMaterialParamsData> data_;
+};
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+
+// Convert imported volume-material links to a dense volume-to-material map
+GeoMaterialParams::VecMaterialId
+to_volume_materials(const GdmlGeometryMap& geometry, size_type num_volumes);
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,51 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file GeoMaterialView.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "physics/material/Types.hh"
+#include "GeoMaterialInterface.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Access the material of a geometry volume on host or device.
+ *
+ * The lookup is a single array access, so it can be done at every track
+ * initialization and boundary crossing:
+ * \code
+    GeoMaterialView geo_mat(geo_mat_params_ref);
+    mat = {geo_mat.material_id(geo.volume_id())};
+   \endcode
+ */
+class GeoMaterialView
+{
+  public:
+    //!@{
+    //! Type aliases
+    using ParamsRef
+        = GeoMaterialParamsData<Ownership::const_reference, MemSpace::native>;
+    //!@}
+
+  public:
+    // Construct from shared data
+    explicit inline CELER_FUNCTION GeoMaterialView(const ParamsRef& params);
+
+    // Get the material of a volume
+    inline CELER_FUNCTION MaterialId material_id(VolumeId volume) const;
+
+  private:
+    const ParamsRef& params_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "GeoMaterialView.i.hh"
@@ -0,0 +1,33 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file GeoMaterialView.i.hh
+//---------------------------------------------------------------------------//
+#include "base/Assert.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from shared data.
+ */
+CELER_FUNCTION GeoMaterialView::GeoMaterialView(const ParamsRef& params)
+    : params_(params)
+{
+    CELER_EXPECT(params_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the material of a volume.
+ */
+CELER_FUNCTION MaterialId GeoMaterialView::material_id(VolumeId volume) const
+{
+    CELER_EXPECT(volume < params_.materials.size());
+    return params_.materials[volume];
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
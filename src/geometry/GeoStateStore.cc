@@ -26,12 +26,42 @@ namespace celeritas
 GeoStateStore::GeoStateStore(const GeoParams& geom, size_type size)
     : max_depth_(geom.max_depth())
 {
-    CELER_EXPECT(celeritas::device());
-    vgstate_   = detail::VGNavStateStore(size, max_depth_);
-    vgnext_    = detail::VGNavStateStore(size, max_depth_);
-    pos_       = DeviceVector<Real3>(size);
-    dir_       = DeviceVector<Real3>(size);
-    next_step_ = DeviceVector<double>(size);
+    CELER_EXPECT(size > 0);
+    vgstate_        = detail::VGNavStateStore(size, max_depth_);
+    vgnext_         = detail::VGNavStateStore(size, max_depth_);
+    host_pos_       = std::vector<Real3>(size);
+    host_dir_       = std::vector<Real3>(size);
+    host_next_step_ = std::vector<real_type>(size);
+    host_safety_    = std::vector<real_type>(size);
+    if (celeritas::device())
+    {
+        pos_       = DeviceVector<Real3>(size);
+        dir_       = DeviceVector<Real3>(size);
+        next_step_ = DeviceVector<double>(size);
+        safety_    = DeviceVector<double>(size);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a view to host states.
+ *
+ * Each thread may safely use a \c GeoTrackView with a different track ID.
+ */
+GeoStatePointers GeoStateStore::host_pointers()
+{
+    GeoStatePointers result;
+    result.size       = this->size();
+    result.vgmaxdepth = max_depth_;
+    result.vgstate    = vgstate_.host_pointers();
+    result.vgnext     = vgnext_.host_pointers();
+    result.pos        = host_pos_.data();
+    result.dir        = host_dir_.data();
+    result.next_step  = host_next_step_.data();
+    result.safety     = host_safety_.data();
+
+    CELER_ENSURE(result);
+    return result;
 }
 
 //---------------------------------------------------------------------------//
@@ -40,6 +70,8 @@ GeoStateStore::GeoStateStore(const GeoParams& geom, size_type size)
  */
 GeoStatePointers GeoStateStore::device_pointers()
 {
+    CELER_EXPECT(celeritas::device());
+
     GeoStatePointers result;
     result.size       = this->size();
     result.vgmaxdepth = max_depth_;
@@ -48,6 +80,7 @@ GeoStatePointers GeoStateStore::device_pointers()
     result.pos        = pos_.device_pointers().data();
     result.dir        = dir_.device_pointers().data();
     result.next_step  = next_step_.device_pointers().data();
+    result.safety     = safety_.device_pointers().data();
 
     CELER_ENSURE(result);
     return result;
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 #include "base/Array.hh"
 #include "base/DeviceVector.hh"
 #include "base/Span.hh"
@@ -20,9 +21,10 @@ namespace celeritas
 class GeoParams;
 //---------------------------------------------------------------------------//
 /*!
- * Manage on-device VecGeom states.
+ * Manage host and on-device VecGeom states.
  *
- * \note Construction on a build without a GPU (or CUDA) will raise an error.
+ * Host states are always allocated, so that host threads can each navigate a
+ * separate track. Device states are only allocated if a GPU is available.
  */
 class GeoStateStore
 {
@@ -39,7 +41,10 @@ class GeoStateStore
     //// ACCESSORS ////
 
     //! Number of states
-    size_type size() const { return pos_.size(); }
+    size_type size() const { return host_pos_.size(); }
+
+    // View host states
+    GeoStatePointers host_pointers();
 
     // View on-device states
     GeoStatePointers device_pointers();
@@ -51,6 +56,11 @@ class GeoStateStore
     DeviceVector<Real3>     pos_;
     DeviceVector<Real3>     dir_;
     DeviceVector<double>    next_step_;
+    DeviceVector<double>    safety_;
+    std::vector<Real3>      host_pos_;
+    std::vector<Real3>      host_dir_;
+    std::vector<real_type>  host_next_step_;
+    std::vector<real_type>  host_safety_;
 };
 
 //---------------------------------------------------------------------------//
@@ -24,6 +24,13 @@ namespace celeritas
  * \code
     GeoTrackView geom(vg_view, vg_state_view, thread_id);
    \endcode
+ *
+ * Each track caches its safety distance, the isotropic distance to the
+ * nearest boundary, which is a lower bound that remains valid (after
+ * subtracting the distance moved) as long as the track stays in the same
+ * volume. The \c propagate method moves a proposed (e.g. physics-limited)
+ * distance without any boundary calculation if the distance is within the
+ * cached safety.
  */
 class GeoTrackView
 {
@@ -40,6 +47,14 @@ class GeoTrackView
         Real3         dir;   //!< New direction
     };
 
+    //! Result of propagating a proposed step
+    struct Propagation
+    {
+        real_type distance;   //!< Distance moved
+        bool      boundary;   //!< Whether the track moved to a new volume
+        bool      safety_hit; //!< Whether the boundary search was skipped
+    };
+
   public:
     // Construct from persistent and state data
     inline CELER_FUNCTION GeoTrackView(const GeoParamsPointers& data,
@@ -53,17 +68,25 @@ class GeoTrackView
                           operator=(const DetailedInitializer& init);
     // Find the distance to the next boundary
     inline CELER_FUNCTION void find_next_step();
+    // Find the isotropic distance to the nearest boundary
+    inline CELER_FUNCTION real_type find_safety();
+    // Move up to the given distance, stopping at the next boundary
+    inline CELER_FUNCTION Propagation propagate(real_type step);
     // Move to the next boundary
     inline CELER_FUNCTION void move_next_step();
 
     // Update current volume, called whenever move reaches boundary
     inline CELER_FUNCTION void move_next_volume();
 
+    // Move a distance that may cross boundaries, and find the new volume
+    inline CELER_FUNCTION void move_and_relocate(real_type step);
+
     //!@{
     //! State accessors
     CELER_FUNCTION const Real3& pos() const { return pos_; }
     CELER_FUNCTION const Real3& dir() const { return dir_; }
     CELER_FUNCTION real_type    next_step() const { return next_step_; }
+    CELER_FUNCTION real_type    safety() const { return safety_; }
     //!@}
 
     //!@{
@@ -71,6 +94,7 @@ class GeoTrackView
     CELER_FUNCTION Real3& pos() { return pos_; }
     CELER_FUNCTION Real3& dir() { return dir_; }
     CELER_FUNCTION real_type& next_step() { return next_step_; }
+    CELER_FUNCTION real_type& safety() { return safety_; }
     //!@}
 
     //! Get the volume ID in the current cell.
@@ -99,6 +123,7 @@ class GeoTrackView
     Real3&     pos_;
     Real3&     dir_;
     real_type& next_step_;
+    real_type& safety_;
     //!@}
 
   private:
@@ -106,6 +131,9 @@ class GeoTrackView
     static inline CELER_FUNCTION NavState&
     get_nav_state(void* state, int vgmaxdepth, ThreadId thread);
 
+    // Find the distance to the next boundary and update the safety
+    inline CELER_FUNCTION void find_next_step_and_safety();
+
   public:
     //! Get a reference to the current volume
     inline CELER_FUNCTION const Volume& volume() const;
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #include <VecGeom/navigation/GlobalLocator.h>
 #include <VecGeom/navigation/VNavigator.h>
+#include "base/Algorithms.hh"
 #include "base/ArrayUtils.hh"
 #include "detail/VGCompatibility.hh"
 
@@ -26,6 +27,7 @@ GeoTrackView::GeoTrackView(const GeoParamsPointers& data,
     , pos_(stateview.pos[id.get()])
     , dir_(stateview.dir[id.get()])
     , next_step_(stateview.next_step[id.get()])
+    , safety_(stateview.safety[id.get()])
 {
 }
 
@@ -57,6 +59,7 @@ CELER_FUNCTION GeoTrackView& GeoTrackView::operator=(const Initializer_t& init)
     // Set up next state
     vgnext_.Clear();
     next_step_ = celeritas::numeric_limits<real_type>::quiet_NaN();
+    safety_    = 0;
     return *this;
 }
 
@@ -71,7 +74,8 @@ GeoTrackView& GeoTrackView::operator=(const DetailedInitializer& init)
     {
         // Copy the navigation state and position from the parent state
         init.other.vgstate_.CopyTo(&vgstate_);
-        pos_ = init.other.pos_;
+        pos_    = init.other.pos_;
+        safety_ = init.other.safety_;
     }
     // Set up the next state and initialize the direction
     vgnext_.Clear();
@@ -81,7 +85,9 @@ GeoTrackView& GeoTrackView::operator=(const DetailedInitializer& init)
 }
 
 //---------------------------------------------------------------------------//
-//! Find the distance to the next geometric boundary.
+/*!
+ * Find the distance to the next geometric boundary.
+ */
 CELER_FUNCTION void GeoTrackView::find_next_step()
 {
     const vecgeom::LogicalVolume* logical_vol
@@ -99,6 +105,94 @@ CELER_FUNCTION void GeoTrackView::find_next_step()
                                                    vgnext_);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Find the isotropic distance to the nearest boundary.
+ *
+ * The result is cached so that subsequent steps shorter than the safety can
+ * skip the boundary calculation.
+ */
+CELER_FUNCTION real_type GeoTrackView::find_safety()
+{
+    const vecgeom::VNavigator* navigator
+        = this->volume().GetLogicalVolume()->GetNavigator();
+    CELER_ASSERT(navigator);
+
+    safety_ = celeritas::max<real_type>(
+        navigator->GetSafetyEstimator()->ComputeSafety(
+            detail::to_vector(pos_), vgstate_),
+        0);
+    return safety_;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Move up to the given distance, stopping at the next boundary.
+ *
+ * If the proposed step is within the cached safety distance, the track is
+ * moved without navigating and the safety is decremented. Otherwise the
+ * distance to the next boundary (and a new safety) is calculated: if the
+ * boundary is closer than the proposed step, the track is moved (with an
+ * extra push) into the next volume.
+ */
+CELER_FUNCTION auto GeoTrackView::propagate(real_type step) -> Propagation
+{
+    CELER_EXPECT(step > 0);
+    CELER_EXPECT(!this->is_outside());
+
+    Propagation result;
+    result.distance   = step;
+    result.boundary   = false;
+    result.safety_hit = step <= safety_;
+    if (!result.safety_hit)
+    {
+        this->find_next_step_and_safety();
+    }
+
+    if (result.safety_hit || step < next_step_)
+    {
+        // Move within the current volume
+        axpy(step, dir_, &pos_);
+        next_step_ -= step;
+        safety_ = celeritas::max<real_type>(safety_ - step, 0);
+    }
+    else
+    {
+        // Move to the next volume
+        result.distance = next_step_;
+        result.boundary = true;
+        axpy(next_step_ + this->extra_push(), dir_, &pos_);
+        this->move_next_volume();
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the distance to the next boundary and the isotropic safety together.
+ *
+ * This is used by \c propagate so that later steps can reuse the safety;
+ * callers that only need the boundary distance use \c find_next_step to
+ * avoid the extra safety calculation.
+ */
+CELER_FUNCTION void GeoTrackView::find_next_step_and_safety()
+{
+    const vecgeom::VNavigator* navigator
+        = this->volume().GetLogicalVolume()->GetNavigator();
+    CELER_ASSERT(navigator);
+
+    vecgeom::Precision safety = 0;
+    next_step_ = navigator->ComputeStepAndSafetyAndPropagatedState(
+        detail::to_vector(pos_),
+        detail::to_vector(dir_),
+        vecgeom::kInfLength,
+        vgstate_,
+        vgnext_,
+        true,
+        safety);
+    safety_ = celeritas::max<real_type>(safety, 0);
+}
+
 //---------------------------------------------------------------------------//
 //! Move to the next boundary and update volume accordingly
 CELER_FUNCTION void GeoTrackView::move_next_step()
@@ -114,6 +208,32 @@ CELER_FUNCTION void GeoTrackView::move_next_volume()
 {
     vgstate_ = vgnext_;
     vgnext_.Clear();
+    safety_ = 0;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Move a straight-line distance that may cross boundaries, then relocate.
+ *
+ * This is used for Woodcock tracking, where the step length doesn't depend on
+ * the distance to the next boundary. Rather than locating the new point from
+ * the world volume, the navigation path is popped until the containing volume
+ * is found and the point is located downward from there. If the point is
+ * outside the world, the state will be outside.
+ */
+CELER_FUNCTION void GeoTrackView::move_and_relocate(real_type step)
+{
+    CELER_EXPECT(step >= 0);
+    CELER_EXPECT(!this->is_outside());
+
+    axpy(step, dir_, &pos_);
+    const auto local_pos
+        = vgstate_.TopMatrix().Transform(detail::to_vector(pos_));
+    vecgeom::GlobalLocator::RelocatePointFromPath(local_pos, vgstate_);
+
+    vgnext_.Clear();
+    next_step_ = celeritas::numeric_limits<real_type>::quiet_NaN();
+    safety_    = celeritas::max<real_type>(safety_ - step, 0);
 }
 
 //---------------------------------------------------------------------------//
@@ -131,12 +251,12 @@ CELER_FUNCTION VolumeId GeoTrackView::volume_id() const
  * Determine the pointer to the navigation state for a particular index.
  *
  * When using the "cuda"-namespace navigation state (i.e., compiling with NVCC)
- * it's necessary to transform the raw data pointer into an index.
+ * it's necessary to transform the raw data pointer into an index. Host states
+ * are stored contiguously with each state padded to whole cache lines.
  */
-CELER_FUNCTION auto
-GeoTrackView::get_nav_state(void*                  state,
-                            CELER_MAYBE_UNUSED int vgmaxdepth,
-                            ThreadId               thread) -> NavState&
+CELER_FUNCTION auto GeoTrackView::get_nav_state(void*    state,
+                                                int      vgmaxdepth,
+                                                ThreadId thread) -> NavState&
 {
     CELER_EXPECT(state);
     char* ptr = reinterpret_cast<char*>(state);
@@ -144,7 +264,8 @@ GeoTrackView::get_nav_state(void*                  state,
     ptr += vecgeom::cuda::NavigationState::SizeOfInstanceAlignAware(vgmaxdepth)
            * thread.get();
 #else
-    CELER_EXPECT(thread.get() == 0);
+    // Host states are padded to separate cache lines by VGNavStateStore
+    ptr += detail::host_nav_state_stride(vgmaxdepth) * thread.get();
 #endif
     CELER_ENSURE(ptr);
     return *reinterpret_cast<NavState*>(ptr);
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <cmath>
+#include "base/Algorithms.hh"
 #include "base/ArrayUtils.hh"
 #include "geometry/Types.hh"
 #include "physics/base/Units.hh"
@@ -64,13 +65,15 @@ void LinearPropagator::operator()(real_type dist)
  * Do straight propagation to physics process or boundary and reduce next_step
  *
  * Scalar geometry length computation. The track is moved along track.dir()
- * direction by a distance track.next_step()
+ * direction by a distance track.next_step(). The cached safety distance is
+ * reduced by the same amount.
  */
 CELER_FUNCTION
 void LinearPropagator::apply_linear_step(real_type step)
 {
     axpy(step, track_.dir(), &track_.pos());
     track_.next_step() -= step;
+    track_.safety() = celeritas::max<real_type>(track_.safety() - step, 0);
 }
 
 } // namespace celeritas
@@ -0,0 +1,150 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BoxUtils.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+#include "base/Array.hh"
+#include "base/Macros.hh"
+#include "base/NumericLimits.hh"
+#include "base/Types.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the reciprocal of each direction component.
+ *
+ * Zero components become signed infinities, which the intersection functions
+ * below treat as "never crossing" the corresponding planes.
+ */
+inline CELER_FUNCTION Real3 calc_inv_dir(const Real3& dir)
+{
+    return {1 / dir[0], 1 / dir[1], 1 / dir[2]};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Distance past a boundary used to determine the next volume.
+ *
+ * This is about a hundred units in the last place of the largest position
+ * component so that the bumped point is unambiguously across the boundary.
+ */
+inline CELER_FUNCTION real_type calc_bump(const Real3& pos)
+{
+    real_type scale = 1;
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        scale = std::fmax(scale, std::fabs(pos[ax]));
+    }
+    return 100 * numeric_limits<real_type>::epsilon() * scale;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether a point is strictly inside an axis-aligned box.
+ */
+inline CELER_FUNCTION bool
+is_inside_box(const Real3& lower, const Real3& upper, const Real3& pos)
+{
+    return (lower[0] < pos[0]) & (pos[0] < upper[0]) & (lower[1] < pos[1])
+           & (pos[1] < upper[1]) & (lower[2] < pos[2]) & (pos[2] < upper[2]);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Distance along a ray from inside a box to its boundary.
+ *
+ * The plane on each axis is selected from the sign of the direction rather
+ * than with a branch. Products of zero and infinity (a ray parallel to and
+ * on a face) are NaN and are ignored by \c fmin .
+ */
+inline CELER_FUNCTION real_type calc_box_exit(const Real3& lower,
+                                              const Real3& upper,
+                                              const Real3& pos,
+                                              const Real3& inv_dir)
+{
+    real_type result = numeric_limits<real_type>::infinity();
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        const real_type bound = inv_dir[ax] >= 0 ? upper[ax] : lower[ax];
+        result = std::fmin(result, (bound - pos[ax]) * inv_dir[ax]);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Distance along a ray from outside a box to its boundary.
+ *
+ * This uses the slab method: the ray enters the box at the largest of the
+ * per-axis entry distances as long as that is before the smallest of the
+ * exit distances. A ray whose exit is within \c tolerance of the starting
+ * point (i.e. one that is leaving the box across a face it lies on) misses.
+ * The result is infinite if the box is missed.
+ */
+inline CELER_FUNCTION real_type calc_box_entry(const Real3& lower,
+                                               const Real3& upper,
+                                               const Real3& pos,
+                                               const Real3& inv_dir,
+                                               real_type    tolerance)
+{
+    real_type t_enter = 0;
+    real_type t_exit  = numeric_limits<real_type>::infinity();
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        const bool      positive = inv_dir[ax] >= 0;
+        const real_type near     = positive ? lower[ax] : upper[ax];
+        const real_type far      = positive ? upper[ax] : lower[ax];
+        t_enter = std::fmax(t_enter, (near - pos[ax]) * inv_dir[ax]);
+        t_exit  = std::fmin(t_exit, (far - pos[ax]) * inv_dir[ax]);
+    }
+    return (t_enter <= t_exit) & (t_exit > tolerance)
+               ? t_enter
+               : numeric_limits<real_type>::infinity();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Isotropic distance from a point inside a box to its boundary.
+ */
+inline CELER_FUNCTION real_type calc_box_safety_inside(const Real3& lower,
+                                                       const Real3& upper,
+                                                       const Real3& pos)
+{
+    real_type result = numeric_limits<real_type>::infinity();
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        result = std::fmin(result, pos[ax] - lower[ax]);
+        result = std::fmin(result, upper[ax] - pos[ax]);
+    }
+    return std::fmax(result, real_type(0));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Isotropic distance from a point outside a box to the box.
+ */
+inline CELER_FUNCTION real_type calc_box_safety_outside(const Real3& lower,
+                                                        const Real3& upper,
+                                                        const Real3& pos)
+{
+    real_type dist_sq = 0;
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        const real_type delta = std::fmax(
+            std::fmax(lower[ax] - pos[ax], pos[ax] - upper[ax]), real_type(0));
+        dist_sq += delta * delta;
+    }
+    return std::sqrt(dist_sq);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -7,7 +7,9 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <cstddef>
 #include <VecGeom/base/Vector3D.h>
+#include <VecGeom/navigation/NavigationState.h>
 
 #include "base/Macros.hh"
 #include "base/Array.hh"
@@ -37,6 +39,22 @@ CELER_FUNCTION inline auto to_vector(const Array<T, 3>& arr)
     return to_vector(celeritas::make_span<T, 3>(arr));
 }
 
+//---------------------------------------------------------------------------//
+//! Alignment of each host navigation state in a contiguous pool
+constexpr std::size_t host_nav_state_alignment = 64;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Size of a host navigation state padded to a whole number of cache lines.
+ */
+inline std::size_t host_nav_state_stride(int max_depth)
+{
+    std::size_t size
+        = vecgeom::cxx::NavigationState::SizeOfInstanceAlignAware(max_depth);
+    return (size + host_nav_state_alignment - 1) / host_nav_state_alignment
+           * host_nav_state_alignment;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace detail
 } // namespace celeritas
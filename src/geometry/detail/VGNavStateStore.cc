@@ -0,0 +1,83 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file VGNavStateStore.cc
+//---------------------------------------------------------------------------//
+#include "VGNavStateStore.hh"
+
+#include <cstdint>
+#include <VecGeom/navigation/NavigationState.h>
+#include "base/Assert.hh"
+#include "base/Range.hh"
+#include "VGCompatibility.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+using NavState = vecgeom::cxx::NavigationState;
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with sizes, allocating host states and (if enabled) device states.
+ */
+VGNavStateStore::VGNavStateStore(size_type size, int depth)
+{
+    CELER_EXPECT(size > 0);
+    CELER_EXPECT(depth > 0);
+
+    // Over-allocate so the first state can be aligned to a cache line
+    HostPoolDeleter deleter;
+    deleter.stride = host_nav_state_stride(depth);
+    host_pool_     = UPHostPool(
+        new char[size * deleter.stride + host_nav_state_alignment], deleter);
+    auto addr = reinterpret_cast<std::uintptr_t>(host_pool_.get());
+    host_pool_.get_deleter().offset = (host_nav_state_alignment
+                                       - addr % host_nav_state_alignment)
+                                      % host_nav_state_alignment;
+
+    // Construct states in place
+    char* states = host_pool_.get() + host_pool_.get_deleter().offset;
+    for (auto i : range(size))
+    {
+        NavState::MakeInstanceAt(depth, states + i * deleter.stride);
+        ++host_pool_.get_deleter().size;
+    }
+
+    this->allocate_device(size, depth);
+    CELER_ENSURE(*this);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the start of the contiguous host states.
+ *
+ * The state for track \em i is at an offset of \c host_nav_state_stride(depth)
+ * times \em i bytes.
+ */
+void* VGNavStateStore::host_pointers() const
+{
+    CELER_EXPECT(*this);
+    return host_pool_.get() + host_pool_.get_deleter().offset;
+}
+
+//---------------------------------------------------------------------------//
+//! Destroy host states and free the buffer
+void VGNavStateStore::HostPoolDeleter::operator()(char* buffer) const
+{
+    for (auto i : range(size))
+    {
+        auto* state = reinterpret_cast<NavState*>(buffer + offset + i * stride);
+        state->~NavState();
+    }
+    delete[] buffer;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
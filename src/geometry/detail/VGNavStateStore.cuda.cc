@@ -17,11 +17,14 @@ namespace detail
 {
 //---------------------------------------------------------------------------//
 /*!
- * Construct with sizes, allocating on GPU.
+ * Allocate device states if a device is available.
  */
-VGNavStateStore::VGNavStateStore(size_type size, int depth)
+void VGNavStateStore::allocate_device(size_type size, int depth)
 {
-    pool_.reset(new vecgeom::cxx::NavStatePool(size, depth));
+    if (celeritas::device())
+    {
+        pool_.reset(new vecgeom::cxx::NavStatePool(size, depth));
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -46,6 +49,7 @@ void VGNavStateStore::copy_to_device()
 void* VGNavStateStore::device_pointers() const
 {
     CELER_EXPECT(*this);
+    CELER_EXPECT(pool_);
     void* ptr = pool_->GetGPUPointer();
     CELER_ENSURE(ptr);
     return ptr;
@@ -29,11 +29,16 @@ namespace detail
 {
 //---------------------------------------------------------------------------//
 /*!
- * Manage a pool of device-side geometry states.
+ * Manage pools of host- and device-side geometry states.
  *
  * Construction of the navstatepool has to be in a host compliation unit due to
  * VecGeom macro magic.
  *
+ * The host states are allocated contiguously, one per track, with each state
+ * padded to a multiple of the cache line size (see \c host_nav_state_stride)
+ * so that separate host threads can navigate independent tracks without
+ * sharing cache lines. Device states are only allocated when CUDA is enabled.
+ *
  * This class is designed with a PIMPL-like idiom to hide VecGeom classes from
  * downstream Celeritas code. It specifically also ensures that the
  * construction and destruction of the NavStatePool are compiled using the host
@@ -55,15 +60,18 @@ class VGNavStateStore
     VGNavStateStore(size_type size, int depth);
 
     //! Whether the state is constructed
-    explicit operator bool() const { return static_cast<bool>(pool_); }
+    explicit operator bool() const { return static_cast<bool>(host_pool_); }
 
     // Access the host pool (TODO: delete once cuda::GlobalLocator works)
     NavStatePool& get()
     {
-        CELER_EXPECT(*this);
+        CELER_EXPECT(pool_);
         return *pool_;
     }
 
+    // View to contiguous array of host states
+    void* host_pointers() const;
+
     // Copy host states to device
     void copy_to_device();
 
@@ -77,7 +85,21 @@ class VGNavStateStore
     };
     using UPNavStatePool = std::unique_ptr<NavStatePool, NavStatePoolDeleter>;
 
+    struct HostPoolDeleter
+    {
+        size_type size   = 0; //!< Number of constructed states
+        size_type stride = 0; //!< Padded size of each state
+        size_type offset = 0; //!< Aligned start of the states in the buffer
+
+        void operator()(char*) const;
+    };
+    using UPHostPool = std::unique_ptr<char[], HostPoolDeleter>;
+
     UPNavStatePool pool_;
+    UPHostPool     host_pool_;
+
+    // Allocate device states if CUDA is enabled and a device is available
+    void allocate_device(size_type size, int depth);
 };
 
 //---------------------------------------------------------------------------//
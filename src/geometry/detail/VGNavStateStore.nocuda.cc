@@ -15,12 +15,9 @@ namespace detail
 {
 //---------------------------------------------------------------------------//
 /*!
- * Prevent allocation because CUDA is disabled.
+ * Only host states are allocated because CUDA is disabled.
  */
-VGNavStateStore::VGNavStateStore(size_type, int)
-{
-    CELER_NOT_CONFIGURED("CUDA");
-}
+void VGNavStateStore::allocate_device(size_type, int) {}
 
 //---------------------------------------------------------------------------//
 /*!
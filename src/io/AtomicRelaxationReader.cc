@@ -168,7 +168,7 @@ AtomicRelaxationReader::operator()(int atomic_number) const
             norm += transition.probability;
         for (const auto& transition : shell.auger)
             norm += transition.probability;
-        CELER_ASSERT(soft_near(1., norm, 1.e-5));
+        CELER_ASSERT(soft_near(real_type(1), norm, real_type(1e-5)));
 
         norm = 1. / norm;
         for (auto& transition : shell.fluor)
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -29,6 +30,19 @@ enum class ImportMaterialState
     gas
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Secondary production threshold for a single particle type and material.
+ *
+ * Geant4 converts the user-specified range cut to an energy threshold for
+ * each material-cuts couple.
+ */
+struct ImportProductionCut
+{
+    real_type energy; // [MeV]
+    real_type range;  // [cm]
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Store data of a given material and its elements.
@@ -53,6 +67,7 @@ struct ImportMaterial
     real_type                    nuclear_int_length;     // [cm]
     std::map<elem_id, real_type> elements_fractions;     // Mass fractions
     std::map<elem_id, real_type> elements_num_fractions; // Number fractions
+    std::map<int, ImportProductionCut> pdg_cutoffs;      // Cuts by PDG code
 };
 
 //---------------------------------------------------------------------------//
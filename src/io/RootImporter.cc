@@ -10,6 +10,8 @@
 #include <cstdlib>
 #include <iomanip>
 #include <iostream>
+#include <map>
+#include <set>
 #include <tuple>
 
 #include <TFile.h>
@@ -20,6 +22,7 @@
 #include "base/Assert.hh"
 #include "base/Range.hh"
 #include "comm/Logger.hh"
+#include "geometry/GeoMaterialParams.hh"
 #include "physics/base/Units.hh"
 #include "ImportParticle.hh"
 
@@ -49,6 +52,53 @@ MatterState to_matter_state(const ImportMaterialState state)
     }
     CELER_ASSERT_UNREACHABLE();
 }
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert the exported production cuts to per-material energy thresholds.
+ *
+ * Materials are ordered the same way as in \c load_material_data. A material
+ * without an exported cut for a particle type has no threshold.
+ */
+PhysicsParams::ProductionCuts
+to_production_cuts(const GdmlGeometryMap& geometry)
+{
+    const auto& material_map = geometry.matid_to_material_map();
+
+    PhysicsParams::ProductionCuts result;
+    size_type                     mat_idx = 0;
+    for (const auto& mat_key : material_map)
+    {
+        for (const auto& pdg_cut : mat_key.second.pdg_cutoffs)
+        {
+            auto& energies = result[PDGNumber{pdg_cut.first}];
+            energies.resize(material_map.size());
+            energies[mat_idx] = units::MevEnergy{pdg_cut.second.energy};
+        }
+        ++mat_idx;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the materials that are assigned to at least one geometry volume.
+ *
+ * Materials are ordered the same way as in \c load_material_data.
+ */
+PhysicsParams::VecMaterialId to_used_materials(const GdmlGeometryMap& geometry)
+{
+    std::set<MaterialId> used;
+    for (MaterialId mat_id : to_volume_materials(
+             geometry, geometry.volid_to_volume_map().size()))
+    {
+        if (mat_id)
+        {
+            used.insert(mat_id);
+        }
+    }
+    return {used.begin(), used.end()};
+}
 } // namespace
 
 //---------------------------------------------------------------------------//
@@ -77,6 +127,8 @@ RootImporter::result_type RootImporter::operator()()
     geant_data.processes       = this->load_processes();
     geant_data.geometry        = this->load_geometry_data();
     geant_data.material_params = this->load_material_data();
+    geant_data.production_cuts = to_production_cuts(*geant_data.geometry);
+    geant_data.used_materials  = to_used_materials(*geant_data.geometry);
 
     // Sort processes based on particle def IDs, process types, etc.
     {
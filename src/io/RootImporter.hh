@@ -15,6 +15,7 @@
 #include "base/Types.hh"
 #include "physics/base/ParticleInterface.hh"
 #include "physics/base/ParticleParams.hh"
+#include "physics/base/PhysicsParams.hh"
 #include "physics/material/MaterialParams.hh"
 #include "ImportProcess.hh"
 #include "GdmlGeometryMap.hh"
@@ -46,6 +47,11 @@ namespace celeritas
  * See RootImporter.test.cc for an example on how to fetch a given table.
  * This method will probably have to be improved.
  *
+ * The exported secondary production cuts are converted to the per-material
+ * energy thresholds used as \c PhysicsParams::Input::production_cuts . The
+ * materials assigned to geometry volumes are listed in \c used_materials so
+ * that physics tables can be restricted to them.
+ *
  * Material and volume information are stored in a GdmlGeometryMap object.
  * The GdmlGeometryMap::mat_id value returned from a given vol_id represents
  * the position of said material in the ImportPhysicsTable vectors:
@@ -61,6 +67,8 @@ class RootImporter
         std::vector<ImportProcess>       processes;
         std::shared_ptr<GdmlGeometryMap> geometry;
         std::shared_ptr<MaterialParams>  material_params;
+        PhysicsParams::ProductionCuts    production_cuts;
+        PhysicsParams::VecMaterialId     used_materials;
     };
 
   public:
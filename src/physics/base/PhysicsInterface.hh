@@ -10,6 +10,7 @@
 #include "base/Array.hh"
 #include "base/Collection.hh"
 #include "Types.hh"
+#include "physics/grid/UniformGridInterface.hh"
 #include "physics/grid/XsGridInterface.hh"
 #include "physics/em/detail/LivermorePE.hh"
 #include "physics/em/detail/EPlusGG.hh"
@@ -52,11 +53,17 @@ using ValueGridArray = Array<T, size_type(ValueGridType::size_)>;
  * models as a function of energy. The ModelGroup represents this with an
  * energy grid, and each cell of the grid corresponding to a particular
  * ModelId.
+ *
+ * When more than one model applies, an optional uniform log-energy lookup
+ * table maps each lookup bin to the lowest model cell it intersects so that
+ * model selection doesn't require a binary search.
  */
 struct ModelGroup
 {
     ItemRange<real_type> energy; //!< Energy grid bounds [MeV]
     ItemRange<ModelId>   model;  //!< Corresponding models
+    UniformGridData      log_lookup;   //!< Uniform lookup grid (optional)
+    ItemRange<size_type> lookup_index; //!< Model index for each lookup bin
 
     //! True if assigned
     explicit CELER_FUNCTION operator bool() const
@@ -92,12 +99,17 @@ struct ValueTable
  * a ParticleProcessId. So the cross sections for ParticleProcessId{2} would
  * be \code tables[size_type(ValueGridType::macro_xs)][2] \endcode. This
  * awkward access is encapsulated by the PhysicsTrackView.
+ *
+ * The optional majorant is an upper bound on the total macroscopic cross
+ * section over all materials, used for Woodcock tracking of particles that
+ * have no continuous energy loss.
  */
 struct ProcessGroup
 {
     ItemRange<ProcessId> processes; //!< Processes that apply [ppid]
     ValueGridArray<ItemRange<ValueTable>> tables; //!< [vgt][ppid]
-    ItemRange<ModelGroup> models; //!< Model applicability [ppid]
+    ItemRange<ModelGroup> models;      //!< Model applicability [ppid]
+    ValueGridId           majorant_xs; //!< Majorant over materials (optional)
 
     //! True if assigned and valid
     explicit CELER_FUNCTION operator bool() const
@@ -115,6 +127,10 @@ struct ProcessGroup
 //---------------------------------------------------------------------------//
 /*!
  * Model data for special hardwired cases (on-the-fly xs calculations).
+ *
+ * If the \c tabulate_hardwired option is enabled, the on-the-fly macroscopic
+ * cross sections are pretabulated for each material, and the "xs" tables are
+ * used in place of the on-the-fly calculation.
  */
 struct HardwiredModels
 {
@@ -123,11 +139,13 @@ struct HardwiredModels
     units::MevEnergy            photoelectric_table_thresh;
     ModelId                     livermore_pe;
     detail::LivermorePEPointers livermore_pe_params;
+    ValueTable                  livermore_pe_xs;
 
     // Positron annihilation
     ProcessId               positron_annihilation;
     ModelId                 eplusgg;
     detail::EPlusGGPointers eplusgg_params;
+    ValueTable              eplusgg_xs;
 };
 
 //---------------------------------------------------------------------------//
@@ -137,6 +155,9 @@ struct HardwiredModels
  * This includes macroscopic cross section, energy loss, and range tables
  * ordered by [particle][process][material][energy].
  *
+ * Optional secondary production thresholds [MeV] are stored as a 2D array
+ * indexed by [material][particle]; if empty, no secondaries are suppressed.
+ *
  * So the first applicable process (ProcessId{0}) for an arbitrary particle
  * (ParticleId{1}) in material 2 (MaterialId{2}) will have the following
  * ID and cross section grid: \code
@@ -153,16 +174,21 @@ struct PhysicsParamsData
     using Items = Collection<T, W, M>;
     template<class T>
     using ParticleItems = Collection<T, W, M, ParticleId>;
+    template<class T>
+    using MaterialItems = Collection<T, W, M, MaterialId>;
 
     // Backend storage
     Items<real_type>            reals;
     Items<ModelId>              model_ids;
+    Items<size_type>            lookup_indices;
     Items<ValueGrid>            value_grids;
     Items<ValueGridId>          value_grid_ids;
     Items<ProcessId>            process_ids;
     Items<ValueTable>           value_tables;
     Items<ModelGroup>           model_groups;
     ParticleItems<ProcessGroup> process_groups;
+    Items<real_type>            production_cuts; //!< [material][particle]
+    MaterialItems<char>         used_materials;  //!< Empty if all are used
 
     HardwiredModels       hardwired;
     ProcessId::size_type  max_particle_processes{};
@@ -188,14 +214,17 @@ struct PhysicsParamsData
     {
         CELER_EXPECT(other);
 
-        reals          = other.reals;
-        model_ids      = other.model_ids;
-        value_grids    = other.value_grids;
-        value_grid_ids = other.value_grid_ids;
-        process_ids    = other.process_ids;
-        value_tables   = other.value_tables;
-        model_groups   = other.model_groups;
-        process_groups = other.process_groups;
+        reals           = other.reals;
+        model_ids       = other.model_ids;
+        lookup_indices  = other.lookup_indices;
+        value_grids     = other.value_grids;
+        value_grid_ids  = other.value_grid_ids;
+        process_ids     = other.process_ids;
+        value_tables    = other.value_tables;
+        model_groups    = other.model_groups;
+        process_groups  = other.process_groups;
+        production_cuts = other.production_cuts;
+        used_materials  = other.used_materials;
 
         hardwired              = other.hardwired;
         max_particle_processes = other.max_particle_processes;
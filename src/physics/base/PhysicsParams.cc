@@ -8,17 +8,29 @@
 #include "PhysicsParams.hh"
 
 #include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
 #include <map>
 #include <tuple>
+#include <utility>
 #include "base/Assert.hh"
+#include "base/ParallelFor.hh"
 #include "base/Range.hh"
 #include "base/VectorUtils.hh"
+#include "comm/Device.hh"
 #include "comm/Logger.hh"
 #include "ParticleParams.hh"
+#include "PhysicsTrackView.hh"
+#include "physics/em/EPlusGGMacroXsCalculator.hh"
 #include "physics/em/EPlusGGModel.hh"
+#include "physics/em/LivermorePEMacroXsCalculator.hh"
 #include "physics/em/LivermorePEModel.hh"
+#include "physics/grid/UniformGrid.hh"
+#include "physics/grid/ValueGridBuilder.hh"
 #include "physics/grid/ValueGridInserter.hh"
 #include "physics/material/MaterialParams.hh"
+#include "physics/material/MaterialView.hh"
 
 namespace celeritas
 {
@@ -38,6 +50,84 @@ const char* to_cstring(ValueGridType grid)
             return "[INVALID]";
     }
 }
+
+//---------------------------------------------------------------------------//
+//! Maximum number of uniform lookup bins for a single model group
+constexpr size_type max_model_lookup_bins = 256;
+
+//! Number of subintervals per majorant bin for finding the maximum xs
+constexpr size_type majorant_subintervals = 8;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct a uniform log-energy lookup table for model selection.
+ *
+ * The lookup bins are at most half the width of the narrowest model cell (in
+ * log space), so each bin (even when extended slightly to absorb roundoff)
+ * contains at most one model boundary. Each bin stores the index of the model
+ * cell containing its (slightly lowered) lower edge.
+ *
+ * The result is empty if only a single model applies or if the model energy
+ * ranges are too disparate for a compact table.
+ */
+std::vector<size_type> build_model_lookup(const std::vector<real_type>& energy,
+                                          UniformGridData* log_lookup)
+{
+    CELER_EXPECT(energy.size() >= 2);
+    CELER_EXPECT(log_lookup);
+    if (energy.size() == 2 || energy.front() <= 0)
+    {
+        // Single model, or lower energy bound can't be log-transformed
+        return {};
+    }
+
+    std::vector<real_type> log_energy(energy.size());
+    std::transform(energy.begin(),
+                   energy.end(),
+                   log_energy.begin(),
+                   [](real_type e) { return std::log(e); });
+
+    real_type min_width = std::numeric_limits<real_type>::infinity();
+    for (auto i : range(log_energy.size() - 1))
+    {
+        min_width = std::min(min_width, log_energy[i + 1] - log_energy[i]);
+    }
+    CELER_ASSERT(min_width > 0);
+
+    real_type num_bins
+        = std::ceil(2 * (log_energy.back() - log_energy.front()) / min_width);
+    if (num_bins > max_model_lookup_bins)
+    {
+        return {};
+    }
+
+    *log_lookup = UniformGridData::from_bounds(
+        log_energy.front(), log_energy.back(), size_type(num_bins) + 1);
+
+    const size_type        max_index = energy.size() - 2;
+    std::vector<size_type> result(static_cast<size_type>(num_bins));
+    for (auto bin : range(result.size()))
+    {
+        // Bias the lower edge downward to guard against roundoff in lookup
+        real_type lower = log_lookup->front
+                          + (bin - real_type(1e-6)) * log_lookup->delta;
+        auto iter
+            = std::upper_bound(log_energy.begin(), log_energy.end(), lower);
+        size_type index = iter == log_energy.begin()
+                              ? 0
+                              : iter - log_energy.begin() - 1;
+        result[bin] = std::min(index, max_index);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+//! Whether tables should be built for the given material
+template<class D>
+bool is_used_material(const D& data, MaterialId mat_id)
+{
+    return data.used_materials.empty() || data.used_materials[mat_id];
+}
 } // namespace
 
 //---------------------------------------------------------------------------//
@@ -60,18 +150,40 @@ PhysicsParams::PhysicsParams(Input inp) : processes_(std::move(inp.processes))
     HostValue host_data;
     this->build_options(inp.options, &host_data);
     this->build_ids(*inp.particles, &host_data);
-    this->build_xs(*inp.materials, &host_data);
+    if (!inp.used_materials.empty())
+    {
+        this->build_used_materials(
+            inp.used_materials, *inp.materials, &host_data);
+    }
+    this->build_xs(inp.options, *inp.materials, &host_data);
+    if (!inp.production_cuts.empty())
+    {
+        this->build_cuts(
+            inp.production_cuts, *inp.particles, *inp.materials, &host_data);
+    }
+    if (inp.options.tabulate_hardwired)
+    {
+        this->build_hardwired_xs(inp.options, *inp.materials, &host_data);
+    }
+    if (inp.options.woodcock)
+    {
+        this->build_majorant_xs(
+            inp.options, *inp.particles, *inp.materials, &host_data);
+    }
 
     CELER_LOG(debug)
         << "Constructed physics sizes:"
         << "\n  reals: " << host_data.reals.size()
         << "\n  model_ids: " << host_data.model_ids.size()
+        << "\n  lookup_indices: " << host_data.lookup_indices.size()
         << "\n  value_grids: " << host_data.value_grids.size()
         << "\n  value_grid_ids: " << host_data.value_grid_ids.size()
         << "\n  process_ids: " << host_data.process_ids.size()
         << "\n  value_tables: " << host_data.value_tables.size()
         << "\n  model_groups: " << host_data.model_groups.size()
-        << "\n  process_groups: " << host_data.process_groups.size();
+        << "\n  process_groups: " << host_data.process_groups.size()
+        << "\n  production_cuts: " << host_data.production_cuts.size()
+        << "\n  used_materials: " << host_data.used_materials.size();
 
     data_ = CollectionMirror<PhysicsParamsData>{std::move(host_data)};
 }
@@ -87,6 +199,15 @@ auto PhysicsParams::processes(ParticleId id) const -> SpanConstProcessId
     return data.process_ids[data.process_groups[id].processes];
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Whether tables were built for the given material.
+ */
+bool PhysicsParams::has_material_tables(MaterialId mat_id) const
+{
+    return is_used_material(this->host_pointers(), mat_id);
+}
+
 //---------------------------------------------------------------------------//
 // HELPER FUNCTIONS
 //---------------------------------------------------------------------------//
@@ -129,11 +250,70 @@ void PhysicsParams::build_options(const Options& opts, HostValue* data) const
     CELER_VALIDATE(
         opts.linear_loss_limit >= 0 && opts.linear_loss_limit <= 1,
         "Non-fractional linear_loss_limit=" << opts.linear_loss_limit);
+    CELER_VALIDATE(opts.hardwired_tolerance > 0,
+                   "Non-positive hardwired_tolerance="
+                       << opts.hardwired_tolerance);
+    CELER_VALIDATE(opts.hardwired_max_size >= 2,
+                   "Invalid hardwired_max_size=" << opts.hardwired_max_size);
+    CELER_VALIDATE(opts.majorant_size >= 2,
+                   "Invalid majorant_size=" << opts.majorant_size);
+    CELER_VALIDATE(opts.majorant_safety >= 1,
+                   "Invalid majorant_safety=" << opts.majorant_safety);
+    CELER_VALIDATE(opts.thinning_tolerance >= 0,
+                   "Negative thinning_tolerance=" << opts.thinning_tolerance);
     data->scaling_min_range = opts.min_range;
     data->scaling_fraction  = opts.max_step_over_range;
     data->linear_loss_limit = opts.linear_loss_limit;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct the secondary production threshold table.
+ *
+ * Thresholds are stored for every [material][particle] pair; particles that
+ * aren't in the input (or aren't defined in this problem) have a zero
+ * threshold.
+ */
+void PhysicsParams::build_cuts(const ProductionCuts& cuts,
+                               const ParticleParams& particles,
+                               const MaterialParams& mats,
+                               HostValue*            data) const
+{
+    CELER_EXPECT(!cuts.empty());
+    CELER_EXPECT(data);
+
+    const size_type        num_particles = particles.size();
+    std::vector<real_type> temp_cuts(mats.size() * num_particles, 0);
+    for (const auto& pdg_cuts : cuts)
+    {
+        ParticleId particle_id = particles.find(pdg_cuts.first);
+        if (!particle_id)
+        {
+            CELER_LOG(debug) << "Ignoring production cuts for PDG number "
+                             << pdg_cuts.first.get()
+                             << ", which is not a defined particle";
+            continue;
+        }
+
+        const VecMevEnergy& energies = pdg_cuts.second;
+        CELER_VALIDATE(energies.size() == mats.size(),
+                       "Production cuts for particle '"
+                           << particles.id_to_label(particle_id) << "' have "
+                           << energies.size() << " materials (expected "
+                           << mats.size() << ")");
+        for (auto mat_idx : range(energies.size()))
+        {
+            real_type energy = energies[mat_idx].value();
+            CELER_VALIDATE(energy >= 0,
+                           "Negative production cut " << energy << " MeV");
+            temp_cuts[mat_idx * num_particles + particle_id.get()] = energy;
+        }
+    }
+
+    make_builder(&data->production_cuts)
+        .insert_back(temp_cuts.begin(), temp_cuts.end());
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct particle -> process -> model mappings.
@@ -174,6 +354,7 @@ void PhysicsParams::build_ids(const ParticleParams& particles,
     auto process_ids    = make_builder(&data->process_ids);
     auto model_groups   = make_builder(&data->model_groups);
     auto model_ids      = make_builder(&data->model_ids);
+    auto lookup_indices = make_builder(&data->lookup_indices);
     auto reals          = make_builder(&data->reals);
 
     process_groups.reserve(particle_models.size());
@@ -231,6 +412,15 @@ void PhysicsParams::build_ids(const ParticleParams& particles,
                                               temp_energy_grid.end());
             mgroup.model  = model_ids.insert_back(temp_models.begin(),
                                                  temp_models.end());
+
+            // Construct uniform lookup for fast model selection
+            auto temp_lookup
+                = build_model_lookup(temp_energy_grid, &mgroup.log_lookup);
+            if (!temp_lookup.empty())
+            {
+                mgroup.lookup_index = lookup_indices.insert_back(
+                    temp_lookup.begin(), temp_lookup.end());
+            }
             CELER_ASSERT(mgroup);
             temp_model_groups.push_back(mgroup);
         }
@@ -255,7 +445,9 @@ void PhysicsParams::build_ids(const ParticleParams& particles,
             data->hardwired.photoelectric              = process_id;
             data->hardwired.photoelectric_table_thresh = units::MevEnergy{0.2};
             data->hardwired.livermore_pe               = ModelId{model_idx};
-            data->hardwired.livermore_pe_params = pe_model->device_pointers();
+            data->hardwired.livermore_pe_params
+                = celeritas::device() ? pe_model->device_pointers()
+                                      : pe_model->host_pointers();
         }
         else if (auto* epgg_model = dynamic_cast<const EPlusGGModel*>(&model))
         {
@@ -268,15 +460,43 @@ void PhysicsParams::build_ids(const ParticleParams& particles,
     CELER_ENSURE(*data);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Mark the materials whose tables should be built.
+ */
+void PhysicsParams::build_used_materials(const VecMaterialId&  used,
+                                         const MaterialParams& mats,
+                                         HostValue*            data) const
+{
+    CELER_EXPECT(!used.empty());
+
+    std::vector<char> temp_used(mats.size(), 0);
+    for (MaterialId mat_id : used)
+    {
+        CELER_VALIDATE(mat_id < mats.size(),
+                       "Invalid used material ID " << mat_id.unchecked_get());
+        temp_used[mat_id.get()] = 1;
+    }
+    make_builder(&data->used_materials)
+        .insert_back(temp_used.begin(), temp_used.end());
+
+    CELER_LOG(debug) << "Building physics tables for "
+                     << std::count(temp_used.begin(), temp_used.end(), 1)
+                     << " of " << mats.size() << " materials";
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct cross section data.
  */
-void PhysicsParams::build_xs(const MaterialParams& mats, HostValue* data) const
+void PhysicsParams::build_xs(const Options&        opts,
+                             const MaterialParams& mats,
+                             HostValue*            data) const
 {
     CELER_EXPECT(*data);
 
     using UPGridBuilder = Process::UPConstGridBuilder;
+    using Thinned       = ValueGridBuilder::Thinned;
 
     ValueGridInserter insert_grid(&data->reals, &data->value_grids);
     auto              value_tables   = make_builder(&data->value_tables);
@@ -286,11 +506,9 @@ void PhysicsParams::build_xs(const MaterialParams& mats, HostValue* data) const
         return builder ? builder->build(insert_grid) : ValueGridId{};
     };
 
-    Applicability applic;
+    const size_type num_mats = mats.size();
     for (auto particle_id : range(ParticleId(data->process_groups.size())))
     {
-        applic.particle = particle_id;
-
         // Processes for this particle
         ProcessGroup& process_group = data->process_groups[particle_id];
         Span<const ProcessId> processes
@@ -299,6 +517,47 @@ void PhysicsParams::build_xs(const MaterialParams& mats, HostValue* data) const
             = data->model_groups[process_group.models];
         CELER_ASSERT(processes.size() == model_groups.size());
 
+        // Construct step limit builders for every process and material in
+        // parallel, since building them may require expensive preprocessing
+        std::vector<Process::StepLimitBuilders> builders(processes.size()
+                                                         * num_mats);
+        std::vector<ValueGridArray<Thinned>>    thinned(
+            opts.thinning_tolerance > 0 ? builders.size() : 0);
+        parallel_for(builders.size(), [&](size_type i) {
+            const size_type pp_idx = i / num_mats;
+            if (!is_used_material(*data, MaterialId{i % num_mats}))
+                return;
+
+            // Get energy bounds for this process
+            Span<const real_type> energy_grid
+                = data->reals[model_groups[pp_idx].energy];
+            Applicability applic;
+            applic.particle = particle_id;
+            applic.material = MaterialId{i % num_mats};
+            applic.lower    = Applicability::Energy{energy_grid.front()};
+            applic.upper    = Applicability::Energy{energy_grid.back()};
+            CELER_ASSERT(applic.lower < applic.upper);
+
+            builders[i] = this->process(processes[pp_idx]).step_limits(applic);
+
+            if (thinned.empty())
+                return;
+
+            // Remove grid points that aren't needed for interpolation
+            for (auto vgt : range(size_type(ValueGridType::size_)))
+            {
+                UPGridBuilder& builder = builders[i][vgt];
+                if (!builder)
+                    continue;
+
+                thinned[i][vgt] = builder->thin(opts.thinning_tolerance);
+                if (thinned[i][vgt].builder)
+                {
+                    builder = std::move(thinned[i][vgt].builder);
+                }
+            }
+        });
+
         // Material-dependent physics tables, one per particle-process
         ValueGridArray<std::vector<ValueTable>> temp_tables;
         for (auto& vec : temp_tables)
@@ -306,36 +565,36 @@ void PhysicsParams::build_xs(const MaterialParams& mats, HostValue* data) const
             vec.resize(processes.size());
         }
 
-        // Loop over per-particle processes
+        // Loop over per-particle processes, inserting grids serially so that
+        // the ordering of the data is deterministic
         for (auto pp_idx : range(processes.size()))
         {
-            // Get energy bounds for this process
-            Span<const real_type> energy_grid
-                = data->reals[model_groups[pp_idx].energy];
-            applic.lower = Applicability::Energy{energy_grid.front()};
-            applic.upper = Applicability::Energy{energy_grid.back()};
-            CELER_ASSERT(applic.lower < applic.upper);
-
             const Process& proc = this->process(processes[pp_idx]);
 
             // Grid IDs for each grid type, each material
             ValueGridArray<std::vector<ValueGridId>> temp_grid_ids;
             for (auto& vec : temp_grid_ids)
             {
-                vec.resize(mats.size());
+                vec.resize(num_mats);
             }
 
             // Loop over materials
-            for (auto mat_id : range(MaterialId{mats.size()}))
+            for (auto mat_idx : range(num_mats))
             {
-                applic.material = mat_id;
+                if (!is_used_material(*data, MaterialId{mat_idx}))
+                {
+                    // Leave the grids for unused materials invalid
+                    continue;
+                }
 
-                // Construct step limit builders
-                auto builders = proc.step_limits(applic);
+                // Positron annihilation cross sections are always hardwired
+                const auto& limits = builders[pp_idx * num_mats + mat_idx];
                 CELER_VALIDATE(
-                    std::any_of(builders.begin(),
-                                builders.end(),
-                                [](const UPGridBuilder& p) { return bool(p); }),
+                    processes[pp_idx] == data->hardwired.positron_annihilation
+                        || std::any_of(
+                            limits.begin(),
+                            limits.end(),
+                            [](const UPGridBuilder& p) { return bool(p); }),
                     "Process '" << proc.label()
                                 << "' has neither interaction nor energy "
                                    "loss");
@@ -343,8 +602,7 @@ void PhysicsParams::build_xs(const MaterialParams& mats, HostValue* data) const
                 // Construct grids
                 for (auto vgt : range(size_type(ValueGridType::size_)))
                 {
-                    temp_grid_ids[vgt][mat_id.get()]
-                        = build_grid(builders[vgt]);
+                    temp_grid_ids[vgt][mat_idx] = build_grid(limits[vgt]);
                 }
             }
 
@@ -362,6 +620,33 @@ void PhysicsParams::build_xs(const MaterialParams& mats, HostValue* data) const
                     continue;
                 }
 
+                if (!thinned.empty())
+                {
+                    // Report the compression of this table
+                    size_type input_size  = 0;
+                    size_type output_size = 0;
+                    real_type max_error   = 0;
+                    for (auto mat_idx : range(num_mats))
+                    {
+                        const Thinned& t
+                            = thinned[pp_idx * num_mats + mat_idx][vgt];
+                        input_size += t.input_size;
+                        output_size += t.output_size;
+                        max_error = std::max(max_error, t.max_error);
+                    }
+                    if (output_size > 0)
+                    {
+                        CELER_LOG(debug)
+                            << "Thinned " << to_cstring(ValueGridType(vgt))
+                            << " for process " << proc.label() << " from "
+                            << input_size << " to " << output_size
+                            << " points (compression ratio "
+                            << real_type(input_size) / output_size
+                            << ") with a maximum relative error of "
+                            << max_error;
+                    }
+                }
+
                 // Construct value grid table
                 ValueTable& temp_table = temp_tables[vgt][pp_idx];
                 temp_table.material    = value_grid_ids.insert_back(
@@ -377,6 +662,300 @@ void PhysicsParams::build_xs(const MaterialParams& mats, HostValue* data) const
                 temp_tables[vgt].begin(), temp_tables[vgt].end());
         }
     }
+
+    if (insert_grid.bytes_saved() > 0)
+    {
+        CELER_LOG(debug) << "Reused identical physics tables, saving "
+                         << insert_grid.bytes_saved() << " bytes";
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct macroscopic cross section tables for hardwired models.
+ *
+ * The on-the-fly calculators are tabulated for each material on a uniform
+ * log-energy grid that's refined until the estimated relative interpolation
+ * error is within the user tolerance. The photoelectric cross sections are
+ * only tabulated up to the table threshold and are constant below the lowest
+ * binding energy; absorption edges inside that range are discontinuities, so
+ * the tolerance may not be met for high-Z materials before the grid reaches
+ * the maximum size.
+ */
+void PhysicsParams::build_hardwired_xs(const Options&        opts,
+                                       const MaterialParams& mats,
+                                       HostValue*            data) const
+{
+    CELER_EXPECT(*data);
+
+    using CalcValue   = ValueGridLogBuilder::CalcValue;
+    using MakeCalcXs  = std::function<CalcValue(const MaterialView&)>;
+    using EnergyRange = std::pair<real_type, real_type>;
+
+    ValueGridInserter insert_grid(&data->reals, &data->value_grids);
+    auto              value_grid_ids = make_builder(&data->value_grid_ids);
+
+    // Tabulate the cross sections of a hardwired model for every material
+    auto build_table = [&](const Model&      model,
+                           EnergyRange       energy,
+                           const MakeCalcXs& make_calc_xs) -> ValueTable {
+        // Refine the grids in parallel
+        std::vector<ValueGridLogBuilder::UPLogBuilder> builders(mats.size());
+        std::vector<real_type>                        errors(mats.size(), 0);
+        parallel_for(mats.size(), [&](size_type i) {
+            if (!is_used_material(*data, MaterialId{i}))
+                return;
+
+            MaterialView material(mats.host_pointers(), MaterialId{i});
+            builders[i] = ValueGridLogBuilder::from_function(
+                energy.first,
+                energy.second,
+                make_calc_xs(material),
+                opts.hardwired_tolerance,
+                opts.hardwired_max_size,
+                &errors[i]);
+        });
+
+        std::vector<ValueGridId> temp_grid_ids(mats.size());
+        real_type                max_error = 0;
+        size_type                max_size  = 0;
+        for (auto mat_id : range(MaterialId{mats.size()}))
+        {
+            const auto& builder = builders[mat_id.get()];
+            if (!builder)
+                continue;
+
+            const real_type error = errors[mat_id.get()];
+            if (error > opts.hardwired_tolerance)
+            {
+                CELER_LOG(warning)
+                    << "Tabulated " << model.label()
+                    << " cross sections in material '"
+                    << mats.id_to_label(mat_id)
+                    << "' have an estimated relative error of " << error
+                    << " (tolerance is " << opts.hardwired_tolerance << ")";
+            }
+            max_error = std::max(max_error, error);
+            max_size  = std::max(max_size, builder->value().size());
+            temp_grid_ids[mat_id.get()] = builder->build(insert_grid);
+        }
+        CELER_LOG(debug) << "Tabulated " << model.label()
+                         << " cross sections with at most " << max_size
+                         << " points per material and an estimated "
+                            "relative error of "
+                         << max_error;
+
+        ValueTable result;
+        result.material = value_grid_ids.insert_back(temp_grid_ids.begin(),
+                                                     temp_grid_ids.end());
+        CELER_ENSURE(result);
+        return result;
+    };
+
+    for (const auto& model_process : models_)
+    {
+        const Model& model = *model_process.first;
+        if (auto* pe_model = dynamic_cast<const LivermorePEModel*>(&model))
+        {
+            const detail::LivermorePEPointers pe_data
+                = pe_model->host_pointers();
+
+            // Cross sections are constant below the lowest binding energy
+            EnergyRange energy{
+                std::numeric_limits<real_type>::infinity(),
+                data->hardwired.photoelectric_table_thresh.value()};
+            for (const LivermoreElement& el : pe_data.data.elements)
+            {
+                energy.first = std::min(
+                    energy.first, el.shells.back().binding_energy.value());
+            }
+            CELER_ASSERT(energy.first < energy.second);
+
+            data->hardwired.livermore_pe_xs = build_table(
+                model, energy, [&pe_data](const MaterialView& material) {
+                    if (material.num_elements() == 0)
+                    {
+                        return CalcValue(
+                            [](real_type) { return real_type(0); });
+                    }
+                    LivermorePEMacroXsCalculator calc_xs(pe_data, material);
+                    return CalcValue([calc_xs](real_type e) {
+                        return calc_xs(units::MevEnergy{e});
+                    });
+                });
+        }
+        else if (auto* epgg_model = dynamic_cast<const EPlusGGModel*>(&model))
+        {
+            const detail::EPlusGGPointers epgg_data
+                = epgg_model->device_pointers();
+
+            // Cross sections are constant below 1 eV
+            EnergyRange energy{1e-6, 0};
+            for (const Applicability& applic : model.applicability())
+            {
+                energy.second = std::max(energy.second, applic.upper.value());
+            }
+            CELER_ASSERT(energy.first < energy.second);
+
+            data->hardwired.eplusgg_xs = build_table(
+                model, energy, [&epgg_data](const MaterialView& material) {
+                    EPlusGGMacroXsCalculator calc_xs(epgg_data, material);
+                    return CalcValue([calc_xs](real_type e) {
+                        return calc_xs(units::MevEnergy{e});
+                    });
+                });
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct majorant cross section tables for Woodcock tracking.
+ *
+ * A majorant is only built for particles that have discrete interactions but
+ * no energy loss or range tables, since the energy of the track must be
+ * constant between collisions. The total macroscopic cross section (using the
+ * same calculation as the transport step) is evaluated for every material at
+ * several points in each bin of a uniform log-energy grid spanning the
+ * particle's models. Each grid point stores the larger maximum of its two
+ * adjacent bins, so the linearly interpolated majorant bounds the sampled
+ * cross sections everywhere in the bin. The result is scaled by the \c
+ * majorant_safety option to cover features between the sampled energies.
+ */
+void PhysicsParams::build_majorant_xs(const Options&        opts,
+                                      const ParticleParams& particles,
+                                      const MaterialParams& mats,
+                                      HostValue*            data) const
+{
+    CELER_EXPECT(*data);
+
+    // Evaluate cross sections on the host with a temporary track view
+    PhysicsParamsData<Ownership::const_reference, MemSpace::host> params;
+    params = *data;
+    for (const auto& model_process : models_)
+    {
+        if (auto* pe_model = dynamic_cast<const LivermorePEModel*>(
+                model_process.first.get()))
+        {
+            params.hardwired.livermore_pe_params = pe_model->host_pointers();
+        }
+    }
+    PhysicsStateData<Ownership::value, MemSpace::host> state;
+    resize(&state, params, 1);
+    PhysicsStateData<Ownership::reference, MemSpace::host> state_ref;
+    state_ref = state;
+
+    // Tabulate all majorants before inserting them, since insertion may
+    // invalidate the temporary references
+    struct TempMajorant
+    {
+        ParticleId             particle;
+        UniformGridData        log_energy;
+        std::vector<real_type> xs;
+    };
+    std::vector<TempMajorant> majorants;
+    std::vector<real_type>    bin_max(opts.majorant_size - 1);
+    for (auto particle_id : range(ParticleId(data->process_groups.size())))
+    {
+        const ProcessGroup& process_group = data->process_groups[particle_id];
+        auto has_tables = [&](ValueGridType vgt) {
+            auto tables = data->value_tables[process_group.tables[int(vgt)]];
+            return std::any_of(tables.begin(),
+                               tables.end(),
+                               [](const ValueTable& t) { return bool(t); });
+        };
+        if (has_tables(ValueGridType::energy_loss)
+            || has_tables(ValueGridType::range))
+        {
+            // Continuous energy loss changes the cross section along a step
+            continue;
+        }
+
+        // Get energy bounds over all processes
+        real_type emin = std::numeric_limits<real_type>::infinity();
+        real_type emax = 0;
+        for (const ModelGroup& mg : data->model_groups[process_group.models])
+        {
+            Span<const real_type> energy = data->reals[mg.energy];
+            emin = std::min(emin, energy.front());
+            emax = std::max(emax, energy.back());
+        }
+        if (!(emin > 0))
+        {
+            CELER_LOG(warning) << "Not building a majorant cross section for "
+                                  "particle '"
+                               << particles.id_to_label(particle_id)
+                               << "': lowest model energy is zero";
+            continue;
+        }
+
+        TempMajorant majorant;
+        majorant.particle   = particle_id;
+        majorant.log_energy = UniformGridData::from_bounds(
+            std::log(emin), std::log(emax), opts.majorant_size);
+        const UniformGrid loge_grid(majorant.log_energy);
+        const real_type   sub_delta = majorant.log_energy.delta
+                                    / majorant_subintervals;
+
+        // Find the maximum total cross section over materials in each bin
+        parallel_for(bin_max.size(), [&](size_type bin) {
+            real_type max_xs = 0;
+            for (auto mat_id : range(MaterialId{mats.size()}))
+            {
+                if (!is_used_material(*data, mat_id))
+                    continue;
+
+                MaterialView     material(mats.host_pointers(), mat_id);
+                PhysicsTrackView phys(
+                    params, state_ref, particle_id, mat_id, ThreadId{0});
+                auto calc_total_xs = [&](real_type loge) {
+                    units::MevEnergy energy{std::exp(loge)};
+                    real_type        result = 0;
+                    for (auto ppid : range(
+                             ParticleProcessId{phys.num_particle_processes()}))
+                    {
+                        result += phys.calc_xs(ppid, material, energy);
+                    }
+                    return result;
+                };
+
+                max_xs = std::max(max_xs, calc_total_xs(loge_grid[bin + 1]));
+                for (auto i : range(majorant_subintervals))
+                {
+                    max_xs = std::max(
+                        max_xs, calc_total_xs(loge_grid[bin] + i * sub_delta));
+                }
+            }
+            bin_max[bin] = opts.majorant_safety * max_xs;
+        });
+
+        // Bound both adjacent bins at each grid point
+        majorant.xs.resize(opts.majorant_size);
+        majorant.xs.front() = bin_max.front();
+        majorant.xs.back()  = bin_max.back();
+        for (auto i : range<size_type>(1, bin_max.size()))
+        {
+            majorant.xs[i] = std::max(bin_max[i - 1], bin_max[i]);
+        }
+        if (!(*std::min_element(majorant.xs.begin(), majorant.xs.end()) > 0))
+        {
+            CELER_LOG(warning) << "Not building a majorant cross section for "
+                                  "particle '"
+                               << particles.id_to_label(particle_id)
+                               << "': total cross section vanishes";
+            continue;
+        }
+        majorants.push_back(std::move(majorant));
+    }
+
+    ValueGridInserter insert_grid(&data->reals, &data->value_grids);
+    for (const TempMajorant& majorant : majorants)
+    {
+        data->process_groups[majorant.particle].majorant_xs
+            = insert_grid(majorant.log_energy, make_span(majorant.xs));
+        CELER_LOG(debug) << "Built majorant cross section for particle '"
+                         << particles.id_to_label(majorant.particle) << "'";
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -7,12 +7,14 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <map>
 #include <memory>
 #include <vector>
 #include "base/CollectionMirror.hh"
 #include "base/Types.hh"
 #include "base/Units.hh"
 #include "Model.hh"
+#include "PDGNumber.hh"
 #include "Process.hh"
 #include "PhysicsInterface.hh"
 #include "Types.hh"
@@ -43,6 +45,37 @@ class ParticleParams;
  * - \c linear_loss_limit: if the mean energy loss along a step is greater than
  *   this fractional value of the pre-step kinetic energy, recalculate the
  *   energy loss.
+ * - \c tabulate_hardwired: replace the on-the-fly macroscopic cross section
+ *   calculations of hardwired models (photoelectric below the table threshold
+ *   and positron annihilation) with per-material tables.
+ * - \c hardwired_tolerance: maximum relative interpolation error (estimated at
+ *   bin midpoints) for the hardwired cross section tables.
+ * - \c hardwired_max_size: maximum number of grid points in each hardwired
+ *   cross section table.
+ * - \c woodcock: for each particle type without continuous energy loss (i.e.
+ *   photons), tabulate a majorant cross section over all materials to allow
+ *   Woodcock tracking.
+ * - \c majorant_size: number of log-energy grid points in each majorant
+ *   table.
+ * - \c majorant_safety: multiplicative factor applied to the tabulated
+ *   majorant to bound sharp features (e.g. absorption edges) that fall
+ *   between the sampled energies.
+ * - \c thinning_tolerance: if nonzero, remove points from the process tables
+ *   (e.g. those imported from Geant4) as long as linear interpolation
+ *   reproduces each removed point to within this relative error.
+ *
+ * The optional \c production_cuts input gives, for each secondary particle
+ * type (by PDG number), the production threshold energy in every material.
+ * These are typically converted from the Geant4 range cuts exported with the
+ * materials. Interactors deposit secondaries below the threshold locally
+ * rather than allocating and transporting them. Particle types without an
+ * entry have no threshold.
+ *
+ * The optional \c used_materials input lists the materials that are actually
+ * present in the geometry (e.g. from the volume-to-material map of the
+ * imported geometry). Tables are only built for those materials, and
+ * accessing the tables of any other material is an error. If the list is
+ * empty, tables are built for all materials.
  */
 class PhysicsParams
 {
@@ -54,6 +87,9 @@ class PhysicsParams
     using SPConstProcess     = std::shared_ptr<const Process>;
     using VecProcess         = std::vector<SPConstProcess>;
     using SpanConstProcessId = Span<const ProcessId>;
+    using VecMevEnergy       = std::vector<units::MevEnergy>;
+    using ProductionCuts     = std::map<PDGNumber, VecMevEnergy>;
+    using VecMaterialId      = std::vector<MaterialId>;
     using HostRef
         = PhysicsParamsData<Ownership::const_reference, MemSpace::host>;
     using DeviceRef
@@ -66,6 +102,13 @@ class PhysicsParams
         real_type min_range           = 1 * units::millimeter; //!< rho_R
         real_type max_step_over_range = 0.2;                   //!< alpha_r
         real_type linear_loss_limit   = 0.01;                  //!< xi
+        bool      tabulate_hardwired  = false;
+        real_type hardwired_tolerance = 1e-3;
+        size_type hardwired_max_size  = 4096;
+        bool      woodcock            = false;
+        size_type majorant_size       = 256;
+        real_type majorant_safety     = 1.05;
+        real_type thinning_tolerance  = 0;
     };
 
     //! Physics parameter construction arguments
@@ -74,6 +117,8 @@ class PhysicsParams
         SPConstParticles particles;
         SPConstMaterials materials;
         VecProcess       processes;
+        ProductionCuts   production_cuts; //!< [pdg][material] (optional)
+        VecMaterialId    used_materials;  //!< Tabulated materials (optional)
 
         Options options;
     };
@@ -105,6 +150,9 @@ class PhysicsParams
     // Get the processes that apply to a particular particle
     SpanConstProcessId processes(ParticleId) const;
 
+    // Whether tables were built for the given material
+    bool has_material_tables(MaterialId) const;
+
     //! Access material properties on the host
     const HostRef& host_pointers() const { return data_.host(); }
 
@@ -127,7 +175,23 @@ class PhysicsParams
     VecModel build_models() const;
     void     build_options(const Options& opts, HostValue* data) const;
     void     build_ids(const ParticleParams& particles, HostValue* data) const;
-    void     build_xs(const MaterialParams& mats, HostValue* data) const;
+    void     build_used_materials(const VecMaterialId&  used,
+                                  const MaterialParams& mats,
+                                  HostValue*            data) const;
+    void     build_xs(const Options&        opts,
+                      const MaterialParams& mats,
+                      HostValue*            data) const;
+    void     build_cuts(const ProductionCuts& cuts,
+                        const ParticleParams& particles,
+                        const MaterialParams& mats,
+                        HostValue*            data) const;
+    void     build_hardwired_xs(const Options&        opts,
+                                const MaterialParams& mats,
+                                HostValue*            data) const;
+    void     build_majorant_xs(const Options&        opts,
+                               const ParticleParams& particles,
+                               const MaterialParams& mats,
+                               HostValue*            data) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -27,6 +27,17 @@ inline CELER_FUNCTION ParticleTrackView::Energy
                                        const PhysicsTrackView&  physics,
                                        real_type                step_length);
 
+inline CELER_FUNCTION real_type
+calc_majorant_step(const ParticleTrackView& particle,
+                   PhysicsTrackView&        physics);
+
+template<class Engine>
+inline CELER_FUNCTION bool
+sample_real_collision(const MaterialTrackView& material,
+                      const ParticleTrackView& particle,
+                      PhysicsTrackView&        physics,
+                      Engine&                  rng);
+
 template<class Engine>
 inline CELER_FUNCTION ModelId select_model(const ParticleTrackView& particle,
                                            const PhysicsTrackView&  physics,
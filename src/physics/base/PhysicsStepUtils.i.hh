@@ -14,6 +14,8 @@
 #include "physics/grid/InverseRangeCalculator.hh"
 #include "physics/grid/RangeCalculator.hh"
 #include "physics/grid/XsCalculator.hh"
+#include "random/distributions/ExponentialDistribution.hh"
+#include "random/distributions/GenerateCanonical.hh"
 #include "Types.hh"
 
 namespace celeritas
@@ -36,27 +38,12 @@ calc_tabulated_physics_step(const MaterialTrackView& material,
     // type) and calculate cross section and particle range.
     real_type total_macro_xs = 0;
     real_type min_range      = inf;
+    auto      material_view  = material.material_view();
     for (auto ppid : range(ParticleProcessId{physics.num_particle_processes()}))
     {
-        real_type               process_xs = 0;
-        if (auto model_id = physics.hardwired_model(ppid, particle.energy()))
-        {
-            // Calculate macroscopic cross section on the fly for special
-            // hardwired processes.
-            auto material_view = material.material_view();
-            process_xs         = physics.calc_xs_otf(
-                model_id, material_view, particle.energy());
-            total_macro_xs += process_xs;
-        }
-        else if (auto grid_id = physics.value_grid(VGT::macro_xs, ppid))
-        {
-            // Calculate macroscopic cross section for this process, then
-            // accumulate it into the total cross section and save the cross
-            // section for later.
-            auto calc_xs = physics.make_calculator<XsCalculator>(grid_id);
-            process_xs = calc_xs(particle.energy());
-            total_macro_xs += process_xs;
-        }
+        real_type process_xs
+            = physics.calc_xs(ppid, material_view, particle.energy());
+        total_macro_xs += process_xs;
         physics.per_process_xs(ppid) = process_xs;
 
         if (auto grid_id = physics.value_grid(VGT::range, ppid))
@@ -79,6 +66,98 @@ calc_tabulated_physics_step(const MaterialTrackView& material,
     return min(min_range, physics.interaction_mfp() / total_macro_xs);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the distance to the next tentative collision for Woodcock tracking.
+ *
+ * In Woodcock (delta) tracking, the distance to collision is sampled using a
+ * majorant cross section that bounds the total cross section of every
+ * material. The track can then be moved the full distance without computing
+ * the distance to the next geometry boundary: only the material at the
+ * post-step point is needed to decide (with \c sample_real_collision) whether
+ * the collision is real or fictitious. This is only valid for particles
+ * without continuous energy loss, which have a majorant table if the \c
+ * woodcock physics option is enabled.
+ *
+ * The majorant cross section is saved as the track's macroscopic cross
+ * section until the collision is sampled.
+ *
+ * \code
+    real_type step = calc_majorant_step(particle, physics);
+    geo.move_and_relocate(step);
+    if (geo.is_outside()) { ... }
+    // ... update the material from the new volume ...
+    if (sample_real_collision(material, particle, physics, rng))
+    {
+        // Select a model and interact
+    }
+   \endcode
+ */
+inline CELER_FUNCTION real_type
+calc_majorant_step(const ParticleTrackView& particle,
+                   PhysicsTrackView&        physics)
+{
+    CELER_EXPECT(physics.has_interaction_mfp());
+    CELER_EXPECT(physics.majorant_grid());
+
+    auto calc_xs = physics.make_calculator<XsCalculator>(
+        physics.majorant_grid());
+    real_type majorant_xs = calc_xs(particle.energy());
+    CELER_ASSERT(majorant_xs > 0);
+    physics.macro_xs(majorant_xs);
+
+    return physics.interaction_mfp() / majorant_xs;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample whether a tentative Woodcock collision is real.
+ *
+ * The true per-process cross sections are calculated in the current material
+ * and the collision is accepted with the probability of the ratio of the
+ * total cross section to the majorant. If the collision is real, the total
+ * cross section replaces the majorant, and the saved per-process cross
+ * sections can be used to select the interacting process. Otherwise, a new
+ * number of mean free paths to the next tentative collision is sampled.
+ *
+ * The majorant must bound the true cross section, otherwise collisions near
+ * sharp features such as absorption edges would be undersampled: increase the
+ * \c majorant_size or \c majorant_safety physics options if the assertion
+ * fails.
+ */
+template<class Engine>
+inline CELER_FUNCTION bool
+sample_real_collision(const MaterialTrackView& material,
+                      const ParticleTrackView& particle,
+                      PhysicsTrackView&        physics,
+                      Engine&                  rng)
+{
+    CELER_EXPECT(physics.majorant_grid());
+
+    const real_type majorant_xs    = physics.macro_xs();
+    real_type       total_macro_xs = 0;
+    auto            material_view  = material.material_view();
+    for (auto ppid : range(ParticleProcessId{physics.num_particle_processes()}))
+    {
+        real_type process_xs
+            = physics.calc_xs(ppid, material_view, particle.energy());
+        total_macro_xs += process_xs;
+        physics.per_process_xs(ppid) = process_xs;
+    }
+    CELER_ASSERT(total_macro_xs <= majorant_xs);
+
+    if (generate_canonical(rng) * majorant_xs < total_macro_xs)
+    {
+        // Real collision
+        physics.macro_xs(total_macro_xs);
+        return true;
+    }
+
+    // Fictitious collision: continue along the same direction
+    physics.interaction_mfp(ExponentialDistribution<real_type>{}(rng));
+    return false;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Calculate mean energy loss over the given "true" step length.
@@ -88,6 +88,9 @@ class PhysicsTrackView
     // Process ID for the given within-particle process index
     inline CELER_FUNCTION ProcessId process(ParticleProcessId) const;
 
+    // Whether tables were built for the current material
+    inline CELER_FUNCTION bool has_material_tables() const;
+
     // Get table, null if not present for this particle/material/type
     inline CELER_FUNCTION ValueGridId value_grid(ValueGridType table,
                                                  ParticleProcessId) const;
@@ -96,6 +99,15 @@ class PhysicsTrackView
     inline CELER_FUNCTION ModelId hardwired_model(ParticleProcessId ppid,
                                                   MevEnergy energy) const;
 
+    // Get tabulated hardwired cross sections, null if not present
+    inline CELER_FUNCTION ValueGridId hardwired_value_grid(ModelId model) const;
+
+    // Get majorant cross sections over all materials, null if not present
+    inline CELER_FUNCTION ValueGridId majorant_grid() const;
+
+    // Secondary production threshold in the current material
+    inline CELER_FUNCTION MevEnergy production_cut(ParticleId secondary) const;
+
     // Models that apply to the given process ID
     inline CELER_FUNCTION
         ModelFinder make_model_finder(ParticleProcessId) const;
@@ -109,9 +121,14 @@ class PhysicsTrackView
     inline CELER_FUNCTION real_type linear_loss_limit() const;
 
     // Calculate macroscopic cross section on the fly for the given model
-    inline CELER_FUNCTION real_type calc_xs_otf(ModelId       model,
-                                                MaterialView& material,
-                                                MevEnergy     energy) const;
+    inline CELER_FUNCTION real_type calc_xs_otf(ModelId             model,
+                                                const MaterialView& material,
+                                                MevEnergy energy) const;
+
+    // Calculate macroscopic cross section for a process in this material
+    inline CELER_FUNCTION real_type calc_xs(ParticleProcessId   ppid,
+                                            const MaterialView& material,
+                                            MevEnergy           energy) const;
 
     // Construct a grid calculator from a physics table
     template<class T>
@@ -8,6 +8,7 @@
 #include "base/Assert.hh"
 #include "physics/em/EPlusGGMacroXsCalculator.hh"
 #include "physics/em/LivermorePEMacroXsCalculator.hh"
+#include "physics/grid/XsCalculator.hh"
 
 namespace celeritas
 {
@@ -167,6 +168,18 @@ CELER_FUNCTION ProcessId PhysicsTrackView::process(ParticleProcessId ppid) const
     return params_.process_ids[this->process_group().processes[ppid.get()]];
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Whether tables were built for the current material.
+ *
+ * If the physics was constructed with a list of the materials used by the
+ * geometry, tables are only available for those materials.
+ */
+CELER_FUNCTION bool PhysicsTrackView::has_material_tables() const
+{
+    return params_.used_materials.empty() || params_.used_materials[material_];
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Return value grid data for the given table type and process if available.
@@ -184,6 +197,7 @@ CELER_FUNCTION auto PhysicsTrackView::value_grid(ValueGridType     table_type,
 {
     CELER_EXPECT(int(table_type) < int(ValueGridType::size_));
     CELER_EXPECT(ppid < this->num_particle_processes());
+    CELER_EXPECT(this->has_material_tables());
     ValueTableId table_id
         = this->process_group().tables[int(table_type)][ppid.get()];
 
@@ -221,9 +235,80 @@ CELER_FUNCTION ModelId PhysicsTrackView::hardwired_model(ParticleProcessId ppid,
     return {};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Return the tabulated macroscopic cross sections for a hardwired model.
+ *
+ * The result is null unless the hardwired cross sections were tabulated
+ * during setup, in which case the on-the-fly calculation is unnecessary.
+ */
+CELER_FUNCTION auto PhysicsTrackView::hardwired_value_grid(ModelId model) const
+    -> ValueGridId
+{
+    CELER_EXPECT(model);
+    CELER_EXPECT(this->has_material_tables()
+                 || !(params_.hardwired.livermore_pe_xs
+                      || params_.hardwired.eplusgg_xs));
+
+    ItemRange<ValueGridId> grid_ids;
+    if (model == params_.hardwired.livermore_pe)
+    {
+        grid_ids = params_.hardwired.livermore_pe_xs.material;
+    }
+    else if (model == params_.hardwired.eplusgg)
+    {
+        grid_ids = params_.hardwired.eplusgg_xs.material;
+    }
+    if (grid_ids.empty())
+    {
+        // Not tabulated
+        return {};
+    }
+
+    CELER_ASSERT(material_ < grid_ids.size());
+    return params_.value_grid_ids[grid_ids[material_.get()]];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Return the majorant macroscopic cross sections for this particle.
+ *
+ * The result is null unless majorant tables were built during setup (only for
+ * particles without continuous energy loss), in which case the tabulated
+ * value is an upper bound on the total cross section in every material.
+ */
+CELER_FUNCTION auto PhysicsTrackView::majorant_grid() const -> ValueGridId
+{
+    return this->process_group().majorant_xs;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Production threshold for a secondary particle type in this material.
+ *
+ * Interactors should deposit secondaries below this energy locally instead of
+ * emitting them. The result is zero if no production cuts were given.
+ */
+CELER_FUNCTION auto PhysicsTrackView::production_cut(ParticleId secondary) const
+    -> MevEnergy
+{
+    if (params_.production_cuts.empty())
+        return zero_quantity();
+
+    const size_type num_particles = params_.process_groups.size();
+    CELER_EXPECT(secondary < num_particles);
+    ItemId<real_type> cut_id{material_.get() * num_particles
+                             + secondary.get()};
+    CELER_ASSERT(cut_id < params_.production_cuts.size());
+    return MevEnergy{params_.production_cuts[cut_id]};
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Models that apply to the given process ID.
+ *
+ * If the process has more than one model, the finder uses the precomputed
+ * uniform log-energy lookup table when it's available.
  */
 CELER_FUNCTION auto
 PhysicsTrackView::make_model_finder(ParticleProcessId ppid) const
@@ -232,6 +317,13 @@ PhysicsTrackView::make_model_finder(ParticleProcessId ppid) const
     CELER_EXPECT(ppid < this->num_particle_processes());
     const ModelGroup& mg
         = params_.model_groups[this->process_group().models[ppid.get()]];
+    if (!mg.lookup_index.empty())
+    {
+        return ModelFinder(params_.reals[mg.energy],
+                           params_.model_ids[mg.model],
+                           mg.log_lookup,
+                           params_.lookup_indices[mg.lookup_index]);
+    }
     return ModelFinder(params_.reals[mg.energy], params_.model_ids[mg.model]);
 }
 
@@ -275,9 +367,10 @@ CELER_FUNCTION real_type PhysicsTrackView::linear_loss_limit() const
 /*!
  * Calculate macroscopic cross section on the fly.
  */
-CELER_FUNCTION real_type PhysicsTrackView::calc_xs_otf(ModelId       model,
-                                                       MaterialView& material,
-                                                       MevEnergy energy) const
+CELER_FUNCTION real_type
+PhysicsTrackView::calc_xs_otf(ModelId             model,
+                              const MaterialView& material,
+                              MevEnergy           energy) const
 {
     real_type result = 0.;
     if (model == params_.hardwired.livermore_pe)
@@ -297,6 +390,41 @@ CELER_FUNCTION real_type PhysicsTrackView::calc_xs_otf(ModelId       model,
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the macroscopic cross section for a process.
+ *
+ * Hardwired models use their pretabulated cross sections if available and
+ * otherwise calculate them on the fly; all other processes use the macro_xs
+ * table for the track's material. The material view must correspond to the
+ * material this track view was constructed with.
+ */
+CELER_FUNCTION real_type
+PhysicsTrackView::calc_xs(ParticleProcessId   ppid,
+                          const MaterialView& material,
+                          MevEnergy           energy) const
+{
+    if (auto model_id = this->hardwired_model(ppid, energy))
+    {
+        if (auto grid_id = this->hardwired_value_grid(model_id))
+        {
+            // Use pretabulated cross sections for the hardwired model
+            auto calc_xs = this->make_calculator<XsCalculator>(grid_id);
+            return calc_xs(energy);
+        }
+        // Calculate macroscopic cross section on the fly for special
+        // hardwired processes.
+        return this->calc_xs_otf(model_id, material, energy);
+    }
+    else if (auto grid_id = this->value_grid(ValueGridType::macro_xs, ppid))
+    {
+        auto calc_xs = this->make_calculator<XsCalculator>(grid_id);
+        return calc_xs(energy);
+    }
+    // No discrete interaction for this process
+    return 0;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct a grid calculator of the given type.
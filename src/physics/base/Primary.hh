@@ -25,6 +25,7 @@ struct Primary
     Real3            direction;
     EventId          event_id;
     TrackId          track_id;
+    real_type        weight = 1;
 };
 
 //---------------------------------------------------------------------------//
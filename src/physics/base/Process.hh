@@ -37,6 +37,10 @@ class Model;
  * - macro_xs:    Cross section [1/cm]
  * - energy_loss: dE/dx [MeV/cm]
  * - range:       Range limit [cm]
+ *
+ * The \c step_limits method may be called concurrently from multiple host
+ * threads (for different materials) during physics setup, so it must not
+ * modify shared state.
  */
 class Process
 {
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 
 #include "base/MiniStack.hh"
+#include "random/distributions/AliasSampler.hh"
 
 namespace celeritas
 {
@@ -75,16 +76,11 @@ AtomicRelaxation::operator()(Engine& rng)
         // Sample a transition
         const AtomicRelaxSubshell& shell
             = shared_.elements[el_id_.get()].shells[vacancy_id.get()];
-        real_type prob = generate_canonical(rng);
-        size_type i;
-        for (i = 0; i < shell.transitions.size(); ++i)
-        {
-            if ((prob -= shell.transitions[i].probability) <= 0)
-                break;
-        }
+        AliasSampler sample_transition(shell.transition_alias);
+        size_type    i = sample_transition(rng);
 
         // If no transition was sampled, continue to the next vacancy
-        if (prob > 0.)
+        if (i >= shell.transitions.size())
             continue;
 
         // Push the new vacancies onto the stack and create the secondary
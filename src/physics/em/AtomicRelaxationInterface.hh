@@ -14,6 +14,7 @@
 #include "base/Types.hh"
 #include "physics/base/Types.hh"
 #include "physics/base/Units.hh"
+#include "random/distributions/AliasTableInterface.hh"
 
 namespace celeritas
 {
@@ -41,10 +42,15 @@ struct AtomicRelaxTransition
 //---------------------------------------------------------------------------//
 /*!
  * Electron subshell data.
+ *
+ * The alias table samples the index of the transition. If the transition
+ * probabilities sum to less than unity (e.g. when Auger transitions are
+ * disabled), the table has one extra entry corresponding to no transition.
  */
 struct AtomicRelaxSubshell
 {
     Span<const AtomicRelaxTransition> transitions;
+    Span<const AliasEntry>            transition_alias;
 };
 
 //---------------------------------------------------------------------------//
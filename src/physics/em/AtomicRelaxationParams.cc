@@ -15,6 +15,7 @@
 #include "base/SpanRemapper.hh"
 #include "base/VectorUtils.hh"
 #include "comm/Device.hh"
+#include "random/distributions/AliasTableBuilder.hh"
 #include "detail/Utils.hh"
 
 namespace celeritas
@@ -38,8 +39,8 @@ AtomicRelaxationParams::AtomicRelaxationParams(const Input& inp)
     CELER_EXPECT(electron_id_);
     CELER_EXPECT(gamma_id_);
 
-    // Reserve host space (MUST reserve subshells and transitions to avoid
-    // invalidating spans).
+    // Reserve host space (MUST reserve subshells, transitions, and alias
+    // tables to avoid invalidating spans).
     size_type ss_size = 0;
     size_type tr_size = 0;
     for (const auto& el : inp.elements)
@@ -57,6 +58,7 @@ AtomicRelaxationParams::AtomicRelaxationParams(const Input& inp)
     host_elements_.reserve(inp.elements.size());
     host_shells_.reserve(ss_size);
     host_transitions_.reserve(tr_size);
+    host_alias_.reserve(tr_size + ss_size);
 
     // Build elements
     for (const auto& el : inp.elements)
@@ -72,15 +74,19 @@ AtomicRelaxationParams::AtomicRelaxationParams(const Input& inp)
         device_shells_ = DeviceVector<AtomicRelaxSubshell>(host_shells_.size());
         device_transitions_
             = DeviceVector<AtomicRelaxTransition>(host_transitions_.size());
+        device_alias_ = DeviceVector<AliasEntry>(host_alias_.size());
 
-        // Remap shell->transition spans
+        // Remap shell->transition and shell->alias spans
         auto remap_transitions
             = make_span_remapper(make_span(host_transitions_),
                                  device_transitions_.device_pointers());
+        auto remap_alias = make_span_remapper(make_span(host_alias_),
+                                              device_alias_.device_pointers());
         std::vector<AtomicRelaxSubshell> temp_device_shells = host_shells_;
         for (AtomicRelaxSubshell& ss : temp_device_shells)
         {
-            ss.transitions = remap_transitions(ss.transitions);
+            ss.transitions      = remap_transitions(ss.transitions);
+            ss.transition_alias = remap_alias(ss.transition_alias);
         }
 
         // Remap element->shell spans
@@ -96,6 +102,7 @@ AtomicRelaxationParams::AtomicRelaxationParams(const Input& inp)
         device_elements_.copy_to_device(make_span(temp_device_elements));
         device_shells_.copy_to_device(make_span(temp_device_shells));
         device_transitions_.copy_to_device(make_span(host_transitions_));
+        device_alias_.copy_to_device(make_span(host_alias_));
     }
 
     CELER_ENSURE(host_elements_.size() == inp.elements.size());
@@ -199,7 +206,7 @@ AtomicRelaxationParams::extend_shells(const ElementInput& inp)
             norm += transition.probability;
         for (const auto& transition : inp.shells[i].auger)
             norm += transition.probability;
-        CELER_ASSERT(soft_equal(1., norm));
+        CELER_ASSERT(soft_equal(real_type(1), norm));
 
         // Store the radiative transitions
         auto fluor = this->extend_transitions(inp.shells[i].fluor);
@@ -214,6 +221,9 @@ AtomicRelaxationParams::extend_shells(const ElementInput& inp)
         {
             result[i].transitions = fluor;
         }
+
+        // Build the table for sampling a transition
+        result[i].transition_alias = this->extend_alias(result[i].transitions);
     }
 
     return result;
@@ -247,5 +257,35 @@ Span<AtomicRelaxTransition> AtomicRelaxationParams::extend_transitions(
     return {host_transitions_.data() + start, transitions.size()};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Build and store the alias table for sampling a transition.
+ *
+ * If the transition probabilities sum to less than unity, the remaining
+ * probability is assigned to an extra "no transition" outcome.
+ */
+Span<AliasEntry> AtomicRelaxationParams::extend_alias(
+    Span<const AtomicRelaxTransition> transitions)
+{
+    std::vector<real_type> weights(transitions.size());
+    real_type              total = 0;
+    for (auto i : range(transitions.size()))
+    {
+        weights[i] = transitions[i].probability;
+        total += weights[i];
+    }
+    if (total < 1)
+    {
+        weights.push_back(1 - total);
+    }
+
+    CELER_ASSERT(host_alias_.size() + weights.size() <= host_alias_.capacity());
+    auto start = host_alias_.size();
+    host_alias_.resize(start + weights.size());
+    Span<AliasEntry> result{host_alias_.data() + start, weights.size()};
+    AliasTableBuilder::build(make_span(weights), result);
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -81,18 +81,22 @@ class AtomicRelaxationParams
     std::vector<AtomicRelaxElement>    host_elements_;
     std::vector<AtomicRelaxSubshell>   host_shells_;
     std::vector<AtomicRelaxTransition> host_transitions_;
+    std::vector<AliasEntry>            host_alias_;
 
     //// DEVICE DATA ////
 
     DeviceVector<AtomicRelaxElement>    device_elements_;
     DeviceVector<AtomicRelaxSubshell>   device_shells_;
     DeviceVector<AtomicRelaxTransition> device_transitions_;
+    DeviceVector<AliasEntry>            device_alias_;
 
     // HELPER FUNCTIONS
     void                      append_element(const ElementInput& inp);
     Span<AtomicRelaxSubshell> extend_shells(const ElementInput& inp);
     Span<AtomicRelaxTransition>
     extend_transitions(const std::vector<TransitionInput>& transitions);
+    Span<AliasEntry>
+    extend_alias(Span<const AtomicRelaxTransition> transitions);
 };
 
 //---------------------------------------------------------------------------//
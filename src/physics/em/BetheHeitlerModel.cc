@@ -7,8 +7,12 @@
 //---------------------------------------------------------------------------//
 #include "BetheHeitlerModel.hh"
 
+#include <cmath>
 #include "base/Assert.hh"
+#include "base/Range.hh"
+#include "comm/Device.hh"
 #include "physics/base/PDGNumber.hh"
+#include "physics/material/ElementView.hh"
 
 namespace celeritas
 {
@@ -17,7 +21,8 @@ namespace celeritas
  * Construct from model ID and other necessary data.
  */
 BetheHeitlerModel::BetheHeitlerModel(ModelId               id,
-                                     const ParticleParams& particles)
+                                     const ParticleParams& particles,
+                                     const MaterialParams& materials)
 {
     CELER_EXPECT(id);
     interface_.model_id    = id;
@@ -31,7 +36,29 @@ BetheHeitlerModel::BetheHeitlerModel(ModelId               id,
                    "use the Bethe-Heitler Model.");
     interface_.inv_electron_mass
         = 1 / particles.get(interface_.electron_id).mass().value();
-    CELER_ENSURE(interface_);
+
+    // Precalculate screening constants for every element
+    host_elements_.reserve(materials.num_elements());
+    for (auto el_id : range(ElementId{materials.num_elements()}))
+    {
+        ElementView element(materials.host_pointers(), el_id);
+        ElementData data;
+        data.screening_factor   = 136 / element.cbrt_z();
+        data.coulomb_correction = element.coulomb_correction();
+        data.delta_max = std::exp((42.24 - data.coulomb_correction) / 8.368)
+                         - 0.952;
+        host_elements_.push_back(data);
+    }
+
+    host_interface_          = interface_;
+    host_interface_.elements = make_span(host_elements_);
+    if (celeritas::device())
+    {
+        device_elements_ = DeviceVector<ElementData>(host_elements_.size());
+        device_elements_.copy_to_device(host_interface_.elements);
+        interface_.elements = device_elements_.device_pointers();
+    }
+    CELER_ENSURE(host_interface_);
 }
 
 //---------------------------------------------------------------------------//
@@ -62,6 +89,24 @@ void BetheHeitlerModel::interact(
 #endif
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Access data on device.
+ */
+detail::BetheHeitlerPointers BetheHeitlerModel::device_pointers() const
+{
+    return interface_;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access data on host.
+ */
+detail::BetheHeitlerPointers BetheHeitlerModel::host_pointers() const
+{
+    return host_interface_;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Get the model ID for this model.
@@ -7,8 +7,11 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <vector>
+#include "base/DeviceVector.hh"
 #include "physics/base/Model.hh"
 #include "physics/base/ParticleParams.hh"
+#include "physics/material/MaterialParams.hh"
 #include "detail/BetheHeitler.hh"
 
 namespace celeritas
@@ -16,12 +19,17 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 /*!
  * Set up and launch the Bethe-Heitler model interaction.
+ *
+ * The screening factor, Coulomb correction, and maximum screening variable
+ * for each element are precalculated at construction.
  */
 class BetheHeitlerModel final : public Model
 {
   public:
     // Construct from model ID and other necessary data
-    BetheHeitlerModel(ModelId id, const ParticleParams& particles);
+    BetheHeitlerModel(ModelId               id,
+                      const ParticleParams& particles,
+                      const MaterialParams& materials);
 
     // Particle types and energy ranges that this model applies to
     SetApplicability applicability() const final;
@@ -35,8 +43,19 @@ class BetheHeitlerModel final : public Model
     //! Name of the model, for user interaction
     std::string label() const final { return "Bethe-Heitler"; }
 
+    // Access data on device
+    detail::BetheHeitlerPointers device_pointers() const;
+
+    // Access data on host
+    detail::BetheHeitlerPointers host_pointers() const;
+
   private:
+    using ElementData = detail::BetheHeitlerElementData;
+
     detail::BetheHeitlerPointers interface_;
+    detail::BetheHeitlerPointers host_interface_;
+    std::vector<ElementData>     host_elements_;
+    DeviceVector<ElementData>    device_elements_;
 };
 
 //---------------------------------------------------------------------------//
@@ -42,9 +42,8 @@ auto EPlusAnnihilationProcess::step_limits(Applicability range) const
 {
     CELER_EXPECT(range.particle == positron_id_);
 
-    // Not implemented
-    CELER_ASSERT_UNREACHABLE();
-
+    // Cross sections are hardwired: they're calculated on the fly, or
+    // tabulated by PhysicsParams if requested
     return {};
 }
 
@@ -16,11 +16,14 @@ namespace celeritas
 /*!
  * Construct from host data.
  */
-GammaConversionProcess::GammaConversionProcess(SPConstParticles particles)
+GammaConversionProcess::GammaConversionProcess(SPConstParticles particles,
+                                               SPConstMaterials materials)
     : particles_(std::move(particles))
+    , materials_(std::move(materials))
     , positron_id_(particles_->find(pdg::positron()))
 {
     CELER_EXPECT(particles_);
+    CELER_EXPECT(materials_);
 }
 
 //---------------------------------------------------------------------------//
@@ -30,7 +33,8 @@ GammaConversionProcess::GammaConversionProcess(SPConstParticles particles)
 auto GammaConversionProcess::build_models(ModelIdGenerator next_id) const
     -> VecModel
 {
-    return {std::make_shared<BetheHeitlerModel>(next_id(), *particles_)};
+    return {std::make_shared<BetheHeitlerModel>(
+        next_id(), *particles_, *materials_)};
 }
 
 //---------------------------------------------------------------------------//
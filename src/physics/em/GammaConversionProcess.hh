@@ -10,6 +10,7 @@
 #include "physics/base/Process.hh"
 
 #include "physics/base/ParticleParams.hh"
+#include "physics/material/MaterialParams.hh"
 
 namespace celeritas
 {
@@ -23,11 +24,13 @@ class GammaConversionProcess : public Process
     //!@{
     //! Type aliases
     using SPConstParticles = std::shared_ptr<const ParticleParams>;
+    using SPConstMaterials = std::shared_ptr<const MaterialParams>;
     //!@}
 
   public:
-    // Construct from particle data
-    explicit GammaConversionProcess(SPConstParticles particles);
+    // Construct from particle and material data
+    GammaConversionProcess(SPConstParticles particles,
+                           SPConstMaterials materials);
 
     // Construct the models associated with this process
     VecModel build_models(ModelIdGenerator next_id) const final;
@@ -40,6 +43,7 @@ class GammaConversionProcess : public Process
 
   private:
     SPConstParticles particles_;
+    SPConstMaterials materials_;
     ParticleId       positron_id_;
 };
 
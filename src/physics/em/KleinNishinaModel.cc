@@ -7,8 +7,12 @@
 //---------------------------------------------------------------------------//
 #include "KleinNishinaModel.hh"
 
+#include <cmath>
 #include "base/Assert.hh"
+#include "comm/Device.hh"
 #include "physics/base/PDGNumber.hh"
+#include "physics/grid/InverseCdfBuilder.hh"
+#include "detail/KleinNishinaInteractor.hh"
 
 namespace celeritas
 {
@@ -17,7 +21,8 @@ namespace celeritas
  * Construct from model ID and other necessary data.
  */
 KleinNishinaModel::KleinNishinaModel(ModelId               id,
-                                     const ParticleParams& particles)
+                                     const ParticleParams& particles,
+                                     bool                  tabulate_sampling)
 {
     CELER_EXPECT(id);
     interface_.model_id    = id;
@@ -29,7 +34,36 @@ KleinNishinaModel::KleinNishinaModel(ModelId               id,
                    "Klein-Nishina Model.");
     interface_.inv_electron_mass
         = 1 / particles.get(interface_.electron_id).mass().value();
-    CELER_ENSURE(interface_);
+    host_interface_ = interface_;
+
+    if (tabulate_sampling)
+    {
+        // Tabulate from the lower applicability limit up to 100 TeV, with 10
+        // points per decade; higher energies use rejection sampling
+        InverseCdfGridData table;
+        table.log_energy
+            = UniformGridData::from_bounds(std::log(0.01), std::log(1e8), 101);
+        table.num_xi = 129;
+
+        const real_type   inv_mass = interface_.inv_electron_mass;
+        InverseCdfBuilder build_table(table.log_energy, table.num_xi);
+        host_epsilon_table_ = build_table([inv_mass](real_type e, real_type s) {
+            return detail::KleinNishinaInteractor::calc_scaled_pdf(
+                e * inv_mass, s);
+        });
+
+        table.values                  = make_span(host_epsilon_table_);
+        host_interface_.epsilon_table = table;
+        if (celeritas::device())
+        {
+            device_epsilon_table_
+                = DeviceVector<real_type>(host_epsilon_table_.size());
+            device_epsilon_table_.copy_to_device(table.values);
+            table.values             = device_epsilon_table_.device_pointers();
+            interface_.epsilon_table = table;
+        }
+    }
+    CELER_ENSURE(interface_ && host_interface_);
 }
 
 //---------------------------------------------------------------------------//
@@ -60,6 +94,24 @@ void KleinNishinaModel::interact(
 #endif
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Access data on device.
+ */
+detail::KleinNishinaPointers KleinNishinaModel::device_pointers() const
+{
+    return interface_;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access data on host.
+ */
+detail::KleinNishinaPointers KleinNishinaModel::host_pointers() const
+{
+    return host_interface_;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Get the model ID for this model.
@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <vector>
+#include "base/DeviceVector.hh"
 #include "physics/base/Model.hh"
 #include "physics/base/ParticleParams.hh"
 #include "detail/KleinNishina.hh"
@@ -16,12 +18,18 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 /*!
  * Set up and launch the Klein-Nishina model interaction.
+ *
+ * If \c tabulate_sampling is enabled, an inverse CDF table for the outgoing
+ * photon energy fraction is built at construction, and the interactor uses it
+ * instead of the rejection loop for incident energies inside the table.
  */
 class KleinNishinaModel final : public Model
 {
   public:
     // Construct from model ID and other necessary data
-    KleinNishinaModel(ModelId id, const ParticleParams& particles);
+    KleinNishinaModel(ModelId               id,
+                      const ParticleParams& particles,
+                      bool                  tabulate_sampling = false);
 
     // Particle types and energy ranges that this model applies to
     SetApplicability applicability() const final;
@@ -35,8 +43,17 @@ class KleinNishinaModel final : public Model
     //! Name of the model, for user interaction
     std::string label() const final { return "Klein-Nishina"; }
 
+    // Access data on device
+    detail::KleinNishinaPointers device_pointers() const;
+
+    // Access data on host
+    detail::KleinNishinaPointers host_pointers() const;
+
   private:
     detail::KleinNishinaPointers interface_;
+    detail::KleinNishinaPointers host_interface_;
+    std::vector<real_type>       host_epsilon_table_;
+    DeviceVector<real_type>      device_epsilon_table_;
 };
 
 //---------------------------------------------------------------------------//
@@ -11,6 +11,7 @@
 #include "base/Span.hh"
 #include "base/Types.hh"
 #include "physics/base/Units.hh"
+#include "physics/grid/UniformGridInterface.hh"
 #include "LivermoreXsCalculator.hh"
 
 namespace celeritas
@@ -38,6 +39,20 @@ struct LivermoreSubshell
     Span<const real_type> param_high;
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Subshell selection probabilities between two consecutive binding energies.
+ *
+ * The cumulative probabilities of the open subshells are tabulated on a
+ * uniform log-energy grid, ordered as [energy][open subshell], and omit the
+ * final (unity) value for the outermost shell.
+ */
+struct LivermoreSubshellCdf
+{
+    UniformGridData       log_energy;
+    Span<const real_type> cdf;
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Elemental photoelectric cross sections for the Livermore model.
@@ -62,6 +77,10 @@ struct LivermoreElement
 
     Span<const LivermoreSubshell> shells;
 
+    // Optional subshell selection tables, indexed by the number of closed
+    // (inner) subshells
+    Span<const LivermoreSubshellCdf> shell_cdfs;
+
     // Energy threshold for using the parameterized subshell cross sections in
     // the lower and upper energy range
     Energy thresh_low;
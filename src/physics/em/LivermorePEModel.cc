@@ -7,9 +7,12 @@
 //---------------------------------------------------------------------------//
 #include "LivermorePEModel.hh"
 
+#include <cmath>
 #include "base/Assert.hh"
 #include "comm/Device.hh"
 #include "physics/base/PDGNumber.hh"
+#include "physics/material/ElementCdfBuilder.hh"
+#include "detail/LivermorePEMicroXsCalculator.hh"
 
 namespace celeritas
 {
@@ -19,20 +22,39 @@ namespace celeritas
  */
 LivermorePEModel::LivermorePEModel(ModelId                  id,
                                    const ParticleParams&    particles,
+                                   const MaterialParams&    materials,
                                    const LivermorePEParams& data)
 {
     CELER_EXPECT(id);
     interface_.model_id    = id;
     interface_.electron_id = particles.find(pdg::electron());
     interface_.gamma_id    = particles.find(pdg::gamma());
-    interface_.data        = data.device_pointers();
 
     CELER_VALIDATE(interface_.electron_id && interface_.gamma_id,
                    "Electron and gamma particles must be enabled to use the "
                    "Livermore Photoelectric Model.");
     interface_.inv_electron_mass
         = 1 / particles.get(interface_.electron_id).mass().value();
-    CELER_ENSURE(interface_);
+
+    // Host data is only used for cross section calculations
+    host_interface_      = interface_;
+    host_interface_.data = data.host_pointers();
+    if (celeritas::device())
+    {
+        interface_.data = data.device_pointers();
+    }
+
+    // Tabulate element selection probabilities from 10 eV to 100 GeV
+    ElementCdfBuilder build_cdf(
+        materials, [this](ElementId el_id, units::MevEnergy energy) {
+            return detail::LivermorePEMicroXsCalculator{host_interface_,
+                                                        energy}(el_id);
+        });
+    ElementCdfBuilder::HostValue host_cdf;
+    build_cdf(UniformGridData::from_bounds(std::log(1e-5), std::log(1e5), 201),
+              &host_cdf);
+    element_cdf_ = CollectionMirror<ElementCdfData>{std::move(host_cdf)};
+    CELER_ENSURE(host_interface_ && element_cdf_);
 }
 
 //---------------------------------------------------------------------------//
@@ -42,10 +64,11 @@ LivermorePEModel::LivermorePEModel(ModelId                  id,
 LivermorePEModel::LivermorePEModel(
     ModelId                         id,
     const ParticleParams&           particles,
+    const MaterialParams&           materials,
     const LivermorePEParams&        data,
     const AtomicRelaxationParams&   atomic_relaxation,
     SPConstSubshellIdAllocatorStore vacancies)
-    : LivermorePEModel(id, particles, data)
+    : LivermorePEModel(id, particles, materials, data)
 {
     CELER_EXPECT(vacancies);
     vacancies_                   = std::move(vacancies);
@@ -76,7 +99,8 @@ void LivermorePEModel::interact(
     CELER_MAYBE_UNUSED const ModelInteractPointers& pointers) const
 {
 #if CELERITAS_USE_CUDA
-    detail::livermore_pe_interact(this->device_pointers(), pointers);
+    detail::livermore_pe_interact(
+        this->device_pointers(), this->device_element_cdf(), pointers);
 #else
     CELER_ASSERT_UNREACHABLE();
 #endif
@@ -97,6 +121,7 @@ ModelId LivermorePEModel::model_id() const
  */
 detail::LivermorePEPointers LivermorePEModel::device_pointers() const
 {
+    CELER_EXPECT(celeritas::device());
     detail::LivermorePEPointers result = interface_;
     if (result.atomic_relaxation)
         result.vacancies = vacancies_->device_pointers();
@@ -105,5 +130,17 @@ detail::LivermorePEPointers LivermorePEModel::device_pointers() const
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Access cross section data on host.
+ *
+ * The atomic relaxation and vacancy data are not available, so this should
+ * only be used for calculating cross sections (e.g. for tabulation).
+ */
+detail::LivermorePEPointers LivermorePEModel::host_pointers() const
+{
+    return host_interface_;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -7,10 +7,13 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "base/CollectionMirror.hh"
 #include "physics/base/Model.hh"
 #include "physics/base/ParticleParams.hh"
 #include "physics/em/AtomicRelaxationParams.hh"
 #include "physics/em/LivermorePEParams.hh"
+#include "physics/material/ElementCdfInterface.hh"
+#include "physics/material/MaterialParams.hh"
 #include "detail/LivermorePE.hh"
 
 namespace celeritas
@@ -18,6 +21,13 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 /*!
  * Set up and launch the Livermore photoelectric model interaction.
+ *
+ * The element of each material that the photon interacts with is sampled from
+ * cumulative probabilities tabulated at construction on a uniform log-energy
+ * grid, so the kernel needs neither the microscopic cross sections of every
+ * element nor per-track element scratch space. Interpolation across an
+ * absorption edge is inexact only within the single grid interval that
+ * contains it.
  */
 class LivermorePEModel final : public Model
 {
@@ -26,17 +36,23 @@ class LivermorePEModel final : public Model
     //! Type aliases
     using SPConstSubshellIdAllocatorStore
         = std::shared_ptr<SubshellIdAllocatorStore>;
+    using ElementCdfHostRef
+        = ElementCdfData<Ownership::const_reference, MemSpace::host>;
+    using ElementCdfDeviceRef
+        = ElementCdfData<Ownership::const_reference, MemSpace::device>;
     //!@}
 
   public:
     // Construct from model ID and other necessary data
     LivermorePEModel(ModelId                  id,
                      const ParticleParams&    particles,
+                     const MaterialParams&    materials,
                      const LivermorePEParams& data);
 
     // Construct with transition data for atomic relaxation
     LivermorePEModel(ModelId                         id,
                      const ParticleParams&           particles,
+                     const MaterialParams&           materials,
                      const LivermorePEParams&        data,
                      const AtomicRelaxationParams&   atomic_relaxation,
                      SPConstSubshellIdAllocatorStore vacancies);
@@ -56,9 +72,26 @@ class LivermorePEModel final : public Model
     // Access data on device
     detail::LivermorePEPointers device_pointers() const;
 
+    // Access cross section data on host
+    detail::LivermorePEPointers host_pointers() const;
+
+    //! Access element selection tables on host
+    const ElementCdfHostRef& host_element_cdf() const
+    {
+        return element_cdf_.host();
+    }
+
+    //! Access element selection tables on device
+    const ElementCdfDeviceRef& device_element_cdf() const
+    {
+        return element_cdf_.device();
+    }
+
   private:
-    detail::LivermorePEPointers     interface_;
-    SPConstSubshellIdAllocatorStore vacancies_;
+    detail::LivermorePEPointers      interface_;
+    detail::LivermorePEPointers      host_interface_;
+    SPConstSubshellIdAllocatorStore  vacancies_;
+    CollectionMirror<ElementCdfData> element_cdf_;
 };
 
 //---------------------------------------------------------------------------//
@@ -7,16 +7,74 @@
 //---------------------------------------------------------------------------//
 #include "LivermorePEParams.hh"
 
+#include <algorithm>
 #include <cmath>
 #include <numeric>
+#include "base/Algorithms.hh"
 #include "base/Range.hh"
 #include "base/SoftEqual.hh"
 #include "base/SpanRemapper.hh"
 #include "base/VectorUtils.hh"
 #include "comm/Device.hh"
+#include "physics/grid/UniformGrid.hh"
+#include "detail/LivermorePEMicroXsCalculator.hh"
 
 namespace celeritas
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Upper energy bound of the subshell selection tables [MeV]
+constexpr real_type shell_cdf_emax = 1e5;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct the log-energy grids for an element's subshell selection tables.
+ *
+ * Grid \c k spans the energies at which the first \c k subshells are closed,
+ * i.e. from the binding energy of subshell \c k to that of subshell \c k-1
+ * (or the maximum table energy). Coincident binding energies result in an
+ * empty grid. The result is empty if tabulation is disabled or if the
+ * element's subshells are not ordered by decreasing binding energy.
+ */
+std::vector<UniformGridData>
+make_shell_cdf_grids(const LivermorePEParams::ElementInput& inp,
+                     size_type                              per_decade)
+{
+    const auto& shells = inp.shells;
+    if (per_decade == 0 || shells.size() < 2
+        || !(shells.back().binding_energy.value() > 0)
+        || !(shells.front().binding_energy.value() < shell_cdf_emax))
+    {
+        return {};
+    }
+    for (auto i : range(shells.size() - 1))
+    {
+        if (shells[i].binding_energy < shells[i + 1].binding_energy)
+            return {};
+    }
+
+    std::vector<UniformGridData> result(shells.size() - 1);
+    for (auto k : range(result.size()))
+    {
+        const real_type log_emin = std::log(shells[k].binding_energy.value());
+        const real_type log_emax
+            = std::log(k == 0 ? shell_cdf_emax
+                              : shells[k - 1].binding_energy.value());
+        if (!(log_emin < log_emax))
+            continue;
+
+        const auto num_bins = static_cast<size_type>(std::ceil(
+            per_decade * (log_emax - log_emin) / std::log(real_type(10))));
+        result[k] = UniformGridData::from_bounds(
+            log_emin, log_emax, std::max<size_type>(num_bins, 1) + 1);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct from a vector of element identifiers.
@@ -25,12 +83,23 @@ LivermorePEParams::LivermorePEParams(const Input& inp)
 {
     CELER_EXPECT(!inp.elements.empty());
 
+    // Subshell selection grids
+    std::vector<std::vector<UniformGridData>> shell_grids;
+    shell_grids.reserve(inp.elements.size());
+    for (const auto& el : inp.elements)
+    {
+        shell_grids.push_back(
+            make_shell_cdf_grids(el, inp.shell_cdf_per_decade));
+    }
+
     // Reserve host space (MUST reserve subshells and cross section data to
     // avoid invalidating spans).
-    size_type subshell_size = 0;
-    size_type data_size     = 0;
-    for (const auto& el : inp.elements)
+    size_type subshell_size  = 0;
+    size_type shell_cdf_size = 0;
+    size_type data_size      = 0;
+    for (auto el_idx : range(inp.elements.size()))
     {
+        const auto& el = inp.elements[el_idx];
         subshell_size += el.shells.size();
         data_size += el.xs_low.x.size() + el.xs_low.y.size()
                      + el.xs_high.x.size() + el.xs_high.y.size();
@@ -40,15 +109,28 @@ LivermorePEParams::LivermorePEParams(const Input& inp)
             data_size += shell.param_low.size() + shell.param_high.size()
                          + shell.xs.size() + shell.energy.size();
         }
+
+        const auto& grids = shell_grids[el_idx];
+        shell_cdf_size += grids.size();
+        for (auto k : range(grids.size()))
+        {
+            data_size += grids[k].size * (grids.size() - k);
+        }
     }
     host_elements_.reserve(inp.elements.size());
     host_shells_.reserve(subshell_size);
+    host_shell_cdfs_.reserve(shell_cdf_size);
     host_data_.reserve(data_size);
 
     // Build elements
-    for (const auto& el : inp.elements)
+    for (auto el_idx : range(inp.elements.size()))
     {
-        this->append_livermore_element(el);
+        this->append_livermore_element(inp.elements[el_idx]);
+        if (!shell_grids[el_idx].empty())
+        {
+            host_elements_.back().shell_cdfs = this->build_shell_cdfs(
+                ElementId(el_idx), shell_grids[el_idx]);
+        }
     }
 
     if (celeritas::device())
@@ -57,6 +139,8 @@ LivermorePEParams::LivermorePEParams(const Input& inp)
         device_elements_
             = DeviceVector<LivermoreElement>(host_elements_.size());
         device_shells_ = DeviceVector<LivermoreSubshell>(host_shells_.size());
+        device_shell_cdfs_
+            = DeviceVector<LivermoreSubshellCdf>(host_shell_cdfs_.size());
         device_data_   = DeviceVector<real_type>(host_data_.size());
 
         // Remap shell->data spans
@@ -71,9 +155,20 @@ LivermorePEParams::LivermorePEParams(const Input& inp)
             shell.param_high = remap_data(shell.param_high);
         }
 
+        // Remap subshell selection table->data spans
+        std::vector<LivermoreSubshellCdf> temp_device_shell_cdfs
+            = host_shell_cdfs_;
+        for (LivermoreSubshellCdf& shell_cdf : temp_device_shell_cdfs)
+        {
+            shell_cdf.cdf = remap_data(shell_cdf.cdf);
+        }
+
         // Remap element->shell spans and element->data spans
         auto remap_shells = make_span_remapper(
             make_span(host_shells_), device_shells_.device_pointers());
+        auto remap_shell_cdfs
+            = make_span_remapper(make_span(host_shell_cdfs_),
+                                 device_shell_cdfs_.device_pointers());
         std::vector<LivermoreElement> temp_device_elements = host_elements_;
         for (LivermoreElement& el : temp_device_elements)
         {
@@ -82,16 +177,19 @@ LivermorePEParams::LivermorePEParams(const Input& inp)
             el.xs_high.energy = remap_data(el.xs_high.energy);
             el.xs_high.xs     = remap_data(el.xs_high.xs);
             el.shells         = remap_shells(el.shells);
+            el.shell_cdfs     = remap_shell_cdfs(el.shell_cdfs);
         }
 
         // Copy vectors to device
         device_elements_.copy_to_device(make_span(temp_device_elements));
         device_shells_.copy_to_device(make_span(temp_device_shells));
+        device_shell_cdfs_.copy_to_device(make_span(temp_device_shell_cdfs));
         device_data_.copy_to_device(make_span(host_data_));
     }
 
     CELER_ENSURE(host_elements_.size() == inp.elements.size());
     CELER_ENSURE(host_shells_.size() <= host_shells_.capacity());
+    CELER_ENSURE(host_shell_cdfs_.size() <= host_shell_cdfs_.capacity());
     CELER_ENSURE(host_data_.size() <= host_data_.capacity());
 }
 
@@ -177,6 +275,101 @@ LivermorePEParams::extend_shells(const ElementInput& inp)
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Tabulate cumulative subshell selection probabilities for an element.
+ *
+ * This evaluates the same subshell cross sections as the on-the-fly sampling
+ * in \c LivermorePEInteractor (tabulated subshell cross sections below the
+ * low-energy fit threshold and parameterized cumulative cross sections above
+ * it) and normalizes them by the total element cross section. The grid
+ * endpoints are evaluated just inside the binding energies that bound them.
+ */
+Span<LivermoreSubshellCdf>
+LivermorePEParams::build_shell_cdfs(ElementId                           el_id,
+                                    const std::vector<UniformGridData>& grids)
+{
+    CELER_EXPECT(el_id < host_elements_.size());
+    CELER_EXPECT(host_shell_cdfs_.size() + grids.size()
+                 <= host_shell_cdfs_.capacity());
+
+    using Energy = detail::LivermorePEMicroXsCalculator::Energy;
+
+    const LivermoreElement& el       = host_elements_[el_id.get()];
+    const size_type         num_cols = el.shells.size() - 1;
+    CELER_ASSERT(grids.size() == num_cols);
+
+    // Total cross sections are calculated from the host data
+    detail::LivermorePEPointers shared;
+    shared.data = this->host_pointers();
+
+    // Allocate subshell selection tables
+    auto start_size = host_shell_cdfs_.size();
+    host_shell_cdfs_.resize(start_size + grids.size());
+    Span<LivermoreSubshellCdf> result{host_shell_cdfs_.data() + start_size,
+                                      grids.size()};
+
+    std::vector<real_type> cdf;
+    for (auto k : range(grids.size()))
+    {
+        if (!grids[k])
+        {
+            // Coincident binding energies
+            continue;
+        }
+
+        const UniformGrid loge_grid(grids[k]);
+        const real_type   emin  = std::exp(loge_grid.front()) * (1 + 1e-6);
+        const real_type   emax  = std::exp(loge_grid.back()) * (1 - 1e-6);
+        const size_type   width = num_cols - k;
+        cdf.resize(loge_grid.size() * width);
+        for (auto i : range(loge_grid.size()))
+        {
+            const Energy energy{
+                std::min(std::max(std::exp(loge_grid[i]), emin), emax)};
+            const real_type inv_e = 1 / energy.value();
+
+            detail::LivermorePEMicroXsCalculator calc_micro_xs(shared, energy);
+            const real_type total_xs = calc_micro_xs(el_id);
+            CELER_ASSERT(total_xs > 0);
+
+            real_type xs = 0;
+            for (auto j : range(num_cols))
+            {
+                const LivermoreSubshell& shell = el.shells[j];
+                if (energy > shell.binding_energy)
+                {
+                    if (energy < el.thresh_low)
+                    {
+                        LivermoreXsCalculator calc_xs(shell.xs);
+                        xs += ipow<3>(inv_e) * calc_xs(energy.value());
+                    }
+                    else
+                    {
+                        const auto& param = energy >= el.thresh_high
+                                                ? shell.param_high
+                                                : shell.param_low;
+                        // clang-format off
+                        xs = inv_e * (param[0] + inv_e * (param[1]
+                           + inv_e * (param[2] + inv_e * (param[3]
+                           + inv_e * (param[4] + inv_e * param[5])))));
+                        // clang-format on
+                    }
+                }
+                if (j >= k)
+                {
+                    cdf[i * width + j - k] = std::min(xs / total_xs,
+                                                      real_type(1));
+                }
+            }
+        }
+
+        result[k].log_energy = grids[k];
+        result[k].cdf        = this->extend_data(cdf);
+    }
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Process and store tabulated cross sections, energies, and fit parameters.
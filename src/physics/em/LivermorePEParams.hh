@@ -18,6 +18,14 @@ namespace celeritas
 /*!
  * Data management for the Livermore EPICS2014 Electron Photon Interaction
  * Cross Section library.
+ *
+ * If \c shell_cdf_per_decade is nonzero, the cumulative subshell selection
+ * probabilities for each element are tabulated from the lowest binding energy
+ * to 100 GeV so that the interactor can sample the subshell without
+ * recalculating the subshell cross sections. Each interval between
+ * consecutive binding energies has its own uniform log-energy grid so that
+ * no interpolation crosses an absorption edge. Elements whose subshell
+ * binding energies are not in decreasing order are not tabulated.
  */
 class LivermorePEParams
 {
@@ -53,6 +61,7 @@ class LivermorePEParams
     struct Input
     {
         std::vector<ElementInput> elements;
+        size_type shell_cdf_per_decade{50}; //!< Subshell CDF grid density
     };
 
   public:
@@ -66,18 +75,23 @@ class LivermorePEParams
     LivermorePEParamsPointers device_pointers() const;
 
   private:
-    std::vector<LivermoreElement>  host_elements_;
-    std::vector<LivermoreSubshell> host_shells_;
-    std::vector<real_type>         host_data_;
+    std::vector<LivermoreElement>     host_elements_;
+    std::vector<LivermoreSubshell>    host_shells_;
+    std::vector<LivermoreSubshellCdf> host_shell_cdfs_;
+    std::vector<real_type>            host_data_;
 
-    DeviceVector<LivermoreElement>  device_elements_;
-    DeviceVector<LivermoreSubshell> device_shells_;
-    DeviceVector<real_type>         device_data_;
+    DeviceVector<LivermoreElement>     device_elements_;
+    DeviceVector<LivermoreSubshell>    device_shells_;
+    DeviceVector<LivermoreSubshellCdf> device_shell_cdfs_;
+    DeviceVector<real_type>            device_data_;
 
     // HELPER FUNCTIONS
     void                    append_livermore_element(const ElementInput& inp);
     Span<LivermoreSubshell> extend_shells(const ElementInput& inp);
     Span<real_type>         extend_data(const std::vector<real_type>& data);
+    Span<LivermoreSubshellCdf>
+    build_shell_cdfs(ElementId                           el_id,
+                     const std::vector<UniformGridData>& grids);
 };
 
 //---------------------------------------------------------------------------//
@@ -7,17 +7,40 @@
 //---------------------------------------------------------------------------//
 #include "MollerBhabhaModel.hh"
 
+#include <cmath>
 #include "base/Assert.hh"
+#include "comm/Device.hh"
 #include "physics/base/PDGNumber.hh"
+#include "physics/grid/InverseCdfBuilder.hh"
+#include "detail/BhabhaEnergyDistribution.hh"
+#include "detail/MollerEnergyDistribution.hh"
 
 namespace celeritas
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Energy grid for an inverse CDF table with 10 points per decade.
+ */
+UniformGridData make_table_grid(real_type emin, real_type emax)
+{
+    size_type size = std::ceil(10 * std::log10(emax / emin)) + 1;
+    return UniformGridData::from_bounds(std::log(emin), std::log(emax), size);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct from model ID and other necessary data.
  */
 MollerBhabhaModel::MollerBhabhaModel(ModelId               id,
-                                     const ParticleParams& particles)
+                                     const ParticleParams& particles,
+                                     bool                  tabulate_sampling)
 {
     CELER_EXPECT(id);
     interface_.model_id    = id;
@@ -31,8 +54,53 @@ MollerBhabhaModel::MollerBhabhaModel(ModelId               id,
     interface_.electron_mass_c_sq
         = particles.get(interface_.electron_id).mass().value(); // [MeV]
     interface_.min_valid_energy = 1e-3;                       // [MeV]
+    host_interface_             = interface_;
+
+    if (tabulate_sampling)
+    {
+        // Tabulate over the applicable energy ranges
+        const real_type mass   = interface_.electron_mass_c_sq;
+        const real_type min_e  = interface_.min_valid_energy;
+        const real_type max_e  = this->applicability().begin()->upper.value();
+        const size_type num_xi = 129;
+        InverseCdfGridData moller;
+        moller.log_energy = make_table_grid(2 * min_e, max_e);
+        moller.num_xi     = num_xi;
+        InverseCdfGridData bhabha;
+        bhabha.log_energy = make_table_grid(min_e, max_e);
+        bhabha.num_xi     = num_xi;
+
+        host_tables_ = InverseCdfBuilder(moller.log_energy, num_xi)(
+            [mass, min_e](real_type e, real_type u) {
+                return detail::MollerEnergyDistribution(mass, min_e, e)
+                    .calc_scaled_pdf(u);
+            });
+        const size_type moller_size = host_tables_.size();
+        auto bhabha_values = InverseCdfBuilder(bhabha.log_energy, num_xi)(
+            [mass, min_e](real_type e, real_type u) {
+                return detail::BhabhaEnergyDistribution(mass, min_e, e)
+                    .calc_scaled_pdf(u);
+            });
+        host_tables_.insert(
+            host_tables_.end(), bhabha_values.begin(), bhabha_values.end());
+
+        auto assign_tables = [&](Span<const real_type>         values,
+                                 detail::MollerBhabhaPointers* pointers) {
+            moller.values          = values.subspan(0, moller_size);
+            bhabha.values          = values.subspan(moller_size);
+            pointers->moller_table = moller;
+            pointers->bhabha_table = bhabha;
+        };
+        assign_tables(make_span(host_tables_), &host_interface_);
+        if (celeritas::device())
+        {
+            device_tables_ = DeviceVector<real_type>(host_tables_.size());
+            device_tables_.copy_to_device(make_span(host_tables_));
+            assign_tables(device_tables_.device_pointers(), &interface_);
+        }
+    }
 
-    CELER_ENSURE(interface_);
+    CELER_ENSURE(interface_ && host_interface_);
 }
 
 //---------------------------------------------------------------------------//
@@ -72,6 +140,24 @@ void MollerBhabhaModel::interact(
 #endif
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Access data on device.
+ */
+detail::MollerBhabhaPointers MollerBhabhaModel::device_pointers() const
+{
+    return interface_;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access data on host.
+ */
+detail::MollerBhabhaPointers MollerBhabhaModel::host_pointers() const
+{
+    return host_interface_;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Get the model ID for this model.
@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <vector>
+#include "base/DeviceVector.hh"
 #include "physics/base/Model.hh"
 #include "physics/base/ParticleParams.hh"
 #include "detail/MollerBhabha.hh"
@@ -16,12 +18,18 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 /*!
  * Set up and launch the Moller-Bhabha model interaction.
+ *
+ * If \c tabulate_sampling is enabled, inverse CDF tables for the secondary
+ * energy fraction are built at construction, and the interactor uses them
+ * instead of the rejection loops.
  */
 class MollerBhabhaModel final : public Model
 {
   public:
     // Construct from model ID and other necessary data
-    MollerBhabhaModel(ModelId id, const ParticleParams& particles);
+    MollerBhabhaModel(ModelId               id,
+                      const ParticleParams& particles,
+                      bool                  tabulate_sampling = false);
 
     // Particle types and energy ranges that this model applies to
     SetApplicability applicability() const final;
@@ -35,8 +43,17 @@ class MollerBhabhaModel final : public Model
     //! Name of the model, for user interaction
     std::string label() const final { return "Moller/Bhabha scattering"; }
 
+    // Access data on device
+    detail::MollerBhabhaPointers device_pointers() const;
+
+    // Access data on host
+    detail::MollerBhabhaPointers host_pointers() const;
+
   private:
     detail::MollerBhabhaPointers interface_;
+    detail::MollerBhabhaPointers host_interface_;
+    std::vector<real_type>       host_tables_;
+    DeviceVector<real_type>      device_tables_;
 };
 
 //---------------------------------------------------------------------------//
@@ -17,15 +17,18 @@ namespace celeritas
  * Construct from host data.
  */
 PhotoelectricProcess::PhotoelectricProcess(SPConstParticles   particles,
+                                           SPConstMaterials   materials,
                                            ImportPhysicsTable xs_lo,
                                            ImportPhysicsTable xs_hi,
                                            SPConstData        data)
     : particles_(std::move(particles))
+    , materials_(std::move(materials))
     , xs_lo_(std::move(xs_lo))
     , xs_hi_(std::move(xs_hi))
     , data_(std::move(data))
 {
     CELER_EXPECT(particles_);
+    CELER_EXPECT(materials_);
     CELER_EXPECT(xs_lo_.table_type == ImportTableType::lambda);
     CELER_EXPECT(xs_hi_.table_type == ImportTableType::lambda_prim);
     CELER_EXPECT(!xs_lo_.physics_vectors.empty());
@@ -40,12 +43,14 @@ PhotoelectricProcess::PhotoelectricProcess(SPConstParticles   particles,
  */
 PhotoelectricProcess::PhotoelectricProcess(
     SPConstParticles                particles,
+    SPConstMaterials                materials,
     ImportPhysicsTable              xs_lo,
     ImportPhysicsTable              xs_hi,
     SPConstData                     data,
     SPConstAtomicRelax              atomic_relaxation,
     SPConstSubshellIdAllocatorStore vacancies)
     : PhotoelectricProcess(std::move(particles),
+                           std::move(materials),
                            std::move(xs_lo),
                            std::move(xs_hi),
                            std::move(data))
@@ -66,14 +71,18 @@ auto PhotoelectricProcess::build_models(ModelIdGenerator next_id) const
     if (atomic_relaxation_)
     {
         // Construct model with atomic relaxation enabled
-        return {std::make_shared<LivermorePEModel>(
-            next_id(), *particles_, *data_, *atomic_relaxation_, vacancies_)};
+        return {std::make_shared<LivermorePEModel>(next_id(),
+                                                   *particles_,
+                                                   *materials_,
+                                                   *data_,
+                                                   *atomic_relaxation_,
+                                                   vacancies_)};
     }
     else
     {
         // Construct model without atomic relaxation
         return {std::make_shared<LivermorePEModel>(
-            next_id(), *particles_, *data_)};
+            next_id(), *particles_, *materials_, *data_)};
     }
 }
 
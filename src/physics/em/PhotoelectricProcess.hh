@@ -13,6 +13,7 @@
 #include "physics/base/ParticleParams.hh"
 #include "physics/em/AtomicRelaxationParams.hh"
 #include "physics/em/LivermorePEParams.hh"
+#include "physics/material/MaterialParams.hh"
 
 namespace celeritas
 {
@@ -26,6 +27,7 @@ class PhotoelectricProcess : public Process
     //!@{
     //! Type aliases
     using SPConstParticles   = std::shared_ptr<const ParticleParams>;
+    using SPConstMaterials   = std::shared_ptr<const MaterialParams>;
     using SPConstData        = std::shared_ptr<const LivermorePEParams>;
     using SPConstAtomicRelax = std::shared_ptr<const AtomicRelaxationParams>;
     using SPConstSubshellIdAllocatorStore
@@ -35,12 +37,14 @@ class PhotoelectricProcess : public Process
   public:
     // Construct from Livermore photoelectric data
     PhotoelectricProcess(SPConstParticles   particles,
+                         SPConstMaterials   materials,
                          ImportPhysicsTable xs_lo,
                          ImportPhysicsTable xs_hi,
                          SPConstData        data);
 
     // Construct from Livermore data and EADL atomic relaxation data
     PhotoelectricProcess(SPConstParticles                particles,
+                         SPConstMaterials                materials,
                          ImportPhysicsTable              xs_lo,
                          ImportPhysicsTable              xs_hi,
                          SPConstData                     data,
@@ -58,6 +62,7 @@ class PhotoelectricProcess : public Process
 
   private:
     SPConstParticles                particles_;
+    SPConstMaterials                materials_;
     ImportPhysicsTable              xs_lo_;
     ImportPhysicsTable              xs_hi_;
     SPConstData                     data_;
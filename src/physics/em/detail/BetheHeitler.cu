@@ -39,7 +39,7 @@ __global__ void bethe_heitler_interact_kernel(const BetheHeitlerPointers  bh,
     SecondaryAllocatorView allocate_secondaries(ptrs.secondaries);
     ParticleTrackView particle(ptrs.params.particle, ptrs.states.particle, tid);
 
-    // Setup for ElementView access
+    // Setup for element access
     MaterialTrackView material(ptrs.params.material, ptrs.states.material, tid);
     // Cache the associated MaterialView as function calls to MaterialTrackView
     // are expensive
@@ -62,7 +62,7 @@ __global__ void bethe_heitler_interact_kernel(const BetheHeitlerPointers  bh,
         particle,
         ptrs.states.direction[tid.get()],
         allocate_secondaries,
-        material_view.element_view(celeritas::ElementComponentId{0}));
+        material_view.element_id(celeritas::ElementComponentId{0}));
 
     RngEngine rng(ptrs.states.rng, tid);
     ptrs.result[tid.get()] = interact(rng);
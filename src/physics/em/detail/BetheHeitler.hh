@@ -8,6 +8,7 @@
 #pragma once
 
 #include "base/Macros.hh"
+#include "base/Span.hh"
 #include "base/Types.hh"
 #include "physics/base/Types.hh"
 
@@ -17,6 +18,23 @@ struct ModelInteractPointers;
 
 namespace detail
 {
+//---------------------------------------------------------------------------//
+/*!
+ * Per-element constants for sampling the Bethe-Heitler energy fraction.
+ *
+ * These depend only on the atomic number, so they are calculated once at
+ * model construction rather than for every interaction.
+ */
+struct BetheHeitlerElementData
+{
+    //! Screening factor 136 / Z^{1/3}: delta = factor * eps0 / (eps (1-eps))
+    real_type screening_factor{0};
+    //! Coulomb correction f_c(Z) [unitless]
+    real_type coulomb_correction{0};
+    //! Maximum screening variable, exp((42.24 - f_c) / 8.368) - 0.952
+    real_type delta_max{0};
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Device data for creating a BetheHeitlerInteractor.
@@ -35,11 +53,14 @@ struct BetheHeitlerPointers
     //! ID of a gamma
     ParticleId gamma_id;
 
+    //! Precalculated constants, indexed by ElementId
+    Span<const BetheHeitlerElementData> elements;
+
     //! Check whether the view is assigned
     explicit inline CELER_FUNCTION operator bool() const
     {
         return model_id && inv_electron_mass > 0 && electron_id && positron_id
-               && gamma_id;
+               && gamma_id && !elements.empty();
     }
 };
 
@@ -14,7 +14,7 @@
 #include "physics/base/Secondary.hh"
 #include "physics/base/SecondaryAllocatorView.hh"
 #include "physics/base/Units.hh"
-#include "physics/material/ElementView.hh"
+#include "physics/material/Types.hh"
 #include "BetheHeitler.hh"
 
 namespace celeritas
@@ -43,7 +43,7 @@ class BetheHeitlerInteractor
                            const ParticleTrackView&    particle,
                            const Real3&                inc_direction,
                            SecondaryAllocatorView&     allocate,
-                           const ElementView&          element);
+                           ElementId                   element);
 
     // Sample an interaction with the given RNG
     template<class Engine>
@@ -92,8 +92,8 @@ class BetheHeitlerInteractor
     // Allocate space for a secondary particle
     SecondaryAllocatorView& allocate_;
 
-    // Element properties for calculating screening functions and variables
-    const ElementView& element_;
+    // Precalculated element constants for screening functions and variables
+    const BetheHeitlerElementData& element_;
 
     // Cached minimum epsilon, m_e*c^2/E_gamma; kinematical limit for Y -> e+e-
     real_type epsilon0_;
@@ -28,20 +28,19 @@ BetheHeitlerInteractor::BetheHeitlerInteractor(
     const ParticleTrackView&    particle,
     const Real3&                inc_direction,
     SecondaryAllocatorView&     allocate,
-    const ElementView&          element)
+    ElementId                   element)
     : shared_(shared)
     , inc_energy_(particle.energy().value())
     , inc_direction_(inc_direction)
     , allocate_(allocate)
-    , element_(element)
+    , element_(shared.elements[element.get()])
 {
     CELER_EXPECT(particle.particle_id() == shared_.gamma_id);
+    CELER_EXPECT(element < shared_.elements.size());
 
     epsilon0_ = 1.0 / (shared_.inv_electron_mass * inc_energy_.value());
     // Gamma energy must be at least 2x electron rest mass
     CELER_ASSERT(epsilon0_ < 0.5);
-    static_assert(sizeof(real_type) == sizeof(double),
-                  "Embedded constants are hardcoded to double precision.");
 }
 
 //---------------------------------------------------------------------------//
@@ -72,9 +71,8 @@ CELER_FUNCTION Interaction BetheHeitlerInteractor::operator()(Engine& rng)
     {
         // Minimum (\epsilon = 0.5) and maximum (\epsilon = \epsilon1) values
         // of screening variable, \delta.
-        real_type delta_min = 136.0 / element_.cbrt_z() * 4.0 * epsilon0_;
-        real_type delta_max
-            = std::exp((42.24 - element_.coulomb_correction()) / 8.368) - 0.952;
+        real_type delta_min = element_.screening_factor * 4.0 * epsilon0_;
+        real_type delta_max = element_.delta_max;
         CELER_ASSERT(delta_min <= delta_max);
 
         // Limits on epsilon
@@ -106,8 +104,9 @@ CELER_FUNCTION Interaction BetheHeitlerInteractor::operator()(Engine& rng)
                 CELER_ASSERT(delta <= delta_max && delta >= delta_min);
                 // Calculate g1 "rejection" function
                 reject_threshold
-                    = celeritas::max(this->screening_phi1_aux(delta), 0.0)
-                      / celeritas::max(f10, 0.0);
+                    = celeritas::max(this->screening_phi1_aux(delta),
+                                     real_type(0))
+                      / celeritas::max(f10, real_type(0));
                 CELER_ASSERT(reject_threshold > 0.0 && reject_threshold <= 1.0);
             }
             else
@@ -122,8 +121,9 @@ CELER_FUNCTION Interaction BetheHeitlerInteractor::operator()(Engine& rng)
                 CELER_ASSERT(delta <= delta_max && delta >= delta_min);
                 // Calculate g2 "rejection" function
                 reject_threshold
-                    = celeritas::max(this->screening_phi2_aux(delta), 0.0)
-                      / celeritas::max(f20, 0.0);
+                    = celeritas::max(this->screening_phi2_aux(delta),
+                                     real_type(0))
+                      / celeritas::max(f20, real_type(0));
                 CELER_ASSERT(reject_threshold > 0.0 && reject_threshold <= 1.0);
             }
         } while (BernoulliDistribution(1.0 - reject_threshold)(rng));
@@ -137,7 +137,7 @@ CELER_FUNCTION Interaction BetheHeitlerInteractor::operator()(Engine& rng)
     secondaries[0].particle_id = shared_.electron_id;
     secondaries[1].particle_id = shared_.positron_id;
     secondaries[0].energy
-        = units::MevEnergy{(1.0 - epsilon) * inc_energy_.value()};
+        = units::MevEnergy{(real_type(1) - epsilon) * inc_energy_.value()};
     secondaries[1].energy = units::MevEnergy{epsilon * inc_energy_.value()};
     // Select charges for child particles (e-, e+) randomly
     if (BernoulliDistribution(0.5)(rng))
@@ -183,7 +183,7 @@ BetheHeitlerInteractor::sample_cos_theta(real_type kinetic_energy, Engine& rng)
 CELER_FUNCTION real_type
 BetheHeitlerInteractor::impact_parameter(real_type eps) const
 {
-    return 136.0 / element_.cbrt_z() * epsilon0_ / (eps * (1.0 - eps));
+    return element_.screening_factor * epsilon0_ / (eps * (1.0 - eps));
 }
 
 CELER_FUNCTION real_type
@@ -204,7 +204,7 @@ CELER_FUNCTION real_type
 BetheHeitlerInteractor::screening_phi1_aux(real_type delta) const
 {
     return (3.0 * this->screening_phi1(delta) - this->screening_phi2(delta)
-            - element_.coulomb_correction());
+            - element_.coulomb_correction);
 }
 
 CELER_FUNCTION real_type
@@ -212,7 +212,7 @@ BetheHeitlerInteractor::screening_phi2_aux(real_type delta) const
 {
     return (1.5 * this->screening_phi1(delta)
             - 0.5 * this->screening_phi2(delta)
-            - element_.coulomb_correction());
+            - element_.coulomb_correction);
 }
 
 //---------------------------------------------------------------------------//
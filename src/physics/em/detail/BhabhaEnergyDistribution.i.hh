@@ -52,17 +52,45 @@ CELER_FUNCTION real_type BhabhaEnergyDistribution::operator()(Engine& rng)
         epsilon     = 1 / sample_inverse_epsilon(rng);
         g_numerator = this->calc_g_fraction(epsilon, epsilon);
 
-    } while (BernoulliDistribution(g_numerator / g_denominator)(rng));
+    } while (!BernoulliDistribution(g_numerator / g_denominator)(rng));
 
     return epsilon;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Unnormalized density of the scaled sampling variable.
+ *
+ * The inverse energy fraction, which is the proposal distribution of the
+ * rejection loop, is scaled linearly to [0, 1]. The density of the scaled
+ * variable is then proportional to the rejection function.
+ */
+CELER_FUNCTION real_type
+BhabhaEnergyDistribution::calc_scaled_pdf(real_type scaled) const
+{
+    const real_type epsilon = this->calc_epsilon(scaled);
+    return this->calc_g_fraction(epsilon, epsilon);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Energy fraction corresponding to the scaled sampling variable.
+ */
+CELER_FUNCTION real_type
+BhabhaEnergyDistribution::calc_epsilon(real_type scaled) const
+{
+    CELER_EXPECT(scaled >= 0 && scaled <= 1);
+    const real_type inv_min = 1 / this->max_energy_fraction();
+    const real_type inv_max = 1 / min_energy_fraction_;
+    return 1 / (inv_min + scaled * (inv_max - inv_min));
+}
+
 //---------------------------------------------------------------------------//
 /*
  * Helper function for calculating rejection function g.
  */
 CELER_FUNCTION real_type BhabhaEnergyDistribution::calc_g_fraction(
-    real_type epsilon_min, real_type epsilon_max)
+    real_type epsilon_min, real_type epsilon_max) const
 {
     const real_type y            = 1.0 / (1.0 + gamma_);
     const real_type y_sq         = ipow<2>(y);
@@ -14,6 +14,7 @@
 #include "physics/base/ParticleTrackView.hh"
 #include "physics/base/PhysicsTrackView.hh"
 #include "physics/base/SecondaryAllocatorView.hh"
+#include "physics/material/MaterialTrackView.hh"
 #include "KleinNishinaInteractor.hh"
 
 namespace celeritas
@@ -37,19 +38,23 @@ __global__ void klein_nishina_interact_kernel(const KleinNishinaPointers  kn,
 
     SecondaryAllocatorView allocate_secondaries(ptrs.secondaries);
     ParticleTrackView particle(ptrs.params.particle, ptrs.states.particle, tid);
+    MaterialTrackView material(ptrs.params.material, ptrs.states.material, tid);
 
     PhysicsTrackView physics(ptrs.params.physics,
                              ptrs.states.physics,
                              particle.particle_id(),
-                             MaterialId{},
+                             material.material_id(),
                              tid);
 
     // This interaction only applies if the KN model was selected
     if (physics.model_id() != kn.model_id)
         return;
 
-    KleinNishinaInteractor interact(
-        kn, particle, ptrs.states.direction[tid.get()], allocate_secondaries);
+    KleinNishinaInteractor interact(kn,
+                                    particle,
+                                    ptrs.states.direction[tid.get()],
+                                    allocate_secondaries,
+                                    physics.production_cut(kn.electron_id));
 
     RngEngine rng(ptrs.states.rng, tid);
     ptrs.result[tid.get()] = interact(rng);
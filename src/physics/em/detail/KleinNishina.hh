@@ -10,6 +10,7 @@
 #include "base/Macros.hh"
 #include "base/Types.hh"
 #include "physics/base/Types.hh"
+#include "physics/grid/InverseCdfInterface.hh"
 
 namespace celeritas
 {
@@ -32,6 +33,8 @@ struct KleinNishinaPointers
     ParticleId electron_id;
     //! ID of a gamma
     ParticleId gamma_id;
+    //! Optional inverse CDF of log(epsilon) / log(epsilon_0)
+    InverseCdfGridData epsilon_table;
 
     //! Check whether the data is assigned
     explicit CELER_FUNCTION operator bool() const
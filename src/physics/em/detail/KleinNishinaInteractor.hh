@@ -28,11 +28,16 @@ namespace detail
  * an incident gamma, it adds a single secondary (electron) to the secondary
  * stack and returns an interaction for the change to the incident gamma
  * direction and energy. No cutoffs are performed for the incident energy or
- * the exiting gamma energy.
+ * the exiting gamma energy. If the electron energy is below the production
+ * cut, no secondary is allocated and its energy is deposited locally.
  *
  * \note This performs the same sampling routine as in Geant4's
  *  G4KleinNishinaCompton, as documented in section 6.4.2 of the Geant4 Physics
  *  Reference (release 10.6).
+ *
+ * If the shared data has an inverse CDF table covering the incident energy,
+ * the energy fraction is instead sampled from the table with a single random
+ * number and no rejection loop.
  */
 class KleinNishinaInteractor
 {
@@ -42,12 +47,17 @@ class KleinNishinaInteractor
     KleinNishinaInteractor(const KleinNishinaPointers& shared,
                            const ParticleTrackView&    particle,
                            const Real3&                inc_direction,
-                           SecondaryAllocatorView&     allocate);
+                           SecondaryAllocatorView&     allocate,
+                           units::MevEnergy            electron_cut);
 
     // Sample an interaction with the given RNG
     template<class Engine>
     inline CELER_FUNCTION Interaction operator()(Engine& rng);
 
+    // Unnormalized density of the scaled log of the energy fraction
+    static inline CELER_FUNCTION real_type
+    calc_scaled_pdf(real_type inc_energy_per_mecsq, real_type scaled);
+
   private:
     // Constant data
     const KleinNishinaPointers& shared_;
@@ -57,6 +67,8 @@ class KleinNishinaInteractor
     const Real3& inc_direction_;
     // Allocate space for a secondary particle
     SecondaryAllocatorView& allocate_;
+    // Production threshold for the secondary electron
+    const units::MevEnergy electron_cut_;
 };
 
 //---------------------------------------------------------------------------//
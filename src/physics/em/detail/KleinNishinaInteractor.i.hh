@@ -5,8 +5,10 @@
 //---------------------------------------------------------------------------//
 //! \file KleinNishinaInteractor.i.hh
 //---------------------------------------------------------------------------//
+#include "base/Algorithms.hh"
 #include "base/ArrayUtils.hh"
 #include "base/Constants.hh"
+#include "physics/grid/InverseCdfSampler.hh"
 #include "random/distributions/BernoulliDistribution.hh"
 #include "random/distributions/GenerateCanonical.hh"
 #include "random/distributions/UniformRealDistribution.hh"
@@ -26,11 +28,13 @@ CELER_FUNCTION KleinNishinaInteractor::KleinNishinaInteractor(
     const KleinNishinaPointers& shared,
     const ParticleTrackView&    particle,
     const Real3&                inc_direction,
-    SecondaryAllocatorView&     allocate)
+    SecondaryAllocatorView&     allocate,
+    units::MevEnergy            electron_cut)
     : shared_(shared)
     , inc_energy_(particle.energy().value())
     , inc_direction_(inc_direction)
     , allocate_(allocate)
+    , electron_cut_(electron_cut)
 {
     CELER_EXPECT(particle.particle_id() == shared_.gamma_id);
 }
@@ -45,63 +49,69 @@ CELER_FUNCTION KleinNishinaInteractor::KleinNishinaInteractor(
 template<class Engine>
 CELER_FUNCTION Interaction KleinNishinaInteractor::operator()(Engine& rng)
 {
-    // Allocate space for the single electron to be emitted
-    Secondary* electron_secondary = this->allocate_(1);
-    if (electron_secondary == nullptr)
-    {
-        // Failed to allocate space for a secondary
-        return Interaction::from_failure();
-    }
-
     // Value of epsilon corresponding to minimum photon energy
     const real_type inc_energy_per_mecsq = inc_energy_.value()
                                            * shared_.inv_electron_mass;
     const real_type epsilon_0     = 1 / (1 + 2 * inc_energy_per_mecsq);
     const real_type log_epsilon_0 = std::log(epsilon_0);
 
-    // Probability of alpha_1 to choose f1 (sample epsilon)
-    BernoulliDistribution choose_f1(-log_epsilon_0,
-                                    0.5 * (1 - epsilon_0 * epsilon_0));
-    // Sample square of f_2(\eps) \propto \eps on [\eps_0, 1]
-    UniformRealDistribution<real_type> sample_f2_sq(epsilon_0 * epsilon_0, 1);
-
-    // Rejection loop: sample epsilon (energy change) and direction change
     real_type epsilon;
     real_type one_minus_costheta;
-    // Temporary sample values used in rejection
-    real_type acceptance_prob;
-    do
+    if (InverseCdfSampler::in_range(shared_.epsilon_table, inc_energy_))
     {
-        // Sample epsilon and square
-        real_type epsilon_sq;
-        if (choose_f1(rng))
-        {
-            // Sample f_1(\eps) \propto 1/\eps on [\eps_0, 1]
-            // => \eps \gets \eps_0^\xi = \exp(\xi \log \eps_0)
-            epsilon    = std::exp(log_epsilon_0 * generate_canonical(rng));
-            epsilon_sq = epsilon * epsilon;
-        }
-        else
+        // Sample \log \eps / \log \eps_0 from the tabulated distribution
+        InverseCdfSampler sample_scaled(shared_.epsilon_table, inc_energy_);
+        epsilon = std::exp(log_epsilon_0 * sample_scaled(rng));
+        one_minus_costheta
+            = min((1 - epsilon) / (epsilon * inc_energy_per_mecsq),
+                  real_type(2));
+    }
+    else
+    {
+        // Probability of alpha_1 to choose f1 (sample epsilon)
+        BernoulliDistribution choose_f1(-log_epsilon_0,
+                                        0.5 * (1 - epsilon_0 * epsilon_0));
+        // Sample square of f_2(\eps) \propto \eps on [\eps_0, 1]
+        UniformRealDistribution<real_type> sample_f2_sq(epsilon_0 * epsilon_0,
+                                                        1);
+
+        // Rejection loop: sample epsilon (energy change) and direction change
+        // Temporary sample values used in rejection
+        real_type acceptance_prob;
+        do
         {
-            // Sample f_2(\eps) = 2 * \eps / (1 - epsilon_0 * epsilon_0)
-            epsilon_sq = sample_f2_sq(rng);
-            epsilon    = std::sqrt(epsilon_sq);
-        }
-        CELER_ASSERT(epsilon >= epsilon_0 && epsilon <= 1);
+            // Sample epsilon and square
+            real_type epsilon_sq;
+            if (choose_f1(rng))
+            {
+                // Sample f_1(\eps) \propto 1/\eps on [\eps_0, 1]
+                // => \eps \gets \eps_0^\xi = \exp(\xi \log \eps_0)
+                epsilon = std::exp(log_epsilon_0 * generate_canonical(rng));
+                epsilon_sq = epsilon * epsilon;
+            }
+            else
+            {
+                // Sample f_2(\eps) = 2 * \eps / (1 - epsilon_0 * epsilon_0)
+                epsilon_sq = sample_f2_sq(rng);
+                epsilon    = std::sqrt(epsilon_sq);
+            }
+            CELER_ASSERT(epsilon >= epsilon_0 && epsilon <= 1);
 
-        // Calculate angles: need sin^2 \theta for rejection
-        one_minus_costheta = (1 - epsilon) / (epsilon * inc_energy_per_mecsq);
-        CELER_ASSERT(one_minus_costheta >= 0 && one_minus_costheta <= 2);
-        real_type sintheta_sq = one_minus_costheta * (2 - one_minus_costheta);
-        acceptance_prob       = epsilon * sintheta_sq / (1 + epsilon_sq);
-    } while (BernoulliDistribution(acceptance_prob)(rng));
+            // Calculate angles: need sin^2 \theta for rejection
+            one_minus_costheta = (1 - epsilon)
+                                 / (epsilon * inc_energy_per_mecsq);
+            CELER_ASSERT(one_minus_costheta >= 0 && one_minus_costheta <= 2);
+            real_type sintheta_sq = one_minus_costheta
+                                    * (2 - one_minus_costheta);
+            acceptance_prob = epsilon * sintheta_sq / (1 + epsilon_sq);
+        } while (BernoulliDistribution(acceptance_prob)(rng));
+    }
 
     // Construct interaction for change to primary (incident) particle
     Interaction result;
     result.action      = Action::scattered;
     result.energy      = units::MevEnergy{epsilon * inc_energy_.value()};
     result.direction   = inc_direction_;
-    result.secondaries = {electron_secondary, 1};
 
     // Sample azimuthal direction and rotate the outgoing direction
     UniformRealDistribution<real_type> sample_phi(0, 2 * constants::pi);
@@ -109,11 +119,28 @@ CELER_FUNCTION Interaction KleinNishinaInteractor::operator()(Engine& rng)
         = rotate(from_spherical(1 - one_minus_costheta, sample_phi(rng)),
                  result.direction);
 
+    // Construct secondary energy by neglecting electron binding energy
+    const units::MevEnergy electron_energy{inc_energy_.value()
+                                           - result.energy.value()};
+    if (electron_energy < electron_cut_)
+    {
+        // Deposit the electron energy locally without allocating it
+        result.energy_deposition = electron_energy;
+        return result;
+    }
+
+    // Allocate space for the single electron to be emitted
+    Secondary* electron_secondary = this->allocate_(1);
+    if (electron_secondary == nullptr)
+    {
+        // Failed to allocate space for a secondary
+        return Interaction::from_failure();
+    }
+    result.secondaries = {electron_secondary, 1};
+
     // Outgoing secondary is an electron
     electron_secondary->particle_id = shared_.electron_id;
-    // Construct secondary energy by neglecting electron binding energy
-    electron_secondary->energy
-        = units::MevEnergy{inc_energy_.value() - result.energy.value()};
+    electron_secondary->energy      = electron_energy;
     // Calculate exiting electron direction via conservation of momentum
     for (int i = 0; i < 3; ++i)
     {
@@ -123,11 +150,32 @@ CELER_FUNCTION Interaction KleinNishinaInteractor::operator()(Engine& rng)
     }
     normalize_direction(&electron_secondary->direction);
 
-    // Cutoff for secondary production happens *after* the interaction
-    // code.
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Unnormalized density of the scaled log of the energy fraction.
+ *
+ * The scaled variable \f$ s = \log \epsilon / \log \epsilon_0 \f$ is in
+ * [0, 1]. Transforming the Klein-Nishina differential cross section
+ * \f$ (1/\epsilon + \epsilon)(1 - \epsilon \sin^2\theta / (1 + \epsilon^2))
+ * \f$ by \f$ d\epsilon \propto \epsilon\,ds \f$ gives a smooth, bounded
+ * density that is well suited to tabulation.
+ */
+CELER_FUNCTION real_type KleinNishinaInteractor::calc_scaled_pdf(
+    real_type inc_energy_per_mecsq, real_type scaled)
+{
+    CELER_EXPECT(inc_energy_per_mecsq > 0);
+    CELER_EXPECT(scaled >= 0 && scaled <= 1);
+    const real_type epsilon_0 = 1 / (1 + 2 * inc_energy_per_mecsq);
+    const real_type epsilon   = std::exp(std::log(epsilon_0) * scaled);
+    const real_type one_minus_costheta
+        = min((1 - epsilon) / (epsilon * inc_energy_per_mecsq), real_type(2));
+    const real_type sintheta_sq = one_minus_costheta * (2 - one_minus_costheta);
+    return 1 + epsilon * epsilon - epsilon * sintheta_sq;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace detail
 } // namespace celeritas
@@ -13,10 +13,9 @@
 #include "physics/base/ParticleTrackView.hh"
 #include "physics/base/PhysicsTrackView.hh"
 #include "physics/base/SecondaryAllocatorView.hh"
-#include "physics/material/ElementSelector.hh"
 #include "physics/material/MaterialTrackView.hh"
+#include "physics/material/TabulatedElementSelector.hh"
 #include "LivermorePEInteractor.hh"
-#include "LivermorePEMicroXsCalculator.hh"
 
 namespace celeritas
 {
@@ -30,8 +29,11 @@ namespace
 /*!
  * Interact using the Livermore photoelectric model on applicable tracks.
  */
-__global__ void livermore_pe_interact_kernel(const LivermorePEPointers   pe,
-                                             const ModelInteractPointers ptrs)
+__global__ void livermore_pe_interact_kernel(
+    const LivermorePEPointers pe,
+    const ElementCdfData<Ownership::const_reference, MemSpace::device>
+                                element_cdf,
+    const ModelInteractPointers ptrs)
 {
     auto tid = celeritas::KernelParamCalculator::thread_id();
     if (tid.get() >= ptrs.states.size())
@@ -52,11 +54,9 @@ __global__ void livermore_pe_interact_kernel(const LivermorePEPointers   pe,
 
     RngEngine rng(ptrs.states.rng, tid);
 
-    // Sample an element
-    ElementSelector select_el(
-        material.material_view(),
-        LivermorePEMicroXsCalculator{pe, particle.energy()},
-        material.element_scratch());
+    // Sample an element from the tabulated selection probabilities
+    TabulatedElementSelector select_el(
+        element_cdf, material.material_id(), particle.energy());
     ElementComponentId comp_id = select_el(rng);
     ElementId          el_id   = material.material_view().element_id(comp_id);
 
@@ -64,7 +64,8 @@ __global__ void livermore_pe_interact_kernel(const LivermorePEPointers   pe,
                                    el_id,
                                    particle,
                                    ptrs.states.direction[tid.get()],
-                                   allocate_secondaries);
+                                   allocate_secondaries,
+                                   physics.production_cut(pe.electron_id));
 
     ptrs.result[tid.get()] = interact(rng);
     CELER_ENSURE(ptrs.result[tid.get()]);
@@ -78,17 +79,21 @@ __global__ void livermore_pe_interact_kernel(const LivermorePEPointers   pe,
 /*!
  * Launch the Livermore photoelectric interaction.
  */
-void livermore_pe_interact(const LivermorePEPointers&   pe,
-                           const ModelInteractPointers& model)
+void livermore_pe_interact(
+    const LivermorePEPointers& pe,
+    const ElementCdfData<Ownership::const_reference, MemSpace::device>&
+                                 element_cdf,
+    const ModelInteractPointers& model)
 {
     CELER_EXPECT(pe);
+    CELER_EXPECT(element_cdf);
     CELER_EXPECT(model);
 
     static const KernelParamCalculator calc_kernel_params(
         livermore_pe_interact_kernel, "livermore_pe_interact");
     auto                  params = calc_kernel_params(model.states.size());
     livermore_pe_interact_kernel<<<params.grid_size, params.block_size>>>(
-        pe, model);
+        pe, element_cdf, model);
     CELER_CUDA_CHECK_ERROR();
 }
 
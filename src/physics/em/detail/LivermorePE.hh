@@ -12,6 +12,7 @@
 #include "physics/base/Types.hh"
 #include "physics/em/AtomicRelaxationInterface.hh"
 #include "physics/em/LivermorePEInterface.hh"
+#include "physics/material/ElementCdfInterface.hh"
 
 namespace celeritas
 {
@@ -54,8 +55,11 @@ struct LivermorePEPointers
 //---------------------------------------------------------------------------//
 
 // Launch the Livermore photoelectric interaction
-void livermore_pe_interact(const LivermorePEPointers&   device_pointers,
-                           const ModelInteractPointers& interaction);
+void livermore_pe_interact(
+    const LivermorePEPointers& device_pointers,
+    const ElementCdfData<Ownership::const_reference, MemSpace::device>&
+                                 element_cdf,
+    const ModelInteractPointers& interaction);
 
 //---------------------------------------------------------------------------//
 } // namespace detail
@@ -39,6 +39,14 @@ namespace detail
  * number) the tabulated cross sections are used. The angle of the emitted
  * photoelectron is sampled from the Sauter-Gavrila distribution.
  *
+ * If the element has precalculated subshell selection tables, the subshell is
+ * sampled by interpolating the cumulative probabilities rather than
+ * recalculating the subshell cross sections.
+ *
+ * A photoelectron below the electron production cut is deposited locally. It
+ * is only allocated if atomic relaxation shares its secondary storage, in
+ * which case it is emitted as a null (killed) secondary.
+ *
  * \note This performs the same sampling routine as in Geant4's
  * G4LivermorePhotoElectricModel class, as documented in section 6.3.5 of the
  * Geant4 Physics Reference (release 10.6).
@@ -58,7 +66,8 @@ class LivermorePEInteractor
                           ElementId                  el_id,
                           const ParticleTrackView&   particle,
                           const Real3&               inc_direction,
-                          SecondaryAllocatorView&    allocate);
+                          SecondaryAllocatorView&    allocate,
+                          MevEnergy                  electron_cut);
 
     // Sample an interaction with the given RNG
     template<class Engine>
@@ -75,6 +84,8 @@ class LivermorePEInteractor
     const MevEnergy inc_energy_;
     // Allocate space for one or more secondary particles
     SecondaryAllocatorView& allocate_;
+    // Production threshold for the photoelectron
+    const MevEnergy electron_cut_;
     // Microscopic cross section calculator
     LivermorePEMicroXsCalculator calc_micro_xs_;
     // Reciprocal of the energy
@@ -82,6 +93,16 @@ class LivermorePEInteractor
 
     //// HELPER FUNCTIONS ////
 
+    // Sample the subshell by calculating subshell cross sections
+    template<class Engine>
+    inline CELER_FUNCTION SubshellId::size_type
+    sample_subshell(const LivermoreElement& el, Engine& rng) const;
+
+    // Sample the subshell from tabulated cumulative probabilities
+    template<class Engine>
+    inline CELER_FUNCTION SubshellId::size_type
+    sample_tabulated_subshell(const LivermoreElement& el, Engine& rng) const;
+
     // Sample the direction of the emitted photoelectron
     template<class Engine>
     inline CELER_FUNCTION Real3 sample_direction(Engine& rng) const;
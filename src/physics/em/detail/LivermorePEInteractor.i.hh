@@ -9,6 +9,8 @@
 #include "base/ArrayUtils.hh"
 #include "physics/em/AtomicRelaxationHelper.hh"
 #include "physics/em/LivermoreXsCalculator.hh"
+#include "physics/grid/UniformGrid.hh"
+#include "random/distributions/GenerateCanonical.hh"
 #include "random/distributions/UniformRealDistribution.hh"
 
 namespace celeritas
@@ -27,12 +29,14 @@ LivermorePEInteractor::LivermorePEInteractor(const LivermorePEPointers& shared,
                                              ElementId                  el_id,
                                              const ParticleTrackView& particle,
                                              const Real3& inc_direction,
-                                             SecondaryAllocatorView& allocate)
+                                             SecondaryAllocatorView& allocate,
+                                             MevEnergy electron_cut)
     : shared_(shared)
     , el_id_(el_id)
     , inc_direction_(inc_direction)
     , inc_energy_(particle.energy().value())
     , allocate_(allocate)
+    , electron_cut_(electron_cut)
     , calc_micro_xs_(shared, particle.energy())
 {
     CELER_EXPECT(particle.particle_id() == shared_.gamma_id);
@@ -48,11 +52,43 @@ LivermorePEInteractor::LivermorePEInteractor(const LivermorePEPointers& shared,
 template<class Engine>
 CELER_FUNCTION Interaction LivermorePEInteractor::operator()(Engine& rng)
 {
+    // Sample the shell from which the photoelectron is emitted
+    const LivermoreElement& el = shared_.data.elements[el_id_.get()];
+    SubshellId::size_type   shell_id
+        = el.shell_cdfs.empty() ? this->sample_subshell(el, rng)
+                                : this->sample_tabulated_subshell(el, rng);
+
+    // Construct interaction for change to primary (incident) particle
+    Interaction result = Interaction::from_absorption();
+
+    // If the binding energy of the sampled shell is greater than the incident
+    // photon energy, no secondaries are produced and the energy is deposited
+    // locally.
+    MevEnergy binding_energy = el.shells[shell_id].binding_energy;
+    if (binding_energy > inc_energy_)
+    {
+        result.energy_deposition = inc_energy_;
+        return result;
+    }
+
+    // Electron kinetic energy is the difference between the incident photon
+    // energy and the binding energy of the shell
+    const MevEnergy electron_energy{inc_energy_.value()
+                                    - binding_energy.value()};
+    const bool      emit_electron = !(electron_energy < electron_cut_);
+
+    AtomicRelaxationHelper relax_helper(
+        shared_.atomic_relaxation, shared_.vacancies, el_id_, allocate_, 1);
+    if (!emit_electron && !relax_helper)
+    {
+        // Deposit everything locally without allocating any secondaries
+        result.energy_deposition = inc_energy_;
+        return result;
+    }
+
     // Allocate space for the single photoelectron emitted plus the maximum
     // possible number of secondaries from atomic relaxation, if enabled, and
     // space to hold the unprocessed vacancies in atomic relaxation, if enabled
-    AtomicRelaxationHelper relax_helper(
-        shared_.atomic_relaxation, shared_.vacancies, el_id_, allocate_, 1);
     Span<Secondary>  secondaries = relax_helper.allocate_secondaries();
     Span<SubshellId> vacancies   = relax_helper.allocate_vacancies();
     if (secondaries.empty() || (secondaries.size() > 1 && vacancies.empty()))
@@ -61,11 +97,56 @@ CELER_FUNCTION Interaction LivermorePEInteractor::operator()(Engine& rng)
         return Interaction::from_failure();
     }
 
-    // Sample the shell from which the photoelectron is emitted
+    real_type local_energy = binding_energy.value();
+    if (emit_electron)
+    {
+        // Outgoing secondary is an electron
+        secondaries.front().particle_id = shared_.electron_id;
+        secondaries.front().energy      = electron_energy;
+
+        // Direction of the emitted photoelectron is sampled from the
+        // Sauter-Gavrila distribution
+        secondaries.front().direction = this->sample_direction(rng);
+    }
+    else
+    {
+        // Photoelectron is below the production cut: leave its slot null and
+        // deposit its energy locally
+        secondaries.front() = Secondary{};
+        local_energy += electron_energy.value();
+    }
+
+    // Sample secondaries from atomic relaxation, if enabled
+    AtomicRelaxation sample_relaxation = relax_helper.build_distribution(
+        secondaries, vacancies, SubshellId{shell_id});
+    auto outgoing      = sample_relaxation(rng);
+    result.secondaries = outgoing.secondaries;
+
+    // The local energy deposition is the difference between the binding
+    // energy of the vacancy subshell and the sum of the energies of any
+    // secondaries created in atomic relaxation, plus the energy of a
+    // suppressed photoelectron
+    result.energy_deposition = MevEnergy{local_energy - outgoing.energy};
+
+    CELER_ENSURE(result.energy_deposition.value() >= 0);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the subshell by calculating the subshell cross sections.
+ *
+ * The outermost shell is returned if no inner shell is selected, even if the
+ * incident energy is below its binding energy.
+ */
+template<class Engine>
+CELER_FUNCTION SubshellId::size_type
+LivermorePEInteractor::sample_subshell(const LivermoreElement& el,
+                                       Engine&                 rng) const
+{
     real_type cutoff = generate_canonical(rng) * calc_micro_xs_(el_id_);
     real_type xs     = 0.;
-    const LivermoreElement& el = shared_.data.elements[el_id_.get()];
-    SubshellId::size_type   shell_id;
+    SubshellId::size_type shell_id;
     for (shell_id = 0; shell_id < el.shells.size() - 1; ++shell_id)
     {
         const auto& shell = el.shells[shell_id];
@@ -100,46 +181,65 @@ CELER_FUNCTION Interaction LivermorePEInteractor::operator()(Engine& rng)
             }
         }
     }
+    return shell_id;
+}
 
-    // Construct interaction for change to primary (incident) particle
-    Interaction result = Interaction::from_absorption();
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the subshell from tabulated cumulative probabilities.
+ *
+ * Subshells are ordered by decreasing binding energy, so the number of closed
+ * subshells (binding energy above the incident energy) selects the table. The
+ * cumulative probability is dominated by the innermost open subshells, so a
+ * short linear search finds the sampled subshell.
+ */
+template<class Engine>
+CELER_FUNCTION SubshellId::size_type
+LivermorePEInteractor::sample_tabulated_subshell(const LivermoreElement& el,
+                                                 Engine& rng) const
+{
+    const size_type num_cols = el.shells.size() - 1;
 
-    // If the binding energy of the sampled shell is greater than the incident
-    // photon energy, no secondaries are produced and the energy is deposited
-    // locally.
-    MevEnergy binding_energy = el.shells[shell_id].binding_energy;
-    if (binding_energy > inc_energy_)
+    // Find the first open subshell
+    size_type first = 0;
+    while (first < num_cols && !(inc_energy_ > el.shells[first].binding_energy))
     {
-        result.energy_deposition = inc_energy_;
-        return result;
+        ++first;
+    }
+    if (first == num_cols)
+    {
+        // Only the outermost shell can be selected
+        return num_cols;
     }
 
-    // Outgoing secondary is an electron
-    secondaries.front().particle_id = shared_.electron_id;
-
-    // Electron kinetic energy is the difference between the incident photon
-    // energy and the binding energy of the shell
-    secondaries.front().energy
-        = MevEnergy{inc_energy_.value() - binding_energy.value()};
-
-    // Direction of the emitted photoelectron is sampled from the
-    // Sauter-Gavrila distribution
-    secondaries.front().direction = this->sample_direction(rng);
-
-    // Sample secondaries from atomic relaxation, if enabled
-    AtomicRelaxation sample_relaxation = relax_helper.build_distribution(
-        secondaries, vacancies, SubshellId{shell_id});
-    auto outgoing      = sample_relaxation(rng);
-    result.secondaries = outgoing.secondaries;
-
-    // The local energy deposition is the difference between the binding
-    // energy of the vacancy subshell and the sum of the energies of any
-    // secondaries created in atomic relaxation
-    result.energy_deposition
-        = MevEnergy{binding_energy.value() - outgoing.energy};
+    // Find the interpolation fraction in log energy
+    const LivermoreSubshellCdf& shell_cdf = el.shell_cdfs[first];
+    const UniformGrid           loge_grid(shell_cdf.log_energy);
+    const real_type             loge = std::log(inc_energy_.value());
+    size_type                   bin  = 0;
+    real_type                   frac = 0;
+    if (loge >= loge_grid.back())
+    {
+        bin  = loge_grid.size() - 2;
+        frac = 1;
+    }
+    else if (loge > loge_grid.front())
+    {
+        bin  = loge_grid.find(loge);
+        frac = (loge - loge_grid[bin]) / shell_cdf.log_energy.delta;
+    }
+    const size_type  width = num_cols - first;
+    const real_type* lower = shell_cdf.cdf.data() + bin * width;
+    const real_type* upper = lower + width;
 
-    CELER_ENSURE(result.energy_deposition.value() >= 0);
-    return result;
+    // Find the first subshell whose cumulative probability exceeds the sample
+    const real_type xi = generate_canonical(rng);
+    size_type       i  = 0;
+    while (i < width && lower[i] + frac * (upper[i] - lower[i]) < xi)
+    {
+        ++i;
+    }
+    return first + i;
 }
 
 //---------------------------------------------------------------------------//
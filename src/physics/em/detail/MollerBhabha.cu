@@ -14,6 +14,7 @@
 #include "physics/base/ParticleTrackView.hh"
 #include "physics/base/PhysicsTrackView.hh"
 #include "physics/base/SecondaryAllocatorView.hh"
+#include "physics/material/MaterialTrackView.hh"
 #include "MollerBhabhaInteractor.hh"
 
 namespace celeritas
@@ -37,19 +38,23 @@ __global__ void moller_bhabha_interact_kernel(const MollerBhabhaPointers  mb,
 
     SecondaryAllocatorView allocate_secondaries(ptrs.secondaries);
     ParticleTrackView particle(ptrs.params.particle, ptrs.states.particle, tid);
+    MaterialTrackView material(ptrs.params.material, ptrs.states.material, tid);
 
     PhysicsTrackView physics(ptrs.params.physics,
                              ptrs.states.physics,
                              particle.particle_id(),
-                             MaterialId{},
+                             material.material_id(),
                              tid);
 
     // This interaction only applies if the MB model was selected
     if (physics.model_id() != mb.model_id)
         return;
 
-    MollerBhabhaInteractor interact(
-        mb, particle, ptrs.states.direction[tid.get()], allocate_secondaries);
+    MollerBhabhaInteractor interact(mb,
+                                    particle,
+                                    ptrs.states.direction[tid.get()],
+                                    allocate_secondaries,
+                                    physics.production_cut(mb.electron_id));
 
     RngEngine rng(ptrs.states.rng, tid);
     ptrs.result[tid.get()] = interact(rng);
@@ -11,6 +11,7 @@
 #include "base/Types.hh"
 #include "physics/base/Types.hh"
 #include "physics/base/Units.hh"
+#include "physics/grid/InverseCdfInterface.hh"
 
 namespace celeritas
 {
@@ -35,6 +36,10 @@ struct MollerBhabhaPointers
     real_type electron_mass_c_sq;
     // Mininum energy limit [MeV]
     real_type min_valid_energy;
+    //! Optional inverse CDF of the scaled inverse Moller energy fraction
+    InverseCdfGridData moller_table;
+    //! Optional inverse CDF of the scaled inverse Bhabha energy fraction
+    InverseCdfGridData bhabha_table;
 
     //! Check whether the data is assigned
     explicit inline CELER_FUNCTION operator bool() const
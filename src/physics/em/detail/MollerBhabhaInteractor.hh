@@ -34,6 +34,13 @@ namespace detail
  * \note This performs the same sampling routine as in Geant4's
  * G4MollerBhabhaModel class, as documented in section 10.1.4 of the Geant4
  * Physics Reference (release 10.6).
+ *
+ * If the shared data has an inverse CDF table covering the incident energy,
+ * the secondary energy fraction is instead sampled from the table with a
+ * single random number and no rejection loop.
+ *
+ * If the sampled delta ray is below the electron production cut, no secondary
+ * is allocated and its energy is deposited locally.
  */
 class MollerBhabhaInteractor
 {
@@ -43,7 +50,8 @@ class MollerBhabhaInteractor
     MollerBhabhaInteractor(const MollerBhabhaPointers& shared,
                            const ParticleTrackView&    particle,
                            const Real3&                inc_direction,
-                           SecondaryAllocatorView&     allocate);
+                           SecondaryAllocatorView&     allocate,
+                           units::MevEnergy            electron_cut);
 
     // Sample an interaction with the given RNG
     template<class Engine>
@@ -60,8 +68,17 @@ class MollerBhabhaInteractor
     const Real3& inc_direction_;
     // Allocate space for one or more secondary particles
     SecondaryAllocatorView& allocate_;
+    // Production threshold for the secondary electron [MeV]
+    const real_type electron_cut_;
     // Incident particle flag for selecting Moller or Bhabha scattering
     bool inc_particle_is_electron_;
+
+    // Sample the energy fraction from the table if possible
+    template<class Distribution, class Engine>
+    inline CELER_FUNCTION real_type
+    sample_epsilon(Distribution&             sample_analytic,
+                   const InverseCdfGridData& table,
+                   Engine&                   rng) const;
 }; // namespace MollerBhabhaInteractor
 
 //---------------------------------------------------------------------------//
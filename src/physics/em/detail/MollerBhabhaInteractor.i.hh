@@ -9,6 +9,7 @@
 #include "base/ArrayUtils.hh"
 #include "base/Constants.hh"
 #include "base/Algorithms.hh"
+#include "physics/grid/InverseCdfSampler.hh"
 #include "random/distributions/UniformRealDistribution.hh"
 #include "random/distributions/BernoulliDistribution.hh"
 #include "MollerEnergyDistribution.hh"
@@ -29,12 +30,14 @@ CELER_FUNCTION MollerBhabhaInteractor::MollerBhabhaInteractor(
     const MollerBhabhaPointers& shared,
     const ParticleTrackView&    particle,
     const Real3&                inc_direction,
-    SecondaryAllocatorView&     allocate)
+    SecondaryAllocatorView&     allocate,
+    units::MevEnergy            electron_cut)
     : shared_(shared)
     , inc_energy_(particle.energy().value())
     , inc_momentum_(particle.momentum().value())
     , inc_direction_(inc_direction)
     , allocate_(allocate)
+    , electron_cut_(electron_cut.value())
     , inc_particle_is_electron_(particle.particle_id() == shared_.electron_id)
 {
     CELER_EXPECT(particle.particle_id() == shared_.electron_id
@@ -51,28 +54,21 @@ CELER_FUNCTION MollerBhabhaInteractor::MollerBhabhaInteractor(
 template<class Engine>
 CELER_FUNCTION Interaction MollerBhabhaInteractor::operator()(Engine& rng)
 {
-    // Allocate memory for the produced electron
-    Secondary* electron_secondary = this->allocate_(1);
-
-    if (electron_secondary == nullptr)
-    {
-        // Fail to allocate space for a secondary
-        return Interaction::from_failure();
-    }
-
     real_type epsilon;
 
     if (inc_particle_is_electron_)
     {
         MollerEnergyDistribution sample_moller(
             shared_.electron_mass_c_sq, shared_.min_valid_energy, inc_energy_);
-        epsilon = sample_moller(rng);
+        epsilon
+            = this->sample_epsilon(sample_moller, shared_.moller_table, rng);
     }
     else
     {
         BhabhaEnergyDistribution sample_bhabha(
             shared_.electron_mass_c_sq, shared_.min_valid_energy, inc_energy_);
-        epsilon = sample_bhabha(rng);
+        epsilon
+            = this->sample_epsilon(sample_bhabha, shared_.bhabha_table, rng);
     }
 
     // Sampled secondary kinetic energy
@@ -90,7 +86,7 @@ CELER_FUNCTION Interaction MollerBhabhaInteractor::operator()(Engine& rng)
         = secondary_energy * (total_energy + shared_.electron_mass_c_sq)
           / (secondary_momentum * inc_momentum_);
 
-    secondary_cos_theta = min(secondary_cos_theta, 1.0);
+    secondary_cos_theta = min(secondary_cos_theta, real_type(1));
     CELER_ASSERT(secondary_cos_theta >= -1.0 && secondary_cos_theta <= 1.0);
 
     // Sample phi isotropically
@@ -114,10 +110,25 @@ CELER_FUNCTION Interaction MollerBhabhaInteractor::operator()(Engine& rng)
     // Construct interaction for change to primary (incident) particle
     const real_type inc_exiting_energy = inc_energy_ - secondary_energy;
     Interaction     result;
-    result.action      = Action::scattered;
-    result.energy      = units::MevEnergy{inc_exiting_energy};
+    result.action    = Action::scattered;
+    result.energy    = units::MevEnergy{inc_exiting_energy};
+    result.direction = inc_exiting_direction;
+
+    if (secondary_energy < electron_cut_)
+    {
+        // Deposit the delta ray energy locally without allocating it
+        result.energy_deposition = units::MevEnergy{secondary_energy};
+        return result;
+    }
+
+    // Allocate memory for the produced electron
+    Secondary* electron_secondary = this->allocate_(1);
+    if (electron_secondary == nullptr)
+    {
+        // Fail to allocate space for a secondary
+        return Interaction::from_failure();
+    }
     result.secondaries = {electron_secondary, 1};
-    result.direction   = inc_exiting_direction;
 
     // Assign values to the secondary particle
     electron_secondary[0].particle_id = shared_.electron_id;
@@ -126,6 +137,28 @@ CELER_FUNCTION Interaction MollerBhabhaInteractor::operator()(Engine& rng)
 
     return result;
 }
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the energy fraction from the table if possible.
+ *
+ * The analytic distribution is used for incident energies outside the table
+ * (or if no table is present).
+ */
+template<class Distribution, class Engine>
+CELER_FUNCTION real_type MollerBhabhaInteractor::sample_epsilon(
+    Distribution& sample_analytic, const InverseCdfGridData& table, Engine& rng)
+    const
+{
+    const units::MevEnergy energy{inc_energy_};
+    if (!InverseCdfSampler::in_range(table, energy))
+    {
+        return sample_analytic(rng);
+    }
+    InverseCdfSampler sample_scaled(table, energy);
+    return sample_analytic.calc_epsilon(sample_scaled(rng));
+}
+
 //---------------------------------------------------------------------------//
 } // namespace detail
 } // namespace celeritas
@@ -33,6 +33,12 @@ class MollerEnergyDistribution
     template<class Engine>
     inline CELER_FUNCTION real_type operator()(Engine& rng);
 
+    // Unnormalized density of the scaled sampling variable
+    inline CELER_FUNCTION real_type calc_scaled_pdf(real_type scaled) const;
+
+    // Energy fraction corresponding to the scaled sampling variable
+    inline CELER_FUNCTION real_type calc_epsilon(real_type scaled) const;
+
   private:
     // Electron incident energy [MeV]
     real_type inc_energy_;
@@ -45,7 +51,7 @@ class MollerEnergyDistribution
 
   private:
     // Helper function for calculating rejection function g
-    inline CELER_FUNCTION real_type calc_g_fraction(real_type epsilon);
+    inline CELER_FUNCTION real_type calc_g_fraction(real_type epsilon) const;
     // Maximum energy fraction transferred to free electron [MeV]
     static CELER_CONSTEXPR_FUNCTION real_type max_energy_fraction()
     {
@@ -9,6 +9,8 @@
 
 #include "base/Macros.hh"
 #include "base/Span.hh"
+#include "base/Types.hh"
+#include "UniformGridInterface.hh"
 
 namespace celeritas
 {
@@ -26,6 +28,12 @@ namespace celeritas
 
     ModelId applicable_model = find_model(particle.energy());
    \endcode
+ *
+ * If a uniform log-spaced lookup is provided, the binary search is replaced
+ * by a constant-time lookup. Each bin of the uniform grid stores the index of
+ * the grid cell containing the bin's lower edge; the lookup grid must be fine
+ * enough that no bin contains more than one grid point, so that the correct
+ * cell is resolved by a single comparison against the next grid point.
  */
 template<class KeyQuantity, class ValueId>
 class GridIdFinder
@@ -41,18 +49,30 @@ class GridIdFinder
 
     using SpanConstGrid  = Span<const typename KeyQuantity::value_type>;
     using SpanConstValue = Span<const result_type>;
+    using SpanConstIndex = Span<const size_type>;
     //!@}
 
   public:
     // Construct from grid and values.
     inline CELER_FUNCTION GridIdFinder(SpanConstGrid, SpanConstValue);
 
+    // Construct from grid and values with a uniform log lookup table
+    inline CELER_FUNCTION GridIdFinder(SpanConstGrid,
+                                       SpanConstValue,
+                                       const UniformGridData& log_lookup,
+                                       SpanConstIndex         lookup_index);
+
     // Find the given grid point
     inline CELER_FUNCTION result_type operator()(argument_type arg) const;
 
   private:
-    SpanConstGrid  grid_;
-    SpanConstValue value_;
+    SpanConstGrid   grid_;
+    SpanConstValue  value_;
+    UniformGridData log_lookup_;
+    SpanConstIndex  lookup_index_;
+
+    // Find the grid cell using the uniform lookup table
+    inline CELER_FUNCTION size_type find_uniform(real_type value) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -5,6 +5,7 @@
 //---------------------------------------------------------------------------//
 //! \file GridIdFinder.i.hh
 //---------------------------------------------------------------------------//
+#include <cmath>
 #include "base/Algorithms.hh"
 #include "base/Assert.hh"
 
@@ -26,6 +27,29 @@ GridIdFinder<K, V>::GridIdFinder(SpanConstGrid grid, SpanConstValue value)
     CELER_EXPECT(grid_.size() == value_.size() + 1);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from grid and values with a uniform log lookup table.
+ *
+ * The lookup grid must span the log of the grid bounds, and the lookup index
+ * has one entry per lookup bin.
+ */
+template<class K, class V>
+CELER_FUNCTION
+GridIdFinder<K, V>::GridIdFinder(SpanConstGrid          grid,
+                                 SpanConstValue         value,
+                                 const UniformGridData& log_lookup,
+                                 SpanConstIndex         lookup_index)
+    : grid_(grid)
+    , value_(value)
+    , log_lookup_(log_lookup)
+    , lookup_index_(lookup_index)
+{
+    CELER_EXPECT(grid_.size() == value_.size() + 1);
+    CELER_EXPECT(log_lookup_);
+    CELER_EXPECT(lookup_index_.size() + 1 == log_lookup_.size);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Find the ID corresponding to the given value.
@@ -34,6 +58,16 @@ template<class K, class V>
 CELER_FUNCTION auto GridIdFinder<K, V>::operator()(argument_type quant) const
     -> result_type
 {
+    if (!lookup_index_.empty())
+    {
+        if (quant.value() < grid_.front() || quant.value() > grid_.back())
+        {
+            // Outside grid bounds
+            return {};
+        }
+        return value_[this->find_uniform(quant.value())];
+    }
+
     auto iter
         = celeritas::lower_bound(grid_.begin(), grid_.end(), quant.value());
     if (iter == grid_.end())
@@ -55,5 +89,34 @@ CELER_FUNCTION auto GridIdFinder<K, V>::operator()(argument_type quant) const
     return value_[iter - grid_.begin()];
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Find the grid cell for an in-bounds value using the lookup table.
+ *
+ * The stored index may be one cell too low (the lookup bin straddles a grid
+ * point, or the value is within roundoff of a bin edge), which is corrected
+ * by a single comparison.
+ */
+template<class K, class V>
+CELER_FUNCTION size_type GridIdFinder<K, V>::find_uniform(real_type value) const
+{
+    CELER_EXPECT(value >= grid_.front() && value <= grid_.back());
+
+    const size_type num_bins = log_lookup_.size - 1;
+    real_type       loc = (std::log(value) - log_lookup_.front)
+                    / log_lookup_.delta;
+    size_type bin = loc > 0 ? static_cast<size_type>(loc) : 0;
+    bin           = celeritas::min(bin, num_bins - 1);
+
+    size_type result = lookup_index_[bin];
+    if (result + 1 < value_.size() && value >= grid_[result + 1])
+    {
+        // Value is at or above the next grid point
+        ++result;
+    }
+    CELER_ENSURE(result < value_.size());
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -0,0 +1,96 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file InverseCdfBuilder.cc
+//---------------------------------------------------------------------------//
+#include "InverseCdfBuilder.hh"
+
+#include <cmath>
+#include "base/Assert.hh"
+#include "base/Range.hh"
+#include "UniformGrid.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the incident energy grid and number of CDF points.
+ */
+InverseCdfBuilder::InverseCdfBuilder(const UniformGridData& log_energy,
+                                     size_type              num_xi)
+    : log_energy_(log_energy), num_xi_(num_xi)
+{
+    CELER_EXPECT(log_energy_);
+    CELER_EXPECT(num_xi_ >= 2);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tabulate the inverse CDF as a row-major [energy][xi] array.
+ *
+ * If the density is zero everywhere at an energy, the scaled variable is
+ * sampled uniformly.
+ */
+std::vector<real_type>
+InverseCdfBuilder::operator()(const ScaledPdf& calc_pdf) const
+{
+    CELER_EXPECT(calc_pdf);
+
+    const UniformGrid loge_grid(log_energy_);
+    const size_type   num_u = (num_xi_ - 1) * this->subdivisions() + 1;
+    const UniformGrid u_grid(UniformGridData::from_bounds(0, 1, num_u));
+    const UniformGrid xi_grid(UniformGridData::from_bounds(0, 1, num_xi_));
+
+    std::vector<real_type> result(loge_grid.size() * num_xi_);
+    std::vector<real_type> cdf(num_u);
+    for (auto i : range(loge_grid.size()))
+    {
+        const real_type energy = std::exp(loge_grid[i]);
+
+        // Integrate the density with the trapezoid rule
+        real_type prev_pdf = calc_pdf(energy, u_grid[0]);
+        CELER_ASSERT(prev_pdf >= 0);
+        cdf[0] = 0;
+        for (auto k : range(size_type(1), num_u))
+        {
+            real_type cur_pdf = calc_pdf(energy, u_grid[k]);
+            CELER_ASSERT(cur_pdf >= 0);
+            cdf[k]   = cdf[k - 1] + real_type(0.5) * (prev_pdf + cur_pdf);
+            prev_pdf = cur_pdf;
+        }
+
+        real_type* row = result.data() + i * num_xi_;
+        if (cdf.back() <= 0)
+        {
+            // No probability at this energy: sample uniformly
+            for (auto j : range(num_xi_))
+            {
+                row[j] = xi_grid[j];
+            }
+            continue;
+        }
+
+        // Invert the piecewise linear CDF at each uniform probability
+        size_type k = 0;
+        row[0]      = 0;
+        for (auto j : range(size_type(1), num_xi_ - 1))
+        {
+            const real_type target = xi_grid[j] * cdf.back();
+            while (cdf[k + 1] < target)
+            {
+                ++k;
+            }
+            CELER_ASSERT(k + 1 < num_u);
+            const real_type width = cdf[k + 1] - cdf[k];
+            const real_type frac  = width > 0 ? (target - cdf[k]) / width : 0;
+            row[j] = u_grid[k] + frac * (u_grid[k + 1] - u_grid[k]);
+        }
+        row[num_xi_ - 1] = 1;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
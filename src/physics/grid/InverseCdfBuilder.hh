@@ -0,0 +1,59 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file InverseCdfBuilder.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <functional>
+#include <vector>
+#include "base/Types.hh"
+#include "UniformGridInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Tabulate the inverse CDF of an energy-dependent distribution at setup time.
+ *
+ * The given (unnormalized) probability density of a scaled variable \em u in
+ * [0, 1] is integrated at each point of the incident log-energy grid with the
+ * trapezoid rule on a fine uniform grid, and the resulting cumulative
+ * distribution is inverted at \c num_xi uniformly spaced probabilities. The
+ * result is used by \c InverseCdfSampler to replace a rejection loop with a
+ * single uniform random number.
+ *
+ * \code
+    InverseCdfBuilder build_table(
+        UniformGridData::from_bounds(std::log(1e-2), std::log(1e8), 101), 129);
+    std::vector<real_type> values = build_table(
+        [](real_type energy, real_type u) { return calc_pdf(energy, u); });
+   \endcode
+ */
+class InverseCdfBuilder
+{
+  public:
+    //!@{
+    //! Type aliases
+    using ScaledPdf = std::function<real_type(real_type energy, real_type u)>;
+    //!@}
+
+  public:
+    // Construct with the incident energy grid and number of CDF points
+    InverseCdfBuilder(const UniformGridData& log_energy, size_type num_xi);
+
+    // Tabulate the inverse CDF as a row-major [energy][xi] array
+    std::vector<real_type> operator()(const ScaledPdf& calc_pdf) const;
+
+    //! Number of integration intervals per CDF interval
+    static constexpr size_type subdivisions() { return 16; }
+
+  private:
+    UniformGridData log_energy_;
+    size_type       num_xi_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,42 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file InverseCdfInterface.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Span.hh"
+#include "base/Types.hh"
+#include "UniformGridInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Tabulated inverse cumulative distribution on a 2D grid.
+ *
+ * The \c values are stored as a row-major array indexed by [energy][xi],
+ * where the incident energy grid is uniform in log(E) and the second
+ * dimension is a uniform grid of \c num_xi points on the unit interval of
+ * the cumulative probability. Each value is the sampled quantity, scaled
+ * by the caller to lie in [0, 1].
+ */
+struct InverseCdfGridData
+{
+    UniformGridData       log_energy; //!< log(E) grid [MeV]
+    size_type             num_xi{};   //!< Number of CDF grid points
+    Span<const real_type> values;     //!< [energy][xi]
+
+    //! True if assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return log_energy && num_xi >= 2
+               && values.size() == log_energy.size * num_xi;
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,69 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file InverseCdfSampler.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Span.hh"
+#include "base/Types.hh"
+#include "physics/base/Units.hh"
+#include "InverseCdfInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a scaled variable from a tabulated inverse CDF.
+ *
+ * The table built by \c InverseCdfBuilder is linearly interpolated in the
+ * uniform random number and then in log-energy between the two bracketing
+ * rows. Exactly one random number is used per sample. Energies outside the
+ * tabulated range are clamped to the grid bounds; use \c in_range to check
+ * beforehand if that matters.
+ *
+ * \code
+    InverseCdfSampler sample_u(shared.epsilon_table, particle.energy());
+    real_type u = sample_u(rng);
+   \endcode
+ */
+class InverseCdfSampler
+{
+  public:
+    //!@{
+    //! Type aliases
+    using Energy      = units::MevEnergy;
+    using result_type = real_type;
+    //!@}
+
+  public:
+    // Whether the energy is inside the tabulated range
+    static inline CELER_FUNCTION bool
+    in_range(const InverseCdfGridData& data, Energy energy);
+
+    // Construct with tabulated data and incident energy
+    inline CELER_FUNCTION
+    InverseCdfSampler(const InverseCdfGridData& data, Energy energy);
+
+    // Sample the scaled variable in [0, 1]
+    template<class Engine>
+    inline CELER_FUNCTION result_type operator()(Engine& rng) const;
+
+  private:
+    Span<const real_type> lower_;
+    Span<const real_type> upper_;
+    real_type             frac_;
+
+    // Interpolate the inverse CDF in one row
+    static inline CELER_FUNCTION real_type interp(Span<const real_type> row,
+                                                  size_type             bin,
+                                                  real_type             frac);
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "InverseCdfSampler.i.hh"
@@ -0,0 +1,92 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file InverseCdfSampler.i.hh
+//---------------------------------------------------------------------------//
+#include <cmath>
+#include "base/Assert.hh"
+#include "random/distributions/GenerateCanonical.hh"
+#include "UniformGrid.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Whether the energy is inside the tabulated range.
+ */
+CELER_FUNCTION bool
+InverseCdfSampler::in_range(const InverseCdfGridData& data, Energy energy)
+{
+    const real_type loge = std::log(energy.value());
+    return data && loge >= data.log_energy.front
+           && loge <= data.log_energy.back;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with tabulated data and incident energy.
+ */
+CELER_FUNCTION
+InverseCdfSampler::InverseCdfSampler(const InverseCdfGridData& data,
+                                     Energy                    energy)
+    : frac_(0)
+{
+    CELER_EXPECT(data);
+
+    const UniformGrid loge_grid(data.log_energy);
+    const real_type   loge = std::log(energy.value());
+    size_type         bin  = 0;
+    if (loge >= loge_grid.back())
+    {
+        bin   = loge_grid.size() - 2;
+        frac_ = 1;
+    }
+    else if (loge > loge_grid.front())
+    {
+        bin   = loge_grid.find(loge);
+        frac_ = (loge - loge_grid[bin]) / data.log_energy.delta;
+    }
+
+    lower_ = data.values.subspan(bin * data.num_xi, data.num_xi);
+    upper_ = data.values.subspan((bin + 1) * data.num_xi, data.num_xi);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the scaled variable in [0, 1].
+ */
+template<class Engine>
+CELER_FUNCTION auto InverseCdfSampler::operator()(Engine& rng) const
+    -> result_type
+{
+    // Locate the sampled probability on the uniform CDF grid
+    const real_type xi  = generate_canonical(rng) * (lower_.size() - 1);
+    size_type       bin = static_cast<size_type>(xi);
+    if (bin >= lower_.size() - 1)
+    {
+        bin = lower_.size() - 2;
+    }
+    const real_type xi_frac = xi - bin;
+
+    // Interpolate in probability, then in log energy
+    const real_type lower = this->interp(lower_, bin, xi_frac);
+    const real_type upper = this->interp(upper_, bin, xi_frac);
+    return lower + frac_ * (upper - lower);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Interpolate the inverse CDF in one row.
+ */
+CELER_FUNCTION real_type InverseCdfSampler::interp(Span<const real_type> row,
+                                                   size_type             bin,
+                                                   real_type             frac)
+{
+    CELER_EXPECT(bin + 1 < row.size());
+    return row[bin] + frac * (row[bin + 1] - row[bin]);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
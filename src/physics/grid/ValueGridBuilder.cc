@@ -9,6 +9,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <utility>
+#include "base/Range.hh"
 #include "base/SoftEqual.hh"
 #include "physics/grid/UniformGrid.hh"
 #include "physics/grid/XsGridInterface.hh"
@@ -50,8 +52,8 @@ bool is_on_grid_point(real_type value, real_type lo, real_type hi, size_type siz
     if (value < lo || value > hi)
         return false;
 
-    real_type delta = (hi - lo) / size;
-    return soft_zero(std::fmod(value - lo, delta));
+    real_type index = (value - lo) * size / (hi - lo);
+    return soft_equal(std::round(index), index);
 }
 
 bool is_monotonic_increasing(SpanConstReal grid)
@@ -68,6 +70,81 @@ bool is_monotonic_increasing(SpanConstReal grid)
     return true;
 }
 
+real_type calc_relative_error(real_type interp, real_type exact)
+{
+    real_type abs_error = std::fabs(interp - exact);
+    if (abs_error == 0)
+        return 0;
+    return exact != 0 ? abs_error / std::fabs(exact) : real_type(1);
+}
+
+size_type calc_gcd(size_type a, size_type b)
+{
+    while (b != 0)
+    {
+        size_type r = a % b;
+        a           = b;
+        b           = r;
+    }
+    return a;
+}
+
+//! Max error of interpolating every stride'th point of a uniform log grid
+real_type calc_thinned_error(real_type     log_emin,
+                             real_type     delta,
+                             SpanConstReal value,
+                             size_type     stride)
+{
+    real_type error = 0;
+    for (size_type lo = 0; lo + stride < value.size(); lo += stride)
+    {
+        const size_type hi      = lo + stride;
+        const real_type lower_e = std::exp(log_emin + lo * delta);
+        const real_type upper_e = std::exp(log_emin + hi * delta);
+        for (size_type i = lo + 1; i < hi; ++i)
+        {
+            real_type e      = std::exp(log_emin + i * delta);
+            real_type interp = value[lo]
+                               + (e - lower_e) / (upper_e - lower_e)
+                                     * (value[hi] - value[lo]);
+            error = std::max(error, calc_relative_error(interp, value[i]));
+        }
+    }
+    return error;
+}
+
+//! Coarsest stride (dividing max_stride) within the error tolerance
+std::pair<size_type, real_type> find_thinned_stride(real_type     log_emin,
+                                                    real_type     log_emax,
+                                                    SpanConstReal value,
+                                                    size_type     max_stride,
+                                                    real_type     tolerance)
+{
+    const real_type delta = (log_emax - log_emin) / (value.size() - 1);
+    for (size_type stride = max_stride; stride > 1; --stride)
+    {
+        if (max_stride % stride != 0)
+            continue;
+
+        real_type error = calc_thinned_error(log_emin, delta, value, stride);
+        if (error <= tolerance)
+        {
+            return {stride, error};
+        }
+    }
+    return {1, 0};
+}
+
+std::vector<real_type> strided_copy(SpanConstReal value, size_type stride)
+{
+    std::vector<real_type> result((value.size() - 1) / stride + 1);
+    for (auto i : range(result.size()))
+    {
+        result[i] = value[i * stride];
+    }
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace
 
@@ -77,6 +154,17 @@ bool is_monotonic_increasing(SpanConstReal grid)
 //! Default destructor
 ValueGridBuilder::~ValueGridBuilder() = default;
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct a coarser grid with the given relative error tolerance.
+ *
+ * By default, grids are not thinned.
+ */
+auto ValueGridBuilder::thin(real_type) const -> Thinned
+{
+    return {nullptr, 0, 0, 0};
+}
+
 //---------------------------------------------------------------------------//
 // XS BUILDER
 //---------------------------------------------------------------------------//
@@ -153,8 +241,132 @@ auto ValueGridXsBuilder::build(ValueGridInserter insert) const -> ValueGridId
         make_span(xs_));
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct a coarser grid with the given relative error tolerance.
+ *
+ * The stride must divide both the number of bins and the index of the prime
+ * energy, so that the prime energy remains a grid point. Above it, the
+ * relative error of the scaled cross section is the same as for the cross
+ * section itself.
+ */
+auto ValueGridXsBuilder::thin(real_type tolerance) const -> Thinned
+{
+    CELER_EXPECT(tolerance > 0);
+
+    const size_type num_bins    = xs_.size() - 1;
+    const size_type prime_index = static_cast<size_type>(std::round(
+        (log_eprime_ - log_emin_) * num_bins / (log_emax_ - log_emin_)));
+    auto            stride      = find_thinned_stride(log_emin_,
+                                          log_emax_,
+                                          make_span(xs_),
+                                          calc_gcd(num_bins, prime_index),
+                                          tolerance);
+
+    Thinned result{nullptr, xs_.size(), xs_.size(), stride.second};
+    if (stride.first > 1)
+    {
+        VecReal xs         = strided_copy(make_span(xs_), stride.first);
+        result.output_size = xs.size();
+        result.builder     = std::make_unique<ValueGridXsBuilder>(
+            std::exp(log_emin_),
+            std::exp(log_eprime_),
+            std::exp(log_emax_),
+            std::move(xs));
+    }
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 // LOG BUILDER
+//---------------------------------------------------------------------------//
+/*!
+ * Construct by tabulating a function of energy to the given tolerance.
+ *
+ * The grid starts with one bin per decade. At each refinement the function is
+ * evaluated at the log-space midpoint of every bin and compared to the value
+ * linearly interpolated in energy (as done by \c XsCalculator). If the
+ * maximum relative error exceeds the tolerance, the midpoints are inserted as
+ * new grid points. Refinement stops when doubling the number of bins would
+ * exceed \c max_size: the maximum midpoint error of the final grid is
+ * returned in \c max_error if it is provided, and the caller should check it
+ * for functions with discontinuities (e.g. absorption edges).
+ */
+auto ValueGridLogBuilder::from_function(real_type        emin,
+                                        real_type        emax,
+                                        const CalcValue& calc_value,
+                                        real_type        tolerance,
+                                        size_type        max_size,
+                                        real_type*       max_error)
+    -> UPLogBuilder
+{
+    CELER_EXPECT(emin > 0 && emax > emin);
+    CELER_EXPECT(calc_value);
+    CELER_EXPECT(tolerance > 0);
+    CELER_EXPECT(max_size >= 2);
+
+    const real_type log_emin = std::log(emin);
+    const real_type log_emax = std::log(emax);
+
+    // Start with approximately one bin per decade
+    size_type num_bins = static_cast<size_type>(
+        std::ceil((log_emax - log_emin) / std::log(real_type(10))));
+    num_bins = std::min(std::max<size_type>(num_bins, 1), max_size - 1);
+
+    VecReal value(num_bins + 1);
+    for (auto i : range(value.size()))
+    {
+        value[i] = calc_value(
+            std::exp(log_emin + i * (log_emax - log_emin) / num_bins));
+    }
+
+    VecReal   midpoint;
+    real_type error = 0;
+    while (true)
+    {
+        // Evaluate the function and interpolation error at bin midpoints
+        const real_type delta = (log_emax - log_emin) / num_bins;
+        midpoint.resize(num_bins);
+        error = 0;
+        for (auto i : range(num_bins))
+        {
+            real_type log_lower = log_emin + i * delta;
+            real_type lower_e   = std::exp(log_lower);
+            real_type upper_e   = std::exp(log_lower + delta);
+            real_type mid_e     = std::exp(log_lower + delta / 2);
+            real_type exact     = calc_value(mid_e);
+            real_type interp    = value[i]
+                               + (mid_e - lower_e) / (upper_e - lower_e)
+                                     * (value[i + 1] - value[i]);
+            midpoint[i] = exact;
+
+            error = std::max(error, calc_relative_error(interp, exact));
+        }
+
+        if (error <= tolerance || 2 * num_bins + 1 > max_size)
+        {
+            break;
+        }
+
+        // Interleave the midpoints to halve the grid spacing
+        VecReal refined(2 * num_bins + 1);
+        for (auto i : range(num_bins))
+        {
+            refined[2 * i]     = value[i];
+            refined[2 * i + 1] = midpoint[i];
+        }
+        refined.back() = value.back();
+        value          = std::move(refined);
+        num_bins *= 2;
+    }
+
+    if (max_error)
+    {
+        *max_error = error;
+    }
+    return std::make_unique<ValueGridLogBuilder>(emin, emax, std::move(value));
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct from raw data.
@@ -182,6 +394,28 @@ auto ValueGridLogBuilder::build(ValueGridInserter insert) const -> ValueGridId
         this->value());
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct a coarser grid with the given relative error tolerance.
+ */
+auto ValueGridLogBuilder::thin(real_type tolerance) const -> Thinned
+{
+    CELER_EXPECT(tolerance > 0);
+
+    auto stride = find_thinned_stride(
+        log_emin_, log_emax_, this->value(), value_.size() - 1, tolerance);
+
+    Thinned result{nullptr, value_.size(), value_.size(), stride.second};
+    if (stride.first > 1)
+    {
+        VecReal value      = strided_copy(this->value(), stride.first);
+        result.output_size = value.size();
+        result.builder     = std::make_unique<ValueGridLogBuilder>(
+            std::exp(log_emin_), std::exp(log_emax_), std::move(value));
+    }
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 // RANGE BUILDER
 //---------------------------------------------------------------------------//
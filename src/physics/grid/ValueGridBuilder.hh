@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <vector>
 #include "base/Collection.hh"
@@ -22,21 +23,40 @@ class ValueGridInserter;
  *
  * These builder classes are presumed to have a short/temporary lifespan and
  * should not be retained after the setup phase.
+ *
+ * Imported tables are often much denser than linear interpolation requires.
+ * The \c thin method finds the coarsest uniform log grid whose points are a
+ * subset of the original grid and whose linear interpolation reproduces every
+ * removed point to within the given relative tolerance. Builders that don't
+ * support thinning return a null builder.
  */
 class ValueGridBuilder
 {
   public:
     //!@{
     //! Type aliases
-    using ValueGridId = ItemId<struct XsGridData>;
+    using ValueGridId        = ItemId<struct XsGridData>;
+    using UPConstGridBuilder = std::unique_ptr<const ValueGridBuilder>;
     //!@}
 
+    //! Result of removing grid points
+    struct Thinned
+    {
+        UPConstGridBuilder builder;     //!< Coarser grid, null if unchanged
+        size_type          input_size;  //!< Number of original grid points
+        size_type          output_size; //!< Number of remaining grid points
+        real_type          max_error;   //!< Max relative error at old points
+    };
+
   public:
     //! Virtual destructor for polymorphic deletion
     virtual ~ValueGridBuilder() = 0;
 
     //! Construct the grid given a mutable reference to a store
     virtual ValueGridId build(ValueGridInserter) const = 0;
+
+    // Construct a coarser grid with the given relative error tolerance
+    virtual Thinned thin(real_type tolerance) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -72,6 +92,9 @@ class ValueGridXsBuilder final : public ValueGridBuilder
     // Construct in the given store
     ValueGridId build(ValueGridInserter) const final;
 
+    // Construct a coarser grid with the given relative error tolerance
+    Thinned thin(real_type tolerance) const final;
+
   private:
     real_type log_emin_;
     real_type log_eprime_;
@@ -84,6 +107,15 @@ class ValueGridXsBuilder final : public ValueGridBuilder
  * Build a physics vector for energy loss and other quantities.
  *
  * This vector is still uniform in log(E).
+ *
+ * The \c from_function factory tabulates an analytic function (e.g. an
+ * on-the-fly cross section calculation), repeatedly halving the log-energy
+ * spacing until the relative error of linear interpolation at every bin
+ * midpoint is within the given tolerance or the grid reaches the maximum
+ * size.
+ *
+ * Thinning a range table keeps a subset of its points, so the result is still
+ * monotonic.
  */
 class ValueGridLogBuilder : public ValueGridBuilder
 {
@@ -93,15 +125,28 @@ class ValueGridLogBuilder : public ValueGridBuilder
     using VecReal       = std::vector<real_type>;
     using SpanConstReal = Span<const real_type>;
     using Id            = ItemId<XsGridData>;
+    using CalcValue     = std::function<real_type(real_type)>;
+    using UPLogBuilder  = std::unique_ptr<ValueGridLogBuilder>;
     //!@}
 
   public:
+    // Construct by tabulating a function of energy to the given tolerance
+    static UPLogBuilder from_function(real_type        emin,
+                                      real_type        emax,
+                                      const CalcValue& calc_value,
+                                      real_type        tolerance,
+                                      size_type        max_size,
+                                      real_type*       max_error = nullptr);
+
     // Construct
     ValueGridLogBuilder(real_type emin, real_type emax, VecReal value);
 
     // Construct in the given store
     ValueGridId build(ValueGridInserter) const final;
 
+    // Construct a coarser grid with the given relative error tolerance
+    Thinned thin(real_type tolerance) const final;
+
     //! Access Values
     SpanConstReal value() const { return make_span(value_); }
 
@@ -7,21 +7,99 @@
 //---------------------------------------------------------------------------//
 #include "ValueGridInserter.hh"
 
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+#include "base/Range.hh"
 #include "base/SpanRemapper.hh"
 #include "base/VectorUtils.hh"
 #include "comm/Device.hh"
 
 namespace celeritas
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Combine a value into a running hash
+template<class T>
+void hash_combine(std::size_t* seed, const T& value)
+{
+    *seed ^= std::hash<T>{}(value) + 0x9e3779b9 + (*seed << 6) + (*seed >> 2);
+}
+
+//---------------------------------------------------------------------------//
+//! Hash the contents of a value array
+std::size_t hash_values(Span<const real_type> values)
+{
+    std::size_t result = values.size();
+    for (real_type v : values)
+    {
+        hash_combine(&result, v);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+//! Hash a grid whose values have already been deduplicated
+std::size_t hash_grid(const XsGridData& grid)
+{
+    std::size_t result = grid.log_energy.size;
+    hash_combine(&result, grid.log_energy.front);
+    hash_combine(&result, grid.log_energy.delta);
+    hash_combine(&result, grid.prime_index);
+    hash_combine(&result, (*grid.value.begin()).unchecked_get());
+    hash_combine(&result, grid.value.size());
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+//! Whether two grids are identical
+bool is_same_grid(const XsGridData& a, const XsGridData& b)
+{
+    return a.log_energy.size == b.log_energy.size
+           && a.log_energy.front == b.log_energy.front
+           && a.log_energy.back == b.log_energy.back
+           && a.log_energy.delta == b.log_energy.delta
+           && a.prime_index == b.prime_index
+           && *a.value.begin() == *b.value.begin()
+           && a.value.size() == b.value.size();
+}
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Content hashes of previously inserted value arrays and grids.
+ */
+struct ValueGridInserter::DedupIndex
+{
+    std::unordered_multimap<std::size_t, ItemRange<real_type>> values;
+    std::unordered_multimap<std::size_t, XsIndex>              grids;
+    std::size_t                                                bytes_saved{0};
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct with a reference to mutable host data.
+ *
+ * Existing grids are indexed so that they can be reused.
  */
 ValueGridInserter::ValueGridInserter(RealCollection*   real_data,
                                      XsGridCollection* xs_grid)
-    : values_(real_data), xs_grids_(xs_grid)
+    : reals_(real_data)
+    , grids_(xs_grid)
+    , values_(real_data)
+    , xs_grids_(xs_grid)
+    , index_(std::make_shared<DedupIndex>())
 {
     CELER_EXPECT(real_data && xs_grid);
+
+    for (auto grid_id : range(XsIndex{grids_->size()}))
+    {
+        const XsGridData& grid = (*grids_)[grid_id];
+        index_->values.insert(
+            {hash_values((*reals_)[grid.value]), grid.value});
+        index_->grids.insert({hash_grid(grid), grid_id});
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -40,8 +118,8 @@ auto ValueGridInserter::operator()(const UniformGridData& log_grid,
     XsGridData grid;
     grid.log_energy  = log_grid;
     grid.prime_index = prime_index;
-    grid.value       = values_.insert_back(values.begin(), values.end());
-    return xs_grids_.push_back(grid);
+    grid.value       = this->insert_values(values);
+    return this->insert_grid(grid);
 }
 
 //---------------------------------------------------------------------------//
@@ -64,5 +142,62 @@ auto ValueGridInserter::operator()(InterpolatedGrid, InterpolatedGrid)
     CELER_NOT_IMPLEMENTED("generic grids");
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Number of bytes of storage avoided by reusing identical data.
+ */
+std::size_t ValueGridInserter::bytes_saved() const
+{
+    return index_->bytes_saved;
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Insert values, or return the range of an identical existing array.
+ */
+ItemRange<real_type> ValueGridInserter::insert_values(SpanConstReal values)
+{
+    const std::size_t hash = hash_values(values);
+    auto              iters = index_->values.equal_range(hash);
+    for (auto iter = iters.first; iter != iters.second; ++iter)
+    {
+        SpanConstReal existing = (*reals_)[iter->second];
+        if (std::equal(
+                values.begin(), values.end(), existing.begin(), existing.end()))
+        {
+            index_->bytes_saved += values.size() * sizeof(real_type);
+            return iter->second;
+        }
+    }
+
+    auto result = values_.insert_back(values.begin(), values.end());
+    index_->values.insert({hash, result});
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Insert a grid, or return the ID of an identical existing grid.
+ */
+auto ValueGridInserter::insert_grid(const XsGridData& grid) -> XsIndex
+{
+    const std::size_t hash  = hash_grid(grid);
+    auto              iters = index_->grids.equal_range(hash);
+    for (auto iter = iters.first; iter != iters.second; ++iter)
+    {
+        if (is_same_grid((*grids_)[iter->second], grid))
+        {
+            index_->bytes_saved += sizeof(XsGridData);
+            return iter->second;
+        }
+    }
+
+    auto result = xs_grids_.push_back(grid);
+    index_->grids.insert({hash, result});
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
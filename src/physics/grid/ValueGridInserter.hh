@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <cstddef>
+#include <memory>
 #include <vector>
 #include "base/Collection.hh"
 #include "base/CollectionBuilder.hh"
@@ -25,6 +27,13 @@ namespace celeritas
  * ValueGridXsBuilder::build method taking an instance of this class) it can be
  * extended to build additional grid types as well.
  *
+ * Identical value arrays (compared by content after hashing) are stored only
+ * once in the real data, and identical grids (same energy grid, scaling, and
+ * values) share a single grid ID, since many materials and processes have
+ * the same tables. Grids already present in the collections when the inserter
+ * is constructed are also reused. Copies of an inserter share the same
+ * deduplication index, and \c bytes_saved reports the total storage avoided.
+ *
  * \code
     ValueGridInserter insert(&data.host.values, &data.host.grids);
     insert(uniform_grid, values);
@@ -62,9 +71,20 @@ class ValueGridInserter
     // Add a grid of generic data
     GenericIndex operator()(InterpolatedGrid grid, InterpolatedGrid values);
 
+    // Number of bytes of storage avoided by reusing identical data
+    std::size_t bytes_saved() const;
+
   private:
+    struct DedupIndex;
+
+    const RealCollection*                         reals_;
+    const XsGridCollection*                       grids_;
     CollectionBuilder<real_type, MemSpace::host>  values_;
     CollectionBuilder<XsGridData, MemSpace::host> xs_grids_;
+    std::shared_ptr<DedupIndex>                   index_;
+
+    ItemRange<real_type> insert_values(SpanConstReal values);
+    XsIndex              insert_grid(const XsGridData& grid);
 };
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,104 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ElementCdfBuilder.cc
+//---------------------------------------------------------------------------//
+#include "ElementCdfBuilder.hh"
+
+#include <cmath>
+#include <utility>
+#include <vector>
+#include "base/Assert.hh"
+#include "base/CollectionBuilder.hh"
+#include "base/Range.hh"
+#include "physics/grid/UniformGrid.hh"
+#include "MaterialParams.hh"
+#include "MaterialView.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with materials and microscopic cross section calculator.
+ */
+ElementCdfBuilder::ElementCdfBuilder(const MaterialParams& materials,
+                                     MicroXsCalc           calc_xs)
+    : materials_(materials), calc_xs_(std::move(calc_xs))
+{
+    CELER_EXPECT(calc_xs_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tabulate CDFs for all materials on the given log-energy grid.
+ */
+void ElementCdfBuilder::operator()(const UniformGridData& log_energy,
+                                   HostValue*             data) const
+{
+    CELER_EXPECT(log_energy);
+    CELER_EXPECT(data);
+
+    auto reals = make_builder(&data->reals);
+    auto grids = make_builder(&data->materials);
+    grids.reserve(materials_.size());
+
+    const UniformGrid      loge_grid(log_energy);
+    std::vector<real_type> temp_cdf;
+    std::vector<real_type> row;
+    for (auto mat_id : range(MaterialId{materials_.size()}))
+    {
+        MaterialView material(materials_.host_pointers(), mat_id);
+        auto         elements = material.elements();
+
+        ElementCdfGrid grid;
+        grid.num_elements = elements.size();
+        if (elements.size() > 1)
+        {
+            const size_type num_cols = elements.size() - 1;
+            temp_cdf.resize(loge_grid.size() * num_cols);
+            for (auto i : range(loge_grid.size()))
+            {
+                const Energy energy{std::exp(loge_grid[i])};
+
+                // Calculate cumulative weighted cross sections
+                real_type accum = 0;
+                row.resize(elements.size());
+                for (auto j : range(elements.size()))
+                {
+                    real_type micro_xs = calc_xs_(elements[j].element, energy);
+                    CELER_ASSERT(micro_xs >= 0);
+                    accum += micro_xs * elements[j].fraction;
+                    row[j] = accum;
+                }
+                if (accum == 0)
+                {
+                    // No interaction at this energy: weight by fraction only
+                    for (auto j : range(elements.size()))
+                    {
+                        accum += elements[j].fraction;
+                        row[j] = accum;
+                    }
+                }
+                CELER_ASSERT(accum > 0);
+
+                // Normalize, omitting the final (unity) value
+                real_type inv_total = 1 / accum;
+                for (auto j : range(num_cols))
+                {
+                    temp_cdf[i * num_cols + j] = row[j] * inv_total;
+                }
+            }
+            grid.log_energy = log_energy;
+            grid.cdf = reals.insert_back(temp_cdf.begin(), temp_cdf.end());
+        }
+        CELER_ASSERT(grid || elements.empty());
+        grids.push_back(grid);
+    }
+
+    CELER_ENSURE(data->materials.size() == materials_.size());
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
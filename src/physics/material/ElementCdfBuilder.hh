@@ -0,0 +1,61 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ElementCdfBuilder.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <functional>
+#include "physics/base/Units.hh"
+#include "ElementCdfInterface.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+class MaterialParams;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tabulate element selection CDFs for every material at setup time.
+ *
+ * The given microscopic cross section function is evaluated for each element
+ * of each material at every point of a uniform log-energy grid, and the
+ * normalized cumulative (fraction-weighted) cross sections are stored. If the
+ * cross section is zero for every element at an energy point, the element is
+ * selected based on its number fraction alone.
+ *
+ * \code
+    ElementCdfBuilder build_cdf(*materials, [&](ElementId el, Energy e) {
+        return calc_micro_xs(el, e);
+    });
+    ElementCdfData<Ownership::value, MemSpace::host> host_data;
+    build_cdf(UniformGridData::from_bounds(std::log(1e-3), std::log(1e2), 64),
+              &host_data);
+   \endcode
+ */
+class ElementCdfBuilder
+{
+  public:
+    //!@{
+    //! Type aliases
+    using Energy      = units::MevEnergy;
+    using MicroXsCalc = std::function<real_type(ElementId, Energy)>;
+    using HostValue   = ElementCdfData<Ownership::value, MemSpace::host>;
+    //!@}
+
+  public:
+    // Construct with materials and microscopic cross section calculator
+    ElementCdfBuilder(const MaterialParams& materials, MicroXsCalc calc_xs);
+
+    // Tabulate CDFs for all materials on the given log-energy grid
+    void operator()(const UniformGridData& log_energy, HostValue* data) const;
+
+  private:
+    const MaterialParams& materials_;
+    MicroXsCalc           calc_xs_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
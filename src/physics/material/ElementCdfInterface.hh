@@ -0,0 +1,81 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ElementCdfInterface.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Collection.hh"
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "physics/grid/UniformGridInterface.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+// PARAMS
+//---------------------------------------------------------------------------//
+/*!
+ * Tabulated element selection probabilities for a single material.
+ *
+ * The \c cdf values are stored as a 2D row-major array indexed by
+ * [energy][element component], where each row is the normalized cumulative
+ * sum of (fraction * microscopic cross section) over the material's elements.
+ * The final element's cumulative value is always unity and is not stored, so
+ * each row has \c num_elements - 1 entries. Single-element materials have no
+ * stored values.
+ */
+struct ElementCdfGrid
+{
+    UniformGridData               log_energy;     //!< log(E) grid [MeV]
+    ItemRange<real_type>          cdf;            //!< [energy][component]
+    ElementComponentId::size_type num_elements{}; //!< Number of components
+
+    //! True if assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return num_elements == 1
+               || (log_energy
+                   && cdf.size() == log_energy.size * (num_elements - 1));
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Element selection tables for all materials for a single model.
+ */
+template<Ownership W, MemSpace M>
+struct ElementCdfData
+{
+    template<class T>
+    using Items = Collection<T, W, M>;
+    template<class T>
+    using MaterialItems = Collection<T, W, M, MaterialId>;
+
+    Items<real_type>              reals;
+    MaterialItems<ElementCdfGrid> materials;
+
+    //// MEMBER FUNCTIONS ////
+
+    //! True if assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !materials.empty();
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    ElementCdfData& operator=(const ElementCdfData<W2, M2>& other)
+    {
+        CELER_EXPECT(other);
+        reals     = other.reals;
+        materials = other.materials;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,67 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TabulatedElementSelector.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Span.hh"
+#include "base/Types.hh"
+#include "physics/base/Units.hh"
+#include "ElementCdfInterface.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Select an element using precalculated cumulative probabilities.
+ *
+ * This is a drop-in replacement for \c ElementSelector that requires neither
+ * on-the-fly microscopic cross section calculations nor element scratch space.
+ * The CDF tables built by \c ElementCdfBuilder are linearly interpolated in
+ * log-energy, and the element is sampled with a single uniform random number.
+ * Energies outside the tabulated range are clamped to the grid bounds.
+ *
+ * \code
+    TabulatedElementSelector select_el(
+        model.element_cdf, material.material_id(), particle.energy());
+    ElementComponentId comp_id = select_el(rng);
+   \endcode
+ */
+class TabulatedElementSelector
+{
+  public:
+    //!@{
+    //! Type aliases
+    using ElementCdfPointers
+        = ElementCdfData<Ownership::const_reference, MemSpace::native>;
+    using Energy = units::MevEnergy;
+    //!@}
+
+  public:
+    // Construct with tabulated data, material, and incident energy
+    inline CELER_FUNCTION TabulatedElementSelector(const ElementCdfPointers&,
+                                                   MaterialId material,
+                                                   Energy     energy);
+
+    // Sample with the given RNG
+    template<class Engine>
+    inline CELER_FUNCTION ElementComponentId operator()(Engine& rng) const;
+
+  private:
+    Span<const real_type> lower_;
+    Span<const real_type> upper_;
+    real_type             frac_;
+
+    // Interpolated CDF value for the given component
+    inline CELER_FUNCTION real_type cdf(size_type i) const;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "TabulatedElementSelector.i.hh"
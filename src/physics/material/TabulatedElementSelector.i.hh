@@ -0,0 +1,93 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TabulatedElementSelector.i.hh
+//---------------------------------------------------------------------------//
+#include <cmath>
+#include "base/Assert.hh"
+#include "physics/grid/UniformGrid.hh"
+#include "random/distributions/GenerateCanonical.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with tabulated data, material, and incident energy.
+ */
+CELER_FUNCTION
+TabulatedElementSelector::TabulatedElementSelector(
+    const ElementCdfPointers& data, MaterialId material, Energy energy)
+    : frac_(0)
+{
+    CELER_EXPECT(material < data.materials.size());
+    const ElementCdfGrid& grid = data.materials[material];
+    CELER_EXPECT(grid.num_elements > 0);
+    if (grid.num_elements == 1)
+    {
+        // Only one element to choose from
+        return;
+    }
+
+    const UniformGrid loge_grid(grid.log_energy);
+    const real_type   loge = std::log(energy.value());
+    size_type         bin  = 0;
+    if (loge >= loge_grid.back())
+    {
+        bin   = loge_grid.size() - 2;
+        frac_ = 1;
+    }
+    else if (loge > loge_grid.front())
+    {
+        bin   = loge_grid.find(loge);
+        frac_ = (loge - loge_grid[bin]) / grid.log_energy.delta;
+    }
+
+    const size_type       num_cols = grid.num_elements - 1;
+    Span<const real_type> cdf      = data.reals[grid.cdf];
+    lower_                         = cdf.subspan(bin * num_cols, num_cols);
+    upper_ = cdf.subspan((bin + 1) * num_cols, num_cols);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the element with the given RNG.
+ *
+ * The interpolated CDF is monotonic, so a binary search finds the first
+ * element whose cumulative probability exceeds the sampled value.
+ */
+template<class Engine>
+CELER_FUNCTION ElementComponentId
+TabulatedElementSelector::operator()(Engine& rng) const
+{
+    const real_type xi   = generate_canonical(rng);
+    size_type       low  = 0;
+    size_type       high = lower_.size();
+    while (low < high)
+    {
+        size_type mid = (low + high) / 2;
+        if (this->cdf(mid) <= xi)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return ElementComponentId{low};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Interpolated CDF value for the given component.
+ */
+CELER_FUNCTION real_type TabulatedElementSelector::cdf(size_type i) const
+{
+    CELER_EXPECT(i < lower_.size());
+    return lower_[i] + frac_ * (upper_[i] - lower_[i]);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,55 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AliasSampler.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Span.hh"
+#include "base/Types.hh"
+#include "AliasTableInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Sample an index from a discrete distribution in constant time.
+ *
+ * The table is constructed by \c AliasTableBuilder. A single uniform random
+ * number selects both the bin (integer part) and whether to accept it or its
+ * alias (fractional part), so the cost of sampling is independent of the
+ * number of outcomes.
+ *
+ * \code
+    AliasSampler sample_index(shell.transition_alias);
+    size_type i = sample_index(rng);
+   \endcode
+ */
+class AliasSampler
+{
+  public:
+    //!@{
+    //! Type aliases
+    using result_type    = size_type;
+    using SpanConstEntry = Span<const AliasEntry>;
+    //!@}
+
+  public:
+    // Construct with the alias table
+    explicit inline CELER_FUNCTION AliasSampler(SpanConstEntry table);
+
+    // Sample a random index
+    template<class Generator>
+    inline CELER_FUNCTION result_type operator()(Generator& rng);
+
+  private:
+    SpanConstEntry table_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "AliasSampler.i.hh"
@@ -0,0 +1,43 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AliasSampler.i.hh
+//---------------------------------------------------------------------------//
+#include "base/Assert.hh"
+#include "GenerateCanonical.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the alias table.
+ */
+CELER_FUNCTION AliasSampler::AliasSampler(SpanConstEntry table)
+    : table_(table)
+{
+    CELER_EXPECT(!table_.empty());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a random index.
+ */
+template<class Generator>
+CELER_FUNCTION auto AliasSampler::operator()(Generator& rng) -> result_type
+{
+    const real_type u   = generate_canonical<real_type>(rng) * table_.size();
+    size_type       bin = static_cast<size_type>(u);
+    if (bin >= table_.size())
+    {
+        // Guard against roundoff when the canonical sample is close to 1
+        bin = table_.size() - 1;
+    }
+
+    const AliasEntry& entry = table_[bin];
+    return (u - bin < entry.probability) ? bin : entry.alias;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
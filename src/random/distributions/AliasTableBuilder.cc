@@ -0,0 +1,96 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AliasTableBuilder.cc
+//---------------------------------------------------------------------------//
+#include "AliasTableBuilder.hh"
+
+#include <vector>
+#include "base/Assert.hh"
+#include "base/CollectionBuilder.hh"
+#include "base/Range.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Fill an alias table from unnormalized weights.
+ *
+ * Bins whose scaled weight is less than unity ("small") are paired with a bin
+ * whose scaled weight is at least unity ("large"), which donates the
+ * remainder of the small bin's probability. Bins left over at the end (due
+ * only to roundoff) are accepted unconditionally.
+ */
+void AliasTableBuilder::build(SpanConstReal weights, Span<AliasEntry> table)
+{
+    CELER_EXPECT(!weights.empty());
+    CELER_EXPECT(weights.size() == table.size());
+
+    const size_type size  = weights.size();
+    real_type       total = 0;
+    for (real_type w : weights)
+    {
+        CELER_VALIDATE(w >= 0, "Alias table weights must be nonnegative");
+        total += w;
+    }
+    CELER_VALIDATE(total > 0, "Alias table weights must not all be zero");
+
+    // Scale the weights so that their mean is unity
+    const real_type        norm = size / total;
+    std::vector<size_type> small;
+    std::vector<size_type> large;
+    for (auto i : range(size))
+    {
+        table[i].probability = weights[i] * norm;
+        table[i].alias       = i;
+        (table[i].probability < 1 ? small : large).push_back(i);
+    }
+
+    // Pair small bins with large bins
+    while (!small.empty() && !large.empty())
+    {
+        size_type s = small.back();
+        size_type l = large.back();
+        small.pop_back();
+        large.pop_back();
+
+        table[s].alias = l;
+        table[l].probability -= 1 - table[s].probability;
+        (table[l].probability < 1 ? small : large).push_back(l);
+    }
+
+    // Remaining bins have a scaled weight of unity up to roundoff
+    for (size_type i : large)
+    {
+        table[i].probability = 1;
+    }
+    for (size_type i : small)
+    {
+        table[i].probability = 1;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with a reference to the host storage.
+ */
+AliasTableBuilder::AliasTableBuilder(AliasItems* entries) : entries_(entries)
+{
+    CELER_EXPECT(entries_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Append an alias table built from unnormalized weights.
+ */
+ItemRange<AliasEntry> AliasTableBuilder::operator()(SpanConstReal weights)
+{
+    temp_.resize(weights.size());
+    AliasTableBuilder::build(weights, make_span(temp_));
+    return make_builder(entries_).insert_back(temp_.begin(), temp_.end());
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
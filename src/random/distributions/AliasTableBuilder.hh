@@ -0,0 +1,60 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AliasTableBuilder.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+#include "base/Collection.hh"
+#include "base/Span.hh"
+#include "base/Types.hh"
+#include "AliasTableInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct alias tables for O(1) sampling of discrete distributions.
+ *
+ * The tables are built at setup time with Vose's algorithm from a list of
+ * non-negative, unnormalized weights, and sampled with \c AliasSampler. Each
+ * call appends a new table to the host collection and returns its range.
+ *
+ * \code
+    AliasTableBuilder build_table(&data->alias_entries);
+    ItemRange<AliasEntry> table = build_table(make_span(weights));
+   \endcode
+ *
+ * The static \c build method fills an existing span for classes that manage
+ * their own storage.
+ */
+class AliasTableBuilder
+{
+  public:
+    //!@{
+    //! Type aliases
+    using AliasItems
+        = Collection<AliasEntry, Ownership::value, MemSpace::host>;
+    using SpanConstReal = Span<const real_type>;
+    //!@}
+
+  public:
+    // Fill an alias table from unnormalized weights
+    static void build(SpanConstReal weights, Span<AliasEntry> table);
+
+    // Construct with a reference to the host storage
+    explicit AliasTableBuilder(AliasItems* entries);
+
+    // Append an alias table built from unnormalized weights
+    ItemRange<AliasEntry> operator()(SpanConstReal weights);
+
+  private:
+    AliasItems*             entries_;
+    std::vector<AliasEntry> temp_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
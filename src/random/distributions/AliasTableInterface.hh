@@ -0,0 +1,29 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AliasTableInterface.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Single bin of a Walker/Vose alias table.
+ *
+ * Each of the \em n bins has equal probability \em 1/n of being selected. The
+ * bin's own index is returned with the given (conditional) probability, and
+ * the alias index is returned otherwise.
+ */
+struct AliasEntry
+{
+    real_type probability; //!< Probability of accepting this bin
+    size_type alias;       //!< Index to return if not accepted
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -24,11 +24,13 @@ enum class Action
     spawned,   //!< Primary particle from an event or creation of a secondary
     scattered, //!< Scattering interaction
     entered_volume, //!< Propagated to a new region of space
+    split,          //!< Split into multiple lower-weight tracks
     // KILLING ACTIONS BELOW
     begin_killed_,
     absorbed = begin_killed_, //!< Absorbed (killed)
     cutoff_energy,            //!< Below energy cutoff (killed)
     escaped,                  //!< Exited geometry (killed)
+    rouletted,                //!< Lost Russian roulette (killed)
     end_killed_
 };
 
@@ -17,13 +17,18 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 /*!
  * Simulation state of a track.
+ *
+ * The statistical weight is unity for analog transport. Variance reduction
+ * (Russian roulette and splitting) modifies it, and secondaries inherit the
+ * weight of their parent.
  */
 struct SimTrackState
 {
-    TrackId track_id;      //!< Unique ID for this track
-    TrackId parent_id;     //!< ID of parent that created it
-    EventId event_id;      //!< ID of originating event
-    bool    alive = false; //!< Whether this track is alive
+    TrackId   track_id;      //!< Unique ID for this track
+    TrackId   parent_id;     //!< ID of parent that created it
+    EventId   event_id;      //!< ID of originating event
+    bool      alive = false; //!< Whether this track is alive
+    real_type weight = 1;    //!< Statistical weight
 };
 
 //---------------------------------------------------------------------------//
@@ -39,15 +39,17 @@ class SimTrackView
 
     //!@{
     //! State accessors
-    CELER_FUNCTION TrackId track_id() const { return state_.track_id; }
-    CELER_FUNCTION TrackId parent_id() const { return state_.parent_id; }
-    CELER_FUNCTION EventId event_id() const { return state_.event_id; }
-    CELER_FUNCTION bool    alive() const { return state_.alive; }
+    CELER_FUNCTION TrackId   track_id() const { return state_.track_id; }
+    CELER_FUNCTION TrackId   parent_id() const { return state_.parent_id; }
+    CELER_FUNCTION EventId   event_id() const { return state_.event_id; }
+    CELER_FUNCTION bool      alive() const { return state_.alive; }
+    CELER_FUNCTION real_type weight() const { return state_.weight; }
     //!@}
 
     //!@{
     //! State modifiers via non-const references
-    CELER_FUNCTION bool& alive() { return state_.alive; }
+    CELER_FUNCTION bool&      alive() { return state_.alive; }
+    CELER_FUNCTION real_type& weight() { return state_.weight; }
     //!@}
 
   private:
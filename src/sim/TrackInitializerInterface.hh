@@ -36,9 +36,12 @@ struct TrackInitializerPointers
 {
     Span<TrackInitializer>    initializers;
     Span<size_type>           parent;
+    Span<size_type>           vertex;
     Span<size_type>           vacancies;
     Span<size_type>           secondary_counts;
     Span<TrackId::size_type>  track_counter;
+    Span<ull_int>             parent_copies;
+    Span<ull_int>             vertex_copies;
 
     //! Whether the data are assigned
     explicit CELER_FUNCTION operator bool() const
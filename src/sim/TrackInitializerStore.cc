@@ -22,8 +22,11 @@ TrackInitializerStore::TrackInitializerStore(size_type            num_tracks,
                                              std::vector<Primary> primaries)
     : initializers_(capacity)
     , parent_(capacity)
+    , vertex_(capacity)
     , vacancies_(num_tracks)
     , secondary_counts_(num_tracks)
+    , parent_copies_(1)
+    , vertex_copies_(1)
     , primaries_(primaries)
 {
     // Start with an empty vector of track initializers and parent thread IDs
@@ -50,6 +53,11 @@ TrackInitializerStore::TrackInitializerStore(size_type            num_tracks,
     track_counter_
         = DeviceVector<TrackId::size_type>(host_track_counter.size());
     track_counter_.copy_to_device(make_span(host_track_counter));
+
+    // Start counting the geometry states copied instead of located
+    std::vector<ull_int> host_zero(1, 0);
+    parent_copies_.copy_to_device(make_span(host_zero));
+    vertex_copies_.copy_to_device(make_span(host_zero));
 }
 
 //---------------------------------------------------------------------------//
@@ -61,14 +69,48 @@ TrackInitializerPointers TrackInitializerStore::device_pointers()
     TrackInitializerPointers result;
     result.initializers     = initializers_.device_pointers();
     result.parent           = parent_.device_pointers();
+    result.vertex           = vertex_.device_pointers();
     result.vacancies        = vacancies_.device_pointers();
     result.secondary_counts = secondary_counts_.device_pointers();
     result.track_counter    = track_counter_.device_pointers();
+    result.parent_copies    = parent_copies_.device_pointers();
+    result.vertex_copies    = vertex_copies_.device_pointers();
 
     CELER_ENSURE(result);
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Number of new tracks that copied their parent's geometry state.
+ *
+ * This counts secondaries initialized in a new track slot from the state of
+ * their parent, which is still alive, rather than by locating the starting
+ * position from the world volume. Secondaries that replace their dead parent
+ * in place keep its state and would never have been located, so they are not
+ * counted.
+ */
+ull_int TrackInitializerStore::num_parent_copies() const
+{
+    std::vector<ull_int> result(1);
+    parent_copies_.copy_to_host(make_span(result));
+    return result.front();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number of new primaries that copied another primary's geometry state.
+ *
+ * This counts the primaries whose geometry was copied from the located state
+ * of an earlier primary with the same starting position.
+ */
+ull_int TrackInitializerStore::num_vertex_copies() const
+{
+    std::vector<ull_int> result(1);
+    vertex_copies_.copy_to_host(make_span(result));
+    return result.front();
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Create track initializers on device from primary particles.
@@ -77,6 +119,11 @@ TrackInitializerPointers TrackInitializerStore::device_pointers()
  * from host primaries (either the number of host primaries that have not yet
  * been initialized on device or the size of the available storage in the track
  * initializer vector, whichever is smaller).
+ *
+ * Consecutive primaries with the same starting position (e.g. from a beam or
+ * a multi-particle vertex) are marked as sharing a vertex: when they are
+ * initialized together, only the first is located in the geometry and the
+ * rest copy its navigation state.
  */
 void TrackInitializerStore::extend_from_primaries()
 {
@@ -85,16 +132,32 @@ void TrackInitializerStore::extend_from_primaries()
         initializers_.capacity() - initializers_.size(), primaries_.size());
     if (count)
     {
-        initializers_.resize(initializers_.size() + count);
+        const size_type start = initializers_.size();
+        initializers_.resize(start + count);
+
+        // Find the index of the first initializer at each primary's vertex
+        Span<const Primary> host_primaries{
+            primaries_.data() + primaries_.size() - count, count};
+        std::vector<size_type> host_vertex(count);
+        for (size_type i = 0; i != count; ++i)
+        {
+            host_vertex[i] = (i > 0
+                              && host_primaries[i].position
+                                     == host_primaries[i - 1].position)
+                                 ? host_vertex[i - 1]
+                                 : start + i;
+        }
 
         // Allocate memory on device and copy primaries
         DeviceVector<Primary> primaries(count);
-        primaries.copy_to_device(
-            {primaries_.data() + primaries_.size() - count, count});
+        primaries.copy_to_device(host_primaries);
+        DeviceVector<size_type> vertex(count);
+        vertex.copy_to_device(make_span(host_vertex));
         primaries_.resize(primaries_.size() - count);
 
         // Launch a kernel to create track initializers from primaries
         detail::process_primaries(primaries.device_pointers(),
+                                  vertex.device_pointers(),
                                   this->device_pointers());
     }
 }
@@ -209,6 +272,8 @@ void TrackInitializerStore::extend_from_secondaries(StateStore* states,
  * state copied over from the parent instead of initialized from the position.
  * If there are more empty slots than new secondaries, they will be filled by
  * any track initializers remaining from previous steps using the position.
+ * Primaries that share a vertex with another primary initialized in the same
+ * call copy that primary's geometry state instead.
  */
 void TrackInitializerStore::initialize_tracks(StateStore* states,
                                               ParamStore* params)
@@ -40,6 +40,12 @@ class TrackInitializerStore
     //! Number of primary particles left to be initialized on device
     size_type num_primaries() const { return primaries_.size(); }
 
+    // Number of new tracks that copied their parent's geometry state
+    ull_int num_parent_copies() const;
+
+    // Number of new primaries that copied another primary's geometry state
+    ull_int num_vertex_copies() const;
+
     // Create track initializers on device from primary particles
     void extend_from_primaries();
 
@@ -56,6 +62,9 @@ class TrackInitializerStore
     // Thread ID of the secondary's parent
     DeviceVector<size_type> parent_;
 
+    // Index of the first primary initializer at the same starting position
+    DeviceVector<size_type> vertex_;
+
     // Index of empty slots in track vector
     DeviceVector<size_type> vacancies_;
 
@@ -65,6 +74,12 @@ class TrackInitializerStore
     // Track ID counter for each event
     DeviceVector<TrackId::size_type> track_counter_;
 
+    // Number of geometry states copied from a parent instead of located
+    DeviceVector<ull_int> parent_copies_;
+
+    // Number of geometry states copied from a primary instead of located
+    DeviceVector<ull_int> vertex_copies_;
+
     // Host-side primary particles
     std::vector<Primary> primaries_;
 };
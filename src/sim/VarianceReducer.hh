@@ -0,0 +1,81 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file VarianceReducer.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "geometry/Types.hh"
+#include "physics/base/Interaction.hh"
+#include "physics/base/ParticleTrackView.hh"
+#include "physics/base/SecondaryAllocatorView.hh"
+#include "SimTrackView.hh"
+#include "VarianceReductionInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Apply Russian roulette and splitting to a single track.
+ *
+ * The reducer updates the statistical weight and the alive flag of the
+ * track's sim state directly; all other changes are returned as an \c
+ * Interaction to be applied by the caller.
+ *
+ * Splitting creates copies of the track as secondaries with the same type,
+ * energy, and direction. Since secondaries inherit the weight of the parent
+ * when they are converted to tracks, splitting should be applied only when the
+ * track has not produced any physics secondaries in the same step (e.g. at a
+ * volume boundary crossing).
+ *
+ * \code
+    VarianceReducer reduce(shared.variance, particle, sim);
+    if (!reduce.roulette(rng))
+    {
+        // Track was killed
+    }
+   \endcode
+ */
+class VarianceReducer
+{
+  public:
+    //!@{
+    //! Type aliases
+    using VarianceReductionPointers
+        = VarianceReductionData<Ownership::const_reference, MemSpace::native>;
+    //!@}
+
+  public:
+    // Construct with shared data and track views
+    inline CELER_FUNCTION
+    VarianceReducer(const VarianceReductionPointers& shared,
+                    const ParticleTrackView&         particle,
+                    SimTrackView&                    sim);
+
+    // Apply energy-based Russian roulette, returning whether the track lives
+    template<class Engine>
+    inline CELER_FUNCTION bool roulette(Engine& rng);
+
+    // Split or roulette a track moving between volumes of different importance
+    template<class Engine>
+    inline CELER_FUNCTION Interaction
+    cross_boundary(VolumeId                prev,
+                   VolumeId                next,
+                   const Real3&            direction,
+                   SecondaryAllocatorView& allocate,
+                   Engine&                 rng);
+
+  private:
+    const VarianceReductionPointers& shared_;
+    const ParticleTrackView&         particle_;
+    SimTrackView&                    sim_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "VarianceReducer.i.hh"
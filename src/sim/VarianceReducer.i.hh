@@ -0,0 +1,143 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file VarianceReducer.i.hh
+//---------------------------------------------------------------------------//
+#include <cmath>
+#include "base/Algorithms.hh"
+#include "base/Assert.hh"
+#include "random/distributions/BernoulliDistribution.hh"
+#include "random/distributions/GenerateCanonical.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with shared data and track views.
+ */
+CELER_FUNCTION
+VarianceReducer::VarianceReducer(const VarianceReductionPointers& shared,
+                                 const ParticleTrackView&         particle,
+                                 SimTrackView&                    sim)
+    : shared_(shared), particle_(particle), sim_(sim)
+{
+    CELER_EXPECT(shared_);
+    CELER_EXPECT(particle_.particle_id() < shared_.roulette.size());
+    CELER_EXPECT(sim_.alive());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Apply energy-based Russian roulette.
+ *
+ * A track below its particle type's threshold energy survives with the
+ * configured probability \em p, and its weight is multiplied by \em 1/p. A
+ * track that loses is killed without depositing its energy: the expected
+ * weighted energy is carried by the survivors.
+ */
+template<class Engine>
+CELER_FUNCTION bool VarianceReducer::roulette(Engine& rng)
+{
+    const RouletteParams& params = shared_.roulette[particle_.particle_id()];
+    if (!params || particle_.energy().value() >= params.energy_threshold)
+    {
+        return true;
+    }
+
+    if (BernoulliDistribution(params.survival_probability)(rng))
+    {
+        sim_.weight() /= params.survival_probability;
+        return true;
+    }
+
+    sim_.alive() = false;
+    return false;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Split or roulette a track moving between volumes of different importance.
+ *
+ * For an importance ratio \em r greater than one, the track is split into
+ * \em n tracks where \em n is \em r stochastically rounded to an integer and
+ * limited to \c max_split . Each (including the original) has 1/n of the
+ * original weight. For a ratio less than one, the track survives with
+ * probability \em r and its weight is divided by \em r.
+ *
+ * If secondary allocation fails, the weight is unchanged and a failed
+ * interaction is returned so that the crossing can be retried.
+ */
+template<class Engine>
+CELER_FUNCTION Interaction
+VarianceReducer::cross_boundary(VolumeId                prev,
+                                VolumeId                next,
+                                const Real3&            direction,
+                                SecondaryAllocatorView& allocate,
+                                Engine&                 rng)
+{
+    Interaction result;
+    result.action    = Action::entered_volume;
+    result.energy    = particle_.energy();
+    result.direction = direction;
+
+    if (!(prev < shared_.importance.size())
+        || !(next < shared_.importance.size()))
+    {
+        // No importance defined for one of the volumes
+        return result;
+    }
+
+    const real_type ratio = shared_.importance[next]
+                            / shared_.importance[prev];
+    if (ratio > 1)
+    {
+        // Stochastically round the number of tracks to preserve the mean
+        real_type num_tracks = std::floor(ratio);
+        if (generate_canonical(rng) < ratio - num_tracks)
+        {
+            num_tracks += 1;
+        }
+        size_type num_split
+            = min(static_cast<size_type>(num_tracks), shared_.max_split);
+        if (num_split <= 1)
+        {
+            return result;
+        }
+
+        Secondary* secondaries = allocate(num_split - 1);
+        if (secondaries == nullptr)
+        {
+            // Failed to allocate space for the copies
+            return Interaction::from_failure();
+        }
+        result.secondaries = {secondaries, num_split - 1};
+        for (Secondary& copy : result.secondaries)
+        {
+            copy.particle_id = particle_.particle_id();
+            copy.energy      = particle_.energy();
+            copy.direction   = direction;
+        }
+
+        sim_.weight() /= num_split;
+        result.action = Action::split;
+    }
+    else if (ratio < 1)
+    {
+        if (BernoulliDistribution(ratio)(rng))
+        {
+            sim_.weight() /= ratio;
+        }
+        else
+        {
+            sim_.alive()  = false;
+            result        = Interaction::from_absorption();
+            result.action = Action::rouletted;
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
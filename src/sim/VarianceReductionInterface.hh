@@ -0,0 +1,82 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file VarianceReductionInterface.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Collection.hh"
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "geometry/Types.hh"
+#include "physics/base/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+// PARAMS
+//---------------------------------------------------------------------------//
+/*!
+ * Russian roulette parameters for a single particle type.
+ *
+ * Tracks below the threshold energy survive with the given probability (and
+ * their weight is increased by its inverse). A zero threshold disables
+ * roulette for the particle type.
+ */
+struct RouletteParams
+{
+    real_type energy_threshold{0};     //!< Roulette below this [MeV]
+    real_type survival_probability{1}; //!< Chance of surviving roulette
+
+    //! Whether roulette is applied to this particle type
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return energy_threshold > 0;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Persistent variance reduction data.
+ *
+ * The optional \c importance values are indexed by geometry volume. When a
+ * track crosses from one volume to another, the ratio of importances
+ * determines whether it is split (ratio above one) or rouletted (below one).
+ * The number of tracks created by a single split is limited by \c max_split .
+ */
+template<Ownership W, MemSpace M>
+struct VarianceReductionData
+{
+    template<class T>
+    using ParticleItems = Collection<T, W, M, ParticleId>;
+    template<class T>
+    using VolumeItems = Collection<T, W, M, VolumeId>;
+
+    ParticleItems<RouletteParams> roulette;   //!< [particle]
+    VolumeItems<real_type>        importance; //!< [volume] (optional)
+    size_type                     max_split{0};
+
+    //// MEMBER FUNCTIONS ////
+
+    //! True if assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !roulette.empty() && max_split > 0;
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    VarianceReductionData& operator=(const VarianceReductionData<W2, M2>& other)
+    {
+        CELER_EXPECT(other);
+        roulette   = other.roulette;
+        importance = other.importance;
+        max_split  = other.max_split;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,67 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file VarianceReductionParams.cc
+//---------------------------------------------------------------------------//
+#include "VarianceReductionParams.hh"
+
+#include <utility>
+#include "base/Assert.hh"
+#include "base/CollectionBuilder.hh"
+#include "comm/Logger.hh"
+#include "physics/base/ParticleParams.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with particle definitions and options.
+ */
+VarianceReductionParams::VarianceReductionParams(
+    const ParticleParams& particles, const Input& inp)
+{
+    CELER_VALIDATE(inp.max_split > 0,
+                   "Maximum number of split tracks must be positive");
+
+    // Roulette thresholds, defaulting to none
+    std::vector<RouletteParams> roulette(particles.size());
+    for (const auto& pdg_inp : inp.roulette)
+    {
+        ParticleId pid = particles.find(pdg_inp.first);
+        if (!pid)
+        {
+            CELER_LOG(debug) << "Ignoring roulette parameters for unused "
+                                "particle type with PDG number "
+                             << pdg_inp.first.get();
+            continue;
+        }
+        const RouletteInput& r = pdg_inp.second;
+        CELER_VALIDATE(r.energy.value() >= 0,
+                       "Roulette energy threshold must be nonnegative");
+        CELER_VALIDATE(r.survival_probability > 0
+                           && r.survival_probability <= 1,
+                       "Roulette survival probability must be in (0, 1]");
+        roulette[pid.get()].energy_threshold     = r.energy.value();
+        roulette[pid.get()].survival_probability = r.survival_probability;
+    }
+
+    for (real_type imp : inp.importance)
+    {
+        CELER_VALIDATE(imp > 0, "Volume importances must be positive");
+    }
+
+    VarianceReductionData<Ownership::value, MemSpace::host> host_data;
+    make_builder(&host_data.roulette)
+        .insert_back(roulette.begin(), roulette.end());
+    make_builder(&host_data.importance)
+        .insert_back(inp.importance.begin(), inp.importance.end());
+    host_data.max_split = inp.max_split;
+
+    data_ = CollectionMirror<VarianceReductionData>{std::move(host_data)};
+    CELER_ENSURE(data_);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,73 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file VarianceReductionParams.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <map>
+#include <vector>
+#include "base/CollectionMirror.hh"
+#include "base/Types.hh"
+#include "physics/base/PDGNumber.hh"
+#include "physics/base/Units.hh"
+#include "VarianceReductionInterface.hh"
+
+namespace celeritas
+{
+class ParticleParams;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Manage Russian roulette and splitting parameters.
+ *
+ * Roulette thresholds are given per particle type (by PDG number); particle
+ * types without an entry are never rouletted by energy. The optional
+ * importance values, one per geometry volume, enable splitting and roulette
+ * at volume boundaries.
+ */
+class VarianceReductionParams
+{
+  public:
+    //!@{
+    //! Type aliases
+    using HostRef
+        = VarianceReductionData<Ownership::const_reference, MemSpace::host>;
+    using DeviceRef
+        = VarianceReductionData<Ownership::const_reference, MemSpace::device>;
+    //!@}
+
+    //! Roulette input for a single particle type
+    struct RouletteInput
+    {
+        units::MevEnergy energy;               //!< Roulette below this energy
+        real_type        survival_probability; //!< Chance of surviving
+    };
+
+    //! Variance reduction construction arguments
+    struct Input
+    {
+        std::map<PDGNumber, RouletteInput> roulette;
+        std::vector<real_type>             importance; //!< [volume]
+        size_type                          max_split = 8;
+    };
+
+  public:
+    // Construct with particle definitions and options
+    VarianceReductionParams(const ParticleParams& particles, const Input& inp);
+
+    //! Access data on the host
+    const HostRef& host_pointers() const { return data_.host(); }
+
+    //! Access data on the device
+    const DeviceRef& device_pointers() const { return data_.device(); }
+
+  private:
+    // Host/device storage and reference
+    CollectionMirror<VarianceReductionData> data_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -12,6 +12,7 @@
 #include <thrust/remove.h>
 #include <thrust/scan.h>
 #include <vector>
+#include "base/Algorithms.hh"
 #include "base/Atomics.hh"
 #include "base/DeviceVector.hh"
 #include "base/KernelParamCalculator.cuda.hh"
@@ -87,16 +88,64 @@ __global__ void init_tracks_kernel(const StatePointers            states,
                 GeoTrackView parent(
                     params.geo, states.geo, ThreadId{parent_id});
                 geo = {parent, init.geo.dir};
+                atomic_add(&inits.parent_copies[0], ull_int(1));
             }
-            else
+            else if (find_vertex_thread(
+                         inits.vertex.subspan(0, inits.initializers.size()),
+                         inits.parent.size(),
+                         thread_id,
+                         num_vacancies)
+                     == flag_id())
             {
                 // Initialize it from the position (more expensive)
                 geo = init.geo;
             }
+            // Otherwise the state is copied from another primary at the same
+            // vertex once it has been located
         }
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Initialize the geometry of primaries that share a vertex.
+ *
+ * This must be launched after \c init_tracks_kernel has located the first
+ * primary at each vertex.
+ */
+__global__ void init_vertex_tracks_kernel(const StatePointers states,
+                                          const ParamPointers params,
+                                          const TrackInitializerPointers inits,
+                                          size_type num_vacancies)
+{
+    auto      thread_id     = KernelParamCalculator::thread_id().get();
+    size_type vertex_thread = flag_id();
+    if (thread_id < num_vacancies)
+    {
+        vertex_thread = find_vertex_thread(
+            inits.vertex.subspan(0, inits.initializers.size()),
+            inits.parent.size(),
+            thread_id,
+            num_vacancies);
+    }
+    if (vertex_thread != flag_id())
+    {
+        const TrackInitializer& init
+            = inits.initializers[inits.initializers.size() - thread_id - 1];
+
+        // Track slots of this track and the located primary
+        const size_type num_vac = inits.vacancies.size();
+        ThreadId slot_id(inits.vacancies[num_vac - thread_id - 1]);
+        ThreadId vertex_slot_id(inits.vacancies[num_vac - vertex_thread - 1]);
+
+        // Copy the geometry state from the located primary
+        GeoTrackView geo(params.geo, states.geo, slot_id);
+        GeoTrackView vertex(params.geo, states.geo, vertex_slot_id);
+        geo = {vertex, init.geo.dir};
+        atomic_add(&inits.vertex_copies[0], ull_int(1));
+    }
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Find empty slots in the track vector and count the number of secondaries
@@ -146,8 +195,12 @@ __global__ void locate_alive_kernel(const StatePointers            states,
             TrackId::size_type track_id
                 = atomic_add(&inits.track_counter[sim.event_id().get()], 1u);
 
-            // Initialize the simulation state
-            sim = {TrackId{track_id}, sim.track_id(), sim.event_id(), true};
+            // Initialize the simulation state, inheriting the parent's weight
+            sim = {TrackId{track_id},
+                   sim.track_id(),
+                   sim.event_id(),
+                   true,
+                   sim.weight()};
 
             // Initialize the particle state from the secondary
             Secondary&        secondary = result.secondaries[secondary_id];
@@ -179,7 +232,9 @@ __global__ void locate_alive_kernel(const StatePointers            states,
  */
 __global__ void
 process_primaries_kernel(const Span<const Primary>    primaries,
-                         const Span<TrackInitializer> initializers)
+                         const Span<const size_type>  primary_vertex,
+                         const Span<TrackInitializer> initializers,
+                         const Span<size_type>        vertex)
 {
     auto thread_id = KernelParamCalculator::thread_id();
     if (thread_id < primaries.size())
@@ -187,11 +242,15 @@ process_primaries_kernel(const Span<const Primary>    primaries,
         TrackInitializer& init    = initializers[thread_id.get()];
         const Primary&    primary = primaries[thread_id.get()];
 
+        // Save the first initializer at the same vertex
+        vertex[thread_id.get()] = primary_vertex[thread_id.get()];
+
         // Construct a track initializer from a primary particle
         init.sim.track_id         = primary.track_id;
         init.sim.parent_id        = TrackId{};
         init.sim.event_id         = primary.event_id;
         init.sim.alive            = true;
+        init.sim.weight           = primary.weight;
         init.geo.pos              = primary.position;
         init.geo.dir              = primary.direction;
         init.particle.particle_id = primary.particle_id;
@@ -226,8 +285,10 @@ __global__ void process_secondaries_kernel(const StatePointers states,
                 CELER_ASSERT(offset_id < inits.initializers.size());
                 TrackInitializer& init = inits.initializers[offset_id];
 
-                // Store the thread ID of the secondary's parent
+                // Store the thread ID of the secondary's parent, which
+                // replaces a shared vertex
                 CELER_ASSERT(offset_id < inits.parent.size());
+                inits.vertex[offset_id]   = flag_id();
                 inits.parent[offset_id++] = thread_id.get();
 
                 // Calculate the track ID of the secondary
@@ -242,6 +303,7 @@ __global__ void process_secondaries_kernel(const StatePointers states,
                 init.sim.parent_id        = sim.track_id();
                 init.sim.event_id         = sim.event_id();
                 init.sim.alive            = true;
+                init.sim.weight           = sim.weight();
                 init.geo.pos              = geo.pos();
                 init.geo.dir              = secondary.direction;
                 init.particle.particle_id = secondary.particle_id;
@@ -275,6 +337,14 @@ void init_tracks(const StatePointers&            states,
     init_tracks_kernel<<<lparams.grid_size, lparams.block_size>>>(
         states, params, inits, num_vacancies);
     CELER_CUDA_CHECK_ERROR();
+
+    // Copy geometry states to primaries that share a vertex
+    static const celeritas::KernelParamCalculator calc_vertex_launch_params(
+        init_vertex_tracks_kernel, "init_vertex_tracks");
+    lparams = calc_vertex_launch_params(num_vacancies);
+    init_vertex_tracks_kernel<<<lparams.grid_size, lparams.block_size>>>(
+        states, params, inits, num_vacancies);
+    CELER_CUDA_CHECK_ERROR();
 }
 
 //---------------------------------------------------------------------------//
@@ -299,20 +369,26 @@ void locate_alive(const StatePointers&            states,
  * Create track initializers from primary particles.
  */
 void process_primaries(Span<const Primary>             primaries,
+                       Span<const size_type>           vertex,
                        const TrackInitializerPointers& inits)
 {
     CELER_EXPECT(primaries.size() <= inits.initializers.size());
+    CELER_EXPECT(vertex.size() == primaries.size());
 
     // Get a view to the last primaries.size() initializers
-    auto initializers = inits.initializers.subspan(inits.initializers.size()
-                                                   - primaries.size());
+    const size_type start
+        = inits.initializers.size() - primaries.size();
+    auto initializers = inits.initializers.subspan(start);
     CELER_ASSERT(initializers.size() == primaries.size());
 
     static const celeritas::KernelParamCalculator calc_launch_params(
         process_primaries_kernel, "process_primaries");
     auto                  lparams = calc_launch_params(primaries.size());
     process_primaries_kernel<<<lparams.grid_size, lparams.block_size>>>(
-        primaries, initializers);
+        primaries,
+        vertex,
+        initializers,
+        inits.vertex.subspan(start, primaries.size()));
     CELER_CUDA_CHECK_ERROR();
 }
 
@@ -328,8 +404,9 @@ void process_secondaries(const StatePointers&     states,
     CELER_EXPECT(states.size() <= states.interactions.size());
 
     // Get a view to the last num_secondaries initializers
-    inits.initializers = inits.initializers.subspan(inits.initializers.size()
-                                                    - inits.parent.size());
+    const size_type start = inits.initializers.size() - inits.parent.size();
+    inits.initializers    = inits.initializers.subspan(start);
+    inits.vertex          = inits.vertex.subspan(start, inits.parent.size());
     static const celeritas::KernelParamCalculator calc_launch_params(
         process_secondaries_kernel, "process_secondaries");
     auto                  lparams = calc_launch_params(states.size());
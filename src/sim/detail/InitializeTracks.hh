@@ -7,23 +7,16 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
-#include "base/NumericLimits.hh"
 #include "base/Span.hh"
 #include "physics/base/Primary.hh"
 #include "sim/TrackInterface.hh"
 #include "sim/TrackInitializerInterface.hh"
+#include "TrackInitUtils.hh"
 
 namespace celeritas
 {
 namespace detail
 {
-//---------------------------------------------------------------------------//
-// Invalid index flag
-CELER_CONSTEXPR_FUNCTION size_type flag_id()
-{
-    return numeric_limits<size_type>::max();
-}
-
 //---------------------------------------------------------------------------//
 // Initialize the track states on device.
 void init_tracks(const StatePointers&            states,
@@ -40,6 +33,7 @@ void locate_alive(const StatePointers&            states,
 //---------------------------------------------------------------------------//
 // Create track initializers on device from primary particles
 void process_primaries(Span<const Primary>             primaries,
+                       Span<const size_type>           vertex,
                        const TrackInitializerPointers& inits);
 
 //---------------------------------------------------------------------------//
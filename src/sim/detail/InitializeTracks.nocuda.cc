@@ -28,7 +28,9 @@ void locate_alive(const StatePointers&,
     CELER_ASSERT_UNREACHABLE();
 }
 
-void process_primaries(Span<const Primary>, const TrackInitializerPointers&)
+void process_primaries(Span<const Primary>,
+                       Span<const size_type>,
+                       const TrackInitializerPointers&)
 {
     CELER_ASSERT_UNREACHABLE();
 }
@@ -0,0 +1,74 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TrackInitUtils.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Algorithms.hh"
+#include "base/Assert.hh"
+#include "base/Macros.hh"
+#include "base/NumericLimits.hh"
+#include "base/Span.hh"
+#include "base/Types.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+// Invalid index flag
+CELER_CONSTEXPR_FUNCTION size_type flag_id()
+{
+    return numeric_limits<size_type>::max();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the thread whose geometry state a new primary track can copy.
+ *
+ * Initializers are consumed from the back, so thread \c i initializes a track
+ * from initializer <tt>vertex.size() - i - 1</tt>. The \c vertex span holds,
+ * for each initializer, the index of the first initializer at the same vertex
+ * (or \c flag_id() for a secondary). The first \c num_parents threads are
+ * secondaries that copy their parent's state.
+ *
+ * Of the primaries that share a vertex and are initialized in this batch,
+ * the one with the lowest initializer index (i.e. the highest thread ID) is
+ * located and the rest copy its state. The result is \c flag_id() if this
+ * thread's track has a parent or must locate its own position.
+ */
+inline CELER_FUNCTION size_type
+find_vertex_thread(Span<const size_type> vertex,
+                   size_type             num_parents,
+                   size_type             thread_id,
+                   size_type             num_vacancies)
+{
+    CELER_EXPECT(thread_id < num_vacancies);
+    CELER_EXPECT(num_vacancies <= vertex.size());
+
+    if (thread_id < num_parents)
+    {
+        // Secondaries copy their parent's state
+        return flag_id();
+    }
+
+    const size_type num_inits = vertex.size();
+    const size_type first     = vertex[num_inits - thread_id - 1];
+    if (first == flag_id())
+    {
+        // Secondary whose parent state is no longer available
+        return flag_id();
+    }
+
+    // Only initializers in this batch will have a located state
+    const size_type vertex_thread
+        = num_inits - 1 - celeritas::max(first, num_inits - num_vacancies);
+    return vertex_thread != thread_id ? vertex_thread : flag_id();
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
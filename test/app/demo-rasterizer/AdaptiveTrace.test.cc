@@ -0,0 +1,176 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AdaptiveTrace.test.cc
+//---------------------------------------------------------------------------//
+#include "demo-rasterizer/AdaptiveTrace.hh"
+
+#include <memory>
+#include <vector>
+#include "base/CollectionStateStore.hh"
+#include "base/Range.hh"
+#include "geometry/BoxGeoParams.hh"
+#include "geometry/BoxGeoTrackView.hh"
+#include "celeritas_test.hh"
+
+using namespace celeritas;
+using namespace demo_rasterizer;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class AdaptiveTraceTest : public celeritas::Test
+{
+  protected:
+    using StateStore = CollectionStateStore<BoxGeoStateData, MemSpace::host>;
+    using VecInt     = std::vector<int>;
+
+    void SetUp() override
+    {
+        // Box detector, plus a slab too thin to resolve with coarse lines
+        BoxGeoParams::Input inp;
+        inp.volume_labels = {"world", "detector", "slab"};
+        inp.boxes         = {
+            {VolumeId{0}, {-50, -50, -50}, {50, 50, 50}, {}},
+            {VolumeId{1}, {-5, -5, -5}, {5, 5, 5}, BoxId{0}},
+            {VolumeId{2}, {-6, -7, -1}, {6, -6.8, 1}, BoxId{0}},
+        };
+        params = std::make_shared<BoxGeoParams>(std::move(inp));
+        states = StateStore(*params, 1);
+    }
+
+    BoxGeoTrackView make_geo_track_view()
+    {
+        return {params->host_pointers(), states.ref(), ThreadId{0}};
+    }
+
+    //! Construct a 64x64 image of the z=0 plane in [-8, 8]
+    ImagePointers make_image(VecInt* storage) const
+    {
+        ImagePointers result;
+        result.origin      = {-8, 8, 0};
+        result.down_ax     = {0, -1, 0};
+        result.right_ax    = {1, 0, 0};
+        result.pixel_width = 0.25;
+        result.dims        = {64, 64};
+        storage->assign(result.dims[0] * result.dims[1], -2);
+        result.image = make_span(*storage);
+        return result;
+    }
+
+    //! Get a single line of a stored image
+    VecInt get_line(const VecInt& image, unsigned int line) const
+    {
+        auto start = image.begin() + line * 64;
+        return VecInt(start, start + 64);
+    }
+
+    std::shared_ptr<const BoxGeoParams> params;
+    StateStore                          states;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(AdaptiveTraceTest, refine)
+{
+    BoxGeoTrackView geo = this->make_geo_track_view();
+
+    // Trace every line
+    VecInt        expected;
+    ImagePointers full_ref = this->make_image(&expected);
+    for (auto line : range(full_ref.dims[0]))
+    {
+        ImageTrackView image_line(full_ref, ThreadId{line});
+        trace_line(geo, image_line);
+    }
+
+    // Trace coarse lines and refine the bands between them, as the host
+    // runner does
+    VecInt                  actual;
+    ImagePointers           adaptive_ref = this->make_image(&actual);
+    std::vector<VecSegment> segments(adaptive_ref.dims[0]);
+    const CoarseLines       coarse{8, adaptive_ref.dims[0] - 1};
+    EXPECT_EQ(8, coarse.num_bands());
+    for (auto i : range(coarse.num_bands() + 1))
+    {
+        trace_recorded_line(
+            geo, adaptive_ref, coarse(i), &segments[coarse(i)]);
+    }
+    unsigned int num_refined = 0;
+    for (auto i : range(coarse.num_bands()))
+    {
+        num_refined += refine_lines(
+            geo, adaptive_ref, coarse(i), coarse(i + 1), &segments);
+    }
+
+    // Lines are traced only near the detector edges
+    VecInt traced_lines;
+    for (auto line : range(adaptive_ref.dims[0]))
+    {
+        if (!segments[line].empty())
+        {
+            traced_lines.push_back(line);
+        }
+    }
+    const int expected_traced_lines[]
+        = {0, 8, 10, 11, 12, 16, 24, 32, 40, 48, 50, 51, 52, 56, 63};
+    EXPECT_VEC_EQ(expected_traced_lines, traced_lines);
+    EXPECT_EQ(traced_lines.size(), coarse.num_bands() + 1 + num_refined);
+
+    // Traced lines are identical to the full trace
+    for (int line : traced_lines)
+    {
+        EXPECT_VEC_EQ(get_line(expected, line), get_line(actual, line))
+            << "traced line " << line;
+    }
+
+    // Uniform bands are interpolated, which is exact for planar boundaries
+    // perpendicular to the lines...
+    for (auto line : range(56u))
+    {
+        EXPECT_VEC_EQ(get_line(expected, line), get_line(actual, line))
+            << "interpolated line " << line;
+    }
+
+    // ... but the slab that lies entirely between two coarse lines is missed
+    const VecInt world_line(64, 0);
+    EXPECT_NE(world_line, get_line(expected, 59));
+    EXPECT_EQ(world_line, get_line(actual, 59));
+}
+
+TEST_F(AdaptiveTraceTest, tile)
+{
+    BoxGeoTrackView geo = this->make_geo_track_view();
+
+    VecInt        expected;
+    ImagePointers full_ref = this->make_image(&expected);
+    for (auto line : range(full_ref.dims[0]))
+    {
+        ImageTrackView image_line(full_ref, ThreadId{line});
+        trace_line(geo, image_line);
+    }
+
+    // Trace lines into a buffer that stores only a tile of the image, as the
+    // host runner does for images that are streamed to disk
+    const unsigned int first_line = 12;
+    const unsigned int num_lines  = 5;
+    VecInt             unused;
+    VecInt             tile(num_lines * 64, -2);
+    ImagePointers      tile_ref = this->make_image(&unused);
+    tile_ref.image              = make_span(tile);
+    tile_ref.first_line         = first_line;
+    for (auto line : range(first_line, first_line + num_lines))
+    {
+        ImageTrackView image_line(tile_ref, ThreadId{line});
+        trace_line(geo, image_line);
+    }
+
+    VecInt expected_tile(expected.begin() + first_line * 64,
+                         expected.begin() + (first_line + num_lines) * 64);
+    EXPECT_VEC_EQ(expected_tile, tile);
+}
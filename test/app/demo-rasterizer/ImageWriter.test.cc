@@ -0,0 +1,221 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ImageWriter.test.cc
+//---------------------------------------------------------------------------//
+#include "demo-rasterizer/ImageWriter.hh"
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+#include "base/Range.hh"
+#include "celeritas_test.hh"
+
+using namespace celeritas;
+using namespace demo_rasterizer;
+using Encoding = ImageWriter::Encoding;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class ImageWriterTest : public celeritas::Test
+{
+  protected:
+    using VecInt = std::vector<int>;
+
+    //! Image read back from a file
+    struct ReadImage
+    {
+        std::string  magic;
+        unsigned int version;
+        Encoding     encoding;
+        unsigned int num_lines;
+        unsigned int num_pixels;
+        VecInt       pixels;     //!< Row-major volume IDs
+        VecInt       num_writes; //!< Number of times each line was written
+    };
+
+    void SetUp() override
+    {
+        // Volume IDs with runs of different lengths and some outside pixels
+        image.resize(num_lines * num_pixels);
+        for (auto j : range(num_lines))
+        {
+            for (auto i : range(num_pixels))
+            {
+                int vol_id = static_cast<int>((i / (1 + j % 3)) % 4) - 1;
+                image[j * num_pixels + i] = vol_id;
+            }
+        }
+    }
+
+    //! Get the pixels of a range of lines
+    ImageWriter::SpanConstInt
+    lines(unsigned int first_line, unsigned int count) const
+    {
+        return make_span(image).subspan(first_line * num_pixels,
+                                        count * num_pixels);
+    }
+
+    //! Parse the file format independently of the writer
+    ReadImage read(const std::string& filename) const
+    {
+        std::ifstream infile(filename, std::ios::binary);
+        CELER_VALIDATE(infile, "Failed to open '" << filename << "'");
+        std::vector<unsigned char> bytes(
+            (std::istreambuf_iterator<char>(infile)),
+            std::istreambuf_iterator<char>());
+        CELER_VALIDATE(bytes.size() >= 8 && bytes.size() % 4 == 0,
+                       "Invalid file size " << bytes.size());
+
+        // Convert little-endian bytes after the magic string to words
+        std::vector<std::uint32_t> words;
+        for (std::size_t i = 8; i < bytes.size(); i += 4)
+        {
+            words.push_back(std::uint32_t(bytes[i])
+                            | std::uint32_t(bytes[i + 1]) << 8
+                            | std::uint32_t(bytes[i + 2]) << 16
+                            | std::uint32_t(bytes[i + 3]) << 24);
+        }
+        CELER_VALIDATE(words.size() >= 4, "Truncated header");
+
+        ReadImage result;
+        result.magic      = std::string(bytes.begin(), bytes.begin() + 8);
+        result.version    = words[0];
+        result.encoding   = static_cast<Encoding>(words[1]);
+        result.num_lines  = words[2];
+        result.num_pixels = words[3];
+        result.pixels.assign(result.num_lines * result.num_pixels, -2);
+        result.num_writes.assign(result.num_lines, 0);
+
+        std::size_t pos = 4;
+        while (pos < words.size())
+        {
+            CELER_VALIDATE(pos + 3 <= words.size(), "Truncated tile header");
+            const unsigned int first_line = words[pos++];
+            const unsigned int tile_lines = words[pos++];
+            const std::size_t  num_words  = words[pos++];
+            CELER_VALIDATE(pos + num_words <= words.size(),
+                           "Truncated tile data");
+            CELER_VALIDATE(first_line + tile_lines <= result.num_lines,
+                           "Tile is out of bounds");
+            for (auto j : range(first_line, first_line + tile_lines))
+            {
+                ++result.num_writes[j];
+            }
+
+            // Decode the tile into the image
+            const std::size_t end = pos + num_words;
+            auto out = result.pixels.begin() + first_line * result.num_pixels;
+            const auto out_end = out + tile_lines * result.num_pixels;
+            if (result.encoding == Encoding::run_length)
+            {
+                CELER_VALIDATE(num_words % 2 == 0, "Odd run-length tile");
+                for (; pos != end; pos += 2)
+                {
+                    CELER_VALIDATE(out + words[pos] <= out_end,
+                                   "Run-length tile overflows its lines");
+                    out = std::fill_n(
+                        out, words[pos], static_cast<int>(words[pos + 1]));
+                }
+            }
+            else
+            {
+                for (; pos != end; ++pos)
+                {
+                    CELER_VALIDATE(out != out_end, "Raw tile is too long");
+                    *out++ = static_cast<int>(words[pos]);
+                }
+            }
+            CELER_VALIDATE(out == out_end, "Tile doesn't fill its lines");
+        }
+        return result;
+    }
+
+    const unsigned int num_lines  = 16;
+    const unsigned int num_pixels = 24;
+    VecInt             image;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(ImageWriterTest, out_of_order)
+{
+    for (Encoding encoding : {Encoding::raw, Encoding::run_length})
+    {
+        SCOPED_TRACE(to_cstring(encoding));
+        const std::string filename = this->make_unique_filename(".bin");
+        {
+            ImageWriter write(filename, {num_lines, num_pixels}, encoding);
+            EXPECT_EQ(encoding, write.encoding());
+            write(8, this->lines(8, 4));
+            write(0, this->lines(0, 3));
+            write(12, this->lines(12, 4));
+            EXPECT_EQ(11, write.num_lines_written());
+            write(3, this->lines(3, 5));
+            EXPECT_EQ(16, write.num_lines_written());
+        }
+
+        ReadImage result = this->read(filename);
+        EXPECT_EQ("CELERIMG", result.magic);
+        EXPECT_EQ(1, result.version);
+        EXPECT_EQ(encoding, result.encoding);
+        EXPECT_EQ(num_lines, result.num_lines);
+        EXPECT_EQ(num_pixels, result.num_pixels);
+        EXPECT_VEC_EQ(VecInt(num_lines, 1), result.num_writes);
+        EXPECT_VEC_EQ(image, result.pixels);
+    }
+}
+
+TEST_F(ImageWriterTest, concurrent)
+{
+    const unsigned int num_threads = 4;
+    for (Encoding encoding : {Encoding::raw, Encoding::run_length})
+    {
+        SCOPED_TRACE(to_cstring(encoding));
+        const std::string filename = this->make_unique_filename(".bin");
+        {
+            // Each thread writes every num_threads'th line, last line first
+            ImageWriter              write(
+                filename, {num_lines, num_pixels}, encoding);
+            std::vector<std::thread> threads;
+            for (auto t : range(num_threads))
+            {
+                threads.emplace_back([&, t] {
+                    for (unsigned int j = num_lines - 1 - t; j < num_lines;
+                         j -= num_threads)
+                    {
+                        write(j, this->lines(j, 1));
+                    }
+                });
+            }
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+            EXPECT_EQ(num_lines, write.num_lines_written());
+        }
+
+        ReadImage result = this->read(filename);
+        EXPECT_VEC_EQ(VecInt(num_lines, 1), result.num_writes);
+        EXPECT_VEC_EQ(image, result.pixels);
+    }
+}
+
+TEST_F(ImageWriterTest, encoding)
+{
+    EXPECT_EQ(Encoding::raw, to_encoding("raw"));
+    EXPECT_EQ(Encoding::run_length, to_encoding("rle"));
+    EXPECT_STREQ("raw", to_cstring(Encoding::raw));
+    EXPECT_STREQ("rle", to_cstring(Encoding::run_length));
+    EXPECT_THROW(to_encoding("png"), celeritas::RuntimeError);
+}
@@ -12,7 +12,8 @@
 #include "base/ArrayIO.hh"
 
 using celeritas::Array;
-using Real3 = Array<double, 3>;
+using celeritas::Real3;
+using celeritas::real_type;
 
 enum
 {
@@ -72,43 +73,43 @@ TEST(ArrayUtilsTest, rotate)
     celeritas::normalize_direction(&vec);
 
     // transform through some directions
-    double costheta = std::cos(2.0 / 3.0);
-    double sintheta = std::sqrt(1.0 - costheta * costheta);
-    double phi      = 2 * celeritas::constants::pi / 3.0;
+    real_type costheta = std::cos(real_type(2) / 3);
+    real_type sintheta = std::sqrt(1 - costheta * costheta);
+    real_type phi      = 2 * celeritas::constants::pi / 3;
 
-    double a = 1.0 / sqrt(1.0 - vec[Z] * vec[Z]);
+    real_type a = 1 / std::sqrt(1 - vec[Z] * vec[Z]);
     Real3  expected
-        = {vec[X] * costheta + vec[Z] * vec[X] * sintheta * cos(phi) * a
-               - vec[Y] * sintheta * sin(phi) * a,
-           vec[Y] * costheta + vec[Z] * vec[Y] * sintheta * cos(phi) * a
-               + vec[X] * sintheta * sin(phi) * a,
-           vec[Z] * costheta - sintheta * cos(phi) / a};
+        = {vec[X] * costheta + vec[Z] * vec[X] * sintheta * std::cos(phi) * a
+               - vec[Y] * sintheta * std::sin(phi) * a,
+           vec[Y] * costheta + vec[Z] * vec[Y] * sintheta * std::cos(phi) * a
+               + vec[X] * sintheta * std::sin(phi) * a,
+           vec[Z] * costheta - sintheta * std::cos(phi) / a};
 
     auto scatter = celeritas::from_spherical(costheta, phi);
     EXPECT_VEC_SOFT_EQ(expected, celeritas::rotate(scatter, vec));
 
     // Transform degenerate vector along y
-    expected = {-sintheta * cos(phi), sintheta * sin(phi), -costheta};
+    expected = {-sintheta * std::cos(phi), sintheta * std::sin(phi), -costheta};
     EXPECT_VEC_SOFT_EQ(expected, celeritas::rotate(scatter, {0.0, 0.0, -1.0}));
 
-    expected = {sintheta * cos(phi), sintheta * sin(phi), costheta};
+    expected = {sintheta * std::cos(phi), sintheta * std::sin(phi), costheta};
     EXPECT_VEC_SOFT_EQ(expected, celeritas::rotate(scatter, {0.0, 0.0, 1.0}));
 
     // Transform almost degenerate vector
     vec = {3e-8, 4e-8, 1};
     celeritas::normalize_direction(&vec);
     EXPECT_VEC_SOFT_EQ(
-        (Real3{-0.613930085414816, 0.0739664834328671, 0.785887275346237}),
+        (Real3{-0.613930084057561, 0.0739664852425396, 0.785887276236192}),
         celeritas::rotate(scatter, vec));
 
     // Switch scattered z direction
     costheta *= -1;
     scatter = celeritas::from_spherical(costheta, phi);
 
-    expected = {-sintheta * cos(phi), sintheta * sin(phi), -costheta};
+    expected = {-sintheta * std::cos(phi), sintheta * std::sin(phi), -costheta};
     EXPECT_VEC_SOFT_EQ(expected, celeritas::rotate(scatter, {0.0, 0.0, -1.0}));
 
-    expected = {sintheta * cos(phi), sintheta * sin(phi), costheta};
+    expected = {sintheta * std::cos(phi), sintheta * std::sin(phi), costheta};
     vec      = celeritas::rotate(scatter, {0.0, 0.0, 1.0});
     EXPECT_VEC_SOFT_EQ(expected, vec);
 }
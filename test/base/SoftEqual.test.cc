@@ -20,14 +20,22 @@ TEST(SoftEqual, default_precisions)
 {
     using Comp_t = SoftEqual<>;
 
-    EXPECT_DOUBLE_EQ(1e-12, Comp_t().rel());
-    EXPECT_DOUBLE_EQ(1e-14, Comp_t().abs());
-
-    EXPECT_DOUBLE_EQ(1e-6, Comp_t(1e-6).rel());
-    EXPECT_DOUBLE_EQ(1e-8, Comp_t(1e-6).abs());
-
-    EXPECT_DOUBLE_EQ(1e-4, Comp_t(1e-4, 1e-9).rel());
-    EXPECT_DOUBLE_EQ(1e-9, Comp_t(1e-4, 1e-9).abs());
+#if CELERITAS_SINGLE_PRECISION
+    EXPECT_REAL_EQ(1e-6, Comp_t().rel());
+    EXPECT_REAL_EQ(1e-8, Comp_t().abs());
+
+    EXPECT_REAL_EQ(1e-3, Comp_t(1e-3).rel());
+    EXPECT_REAL_EQ(1e-5, Comp_t(1e-3).abs());
+#else
+    EXPECT_REAL_EQ(1e-12, Comp_t().rel());
+    EXPECT_REAL_EQ(1e-14, Comp_t().abs());
+
+    EXPECT_REAL_EQ(1e-6, Comp_t(1e-6).rel());
+    EXPECT_REAL_EQ(1e-8, Comp_t(1e-6).abs());
+#endif
+
+    EXPECT_REAL_EQ(1e-4, Comp_t(1e-4, 1e-9).rel());
+    EXPECT_REAL_EQ(1e-9, Comp_t(1e-4, 1e-9).abs());
 }
 
 //---------------------------------------------------------------------------//
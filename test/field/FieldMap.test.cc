@@ -0,0 +1,106 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file FieldMap.test.cc
+//---------------------------------------------------------------------------//
+#include "field/FieldMapParams.hh"
+#include "field/FieldMapView.hh"
+
+#include "base/Range.hh"
+#include "base/Units.hh"
+#include "celeritas_test.hh"
+
+using namespace celeritas;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class FieldMapTest : public celeritas::Test
+{
+  protected:
+    void SetUp() override
+    {
+        input.dims  = {3, 4, 5};
+        input.lower = {-10, -20, -30};
+        input.upper = {10, 40, 50};
+        for (auto i : range(input.dims[0]))
+        {
+            for (auto j : range(input.dims[1]))
+            {
+                for (auto k : range(input.dims[2]))
+                {
+                    Real3 pos = {-10 + 10 * real_type(i),
+                                 -20 + 20 * real_type(j),
+                                 -30 + 20 * real_type(k)};
+                    input.values.push_back(this->linear_field(pos));
+                }
+            }
+        }
+    }
+
+    //! A field that trilinear interpolation reproduces exactly
+    static Real3 linear_field(const Real3& pos)
+    {
+        return {units::tesla * (1 + pos[0] / 10),
+                units::tesla * (pos[1] / 20 - pos[2] / 40),
+                units::tesla * 2};
+    }
+
+    FieldMapParams::Input input;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(FieldMapTest, interpolate)
+{
+    FieldMapParams params(input);
+    FieldMapView   field(params.host_pointers());
+
+    // Grid points, interior points, and the upper faces of the grid
+    const Real3 points[] = {{-10, -20, -30},
+                            {0, 0, 10},
+                            {1.5, 2.5, -3.5},
+                            {-9.9, 33.3, 49.9},
+                            {10, 40, 50},
+                            {10, 0, 0}};
+    for (const Real3& pos : points)
+    {
+        Real3 expected = this->linear_field(pos);
+        Real3 actual   = field(pos);
+        for (int ax = 0; ax < 3; ++ax)
+        {
+            EXPECT_NEAR(expected[ax], actual[ax], 1e-4 * units::tesla)
+                << "at " << pos[0] << ", " << pos[1] << ", " << pos[2];
+        }
+    }
+
+    // The field is zero outside the grid
+    const Real3 zero = {0, 0, 0};
+    EXPECT_VEC_EQ(zero, field({-10.1, 0, 0}));
+    EXPECT_VEC_EQ(zero, field({0, 40.1, 0}));
+    EXPECT_VEC_EQ(zero, field({0, 0, 51}));
+}
+
+TEST_F(FieldMapTest, errors)
+{
+    {
+        auto bad_dims    = input;
+        bad_dims.dims[1] = 1;
+        EXPECT_THROW(FieldMapParams{bad_dims}, RuntimeError);
+    }
+    {
+        auto bad_extents     = input;
+        bad_extents.upper[2] = bad_extents.lower[2];
+        EXPECT_THROW(FieldMapParams{bad_extents}, RuntimeError);
+    }
+    {
+        auto bad_values = input;
+        bad_values.values.pop_back();
+        EXPECT_THROW(FieldMapParams{bad_values}, RuntimeError);
+    }
+}
@@ -0,0 +1,373 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file FieldPropagator.test.cc
+//---------------------------------------------------------------------------//
+#include "field/FieldPropagator.hh"
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <type_traits>
+#include "base/CollectionStateStore.hh"
+#include "base/Constants.hh"
+#include "base/Range.hh"
+#include "base/Stopwatch.hh"
+#include "base/Units.hh"
+#include "field/FieldMapParams.hh"
+#include "field/FieldMapView.hh"
+#include "field/HelixStepper.hh"
+#include "field/MagFieldEquation.hh"
+#include "field/RungeKuttaStepper.hh"
+#include "field/UniformField.hh"
+#include "geometry/BoxGeoParams.hh"
+#include "geometry/BoxGeoTrackView.hh"
+#include "random/distributions/IsotropicDistribution.hh"
+#include "celeritas_test.hh"
+
+using namespace celeritas;
+using units::ElementaryCharge;
+using units::MevMomentum;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class FieldPropagatorTest : public celeritas::Test
+{
+  protected:
+    using Input      = BoxGeoParams::Input;
+    using StateStore = CollectionStateStore<BoxGeoStateData, MemSpace::host>;
+    using RkStepper  = RungeKuttaStepper<MagFieldEquation<UniformField>>;
+
+    void SetUp() override
+    {
+        field_strength = 1 * units::tesla;
+        charge         = ElementaryCharge{-1};
+        momentum       = MevMomentum{10};
+
+        // Radius [cm] = p [GeV/c] / (0.29979 * B [T]) * 100
+        radius = 100 * (momentum.value() / 1000)
+                 / (0.299792458 * field_strength / units::tesla);
+
+        // World with a detector slab that the helix starting at the origin
+        // along +x reaches
+        Input input;
+        input.volume_labels = {"world", "detector", "distant"};
+        input.boxes         = {
+            {VolumeId{0}, {-100, -100, -100}, {100, 100, 100}, {}},
+            {VolumeId{1}, {2, -10, -10}, {2.5, 10, 10}, BoxId{0}},
+            {VolumeId{2}, {50, -10, -10}, {60, 10, 10}, BoxId{0}},
+        };
+        geo_params = std::make_shared<BoxGeoParams>(input);
+        geo_states = StateStore(*geo_params, 1);
+    }
+
+    BoxGeoTrackView make_geo_track_view()
+    {
+        return {geo_params->host_pointers(), geo_states.ref(), ThreadId{0}};
+    }
+
+    //! Field along +z
+    UniformField uniform_field() const
+    {
+        return UniformField{{0, 0, field_strength}};
+    }
+
+    /*!
+     * Analytic position and direction on the helix from the origin.
+     *
+     * The initial direction is (sin theta, 0, cos theta) and the field is
+     * along +z. A positive charge curves toward -y.
+     */
+    OdeState analytic_helix(real_type cos_theta, real_type path) const
+    {
+        const real_type sin_theta = std::sqrt(1 - cos_theta * cos_theta);
+        const real_type k        = (charge.value() > 0 ? 1 : -1) / radius;
+        const real_type angle    = k * path;
+        const real_type half_sin = std::sin(angle / 2);
+
+        OdeState result;
+        result.pos = {sin_theta * std::sin(angle) / k,
+                      -2 * sin_theta * half_sin * half_sin / k,
+                      cos_theta * path};
+        result.mom = {momentum.value() * sin_theta * std::cos(angle),
+                      -momentum.value() * sin_theta * std::sin(angle),
+                      momentum.value() * cos_theta};
+        return result;
+    }
+
+    real_type        field_strength;
+    ElementaryCharge charge;
+    MevMomentum      momentum;
+    real_type        radius;
+    FieldOptions     options;
+
+    std::shared_ptr<const BoxGeoParams> geo_params;
+    StateStore                          geo_states;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(FieldPropagatorTest, helix_stepper)
+{
+    UniformField field = this->uniform_field();
+    HelixStepper stepper(field, charge);
+
+    const real_type cos_theta = 0.6;
+    OdeState        beg       = this->analytic_helix(cos_theta, 0);
+    for (real_type path : {0.01, 1.0, 10.0, 123.4})
+    {
+        StepperResult result   = stepper(path, beg);
+        OdeState      expected = this->analytic_helix(cos_theta, path);
+        EXPECT_VEC_NEAR(expected.pos, result.end_state.pos, 1e-4);
+        EXPECT_VEC_NEAR(expected.mom, result.end_state.mom, 1e-4);
+
+        OdeState expected_mid = this->analytic_helix(cos_theta, path / 2);
+        EXPECT_VEC_NEAR(expected_mid.pos, result.mid_state.pos, 1e-4);
+    }
+
+    // No field: straight line
+    UniformField no_field{{0, 0, 0}};
+    HelixStepper straight(no_field, charge);
+    StepperResult result = straight(2.0, beg);
+    EXPECT_VEC_SOFT_EQ(Real3({1.6, 0, 1.2}), result.end_state.pos);
+    EXPECT_VEC_SOFT_EQ(beg.mom, result.end_state.mom);
+}
+
+TEST_F(FieldPropagatorTest, rk_stepper)
+{
+    UniformField                   field = this->uniform_field();
+    MagFieldEquation<UniformField> equation(field, charge);
+    RkStepper                      stepper(equation);
+
+    const real_type cos_theta = 0.6;
+    OdeState        beg       = this->analytic_helix(cos_theta, 0);
+
+    real_type prev_error = 1;
+    for (real_type path : {1.0, 0.5, 0.25})
+    {
+        StepperResult result   = stepper(path, beg);
+        OdeState      expected = this->analytic_helix(cos_theta, path);
+        EXPECT_VEC_NEAR(expected.pos, result.end_state.pos, 1e-4);
+        EXPECT_VEC_NEAR(expected.mom, result.end_state.mom, 1e-3);
+
+        // Error estimate is fourth order in the step length
+        real_type error = norm(result.err_state.pos);
+        EXPECT_LT(error, prev_error / 16);
+        prev_error = error;
+    }
+}
+
+TEST_F(FieldPropagatorTest, helix_accuracy)
+{
+    UniformField field = this->uniform_field();
+    HelixStepper stepper(field, charge);
+    auto         geo = this->make_geo_track_view();
+
+    // Start away from the boxes and propagate one full turn
+    const real_type cos_theta = 0.6;
+    const real_type path      = 2 * constants::pi * radius;
+    geo                       = {{-50, -50, -50}, {0.8, 0, cos_theta}};
+
+    FieldPropagator<HelixStepper, BoxGeoTrackView> propagate(
+        options, stepper, momentum, &geo);
+    auto result = propagate(path);
+    EXPECT_FALSE(result.boundary);
+    EXPECT_SOFT_EQ(path, result.distance);
+
+    OdeState expected = this->analytic_helix(cos_theta, path);
+    EXPECT_SOFT_NEAR(-50 + expected.pos[0], geo.pos()[0], 1e-6);
+    EXPECT_SOFT_NEAR(-50 + expected.pos[1], geo.pos()[1], 1e-6);
+    EXPECT_SOFT_NEAR(-50 + expected.pos[2], geo.pos()[2], 1e-6);
+    EXPECT_VEC_NEAR(Real3({0.8, 0, cos_theta}), geo.dir(), 1e-6);
+    EXPECT_EQ(VolumeId{0}, geo.volume_id());
+
+    // Number of chords with the maximum sagitta: h^2 = 8 rho delta, where
+    // the helix's radius of curvature is rho = R / sin(theta)
+    const real_type max_chord
+        = std::sqrt(8 * (radius / 0.8) * options.delta_chord);
+    const real_type min_substeps = path / max_chord;
+    EXPECT_LE(min_substeps, result.num_substeps);
+    EXPECT_GE(2 * min_substeps, result.num_substeps);
+
+    // A tighter tolerance needs more chords in proportion to its square root
+    FieldOptions tight_options = options;
+    tight_options.delta_chord  = options.delta_chord / 16;
+    tight_options.max_substeps = 1000;
+    geo                        = {{-50, -50, -50}, {0.8, 0, cos_theta}};
+    FieldPropagator<HelixStepper, BoxGeoTrackView> propagate_tight(
+        tight_options, stepper, momentum, &geo);
+    auto tight_result = propagate_tight(path);
+    EXPECT_SOFT_EQ(path, tight_result.distance);
+    EXPECT_LE(3 * result.num_substeps, tight_result.num_substeps);
+    EXPECT_GE(5 * result.num_substeps, tight_result.num_substeps);
+}
+
+TEST_F(FieldPropagatorTest, rk_accuracy)
+{
+    UniformField                   field = this->uniform_field();
+    MagFieldEquation<UniformField> equation(field, charge);
+    RkStepper                      stepper(equation);
+    HelixStepper                   helix(field, charge);
+    auto                           geo = this->make_geo_track_view();
+
+    const real_type cos_theta = 0.6;
+    const real_type path      = 2 * constants::pi * radius;
+    geo                       = {{-50, -50, -50}, {0.8, 0, cos_theta}};
+
+    FieldPropagator<RkStepper, BoxGeoTrackView> propagate(
+        options, stepper, momentum, &geo);
+    auto result = propagate(path);
+    EXPECT_FALSE(result.boundary);
+    EXPECT_SOFT_EQ(path, result.distance);
+
+    OdeState expected = this->analytic_helix(cos_theta, path);
+    EXPECT_SOFT_NEAR(-50 + expected.pos[0], geo.pos()[0], 1e-4);
+    EXPECT_SOFT_NEAR(-50 + expected.pos[1], geo.pos()[1], 1e-4);
+    EXPECT_SOFT_NEAR(-50 + expected.pos[2], geo.pos()[2], 1e-4);
+    EXPECT_VEC_NEAR(Real3({0.8, 0, cos_theta}), geo.dir(), 1e-3);
+
+    // The integrator takes at least as many substeps as the exact helix
+    geo = {{-50, -50, -50}, {0.8, 0, cos_theta}};
+    FieldPropagator<HelixStepper, BoxGeoTrackView> propagate_helix(
+        options, helix, momentum, &geo);
+    auto helix_result = propagate_helix(path);
+    EXPECT_LE(helix_result.num_substeps, result.num_substeps);
+    EXPECT_GE(3 * helix_result.num_substeps, result.num_substeps);
+}
+
+TEST_F(FieldPropagatorTest, field_map)
+{
+    // Uniform field on a grid that covers part of the world
+    FieldMapParams::Input input;
+    input.dims  = {2, 2, 2};
+    input.lower = {-20, -20, -20};
+    input.upper = {20, 20, 20};
+    input.values.assign(8, Real3{0, 0, field_strength});
+    FieldMapParams params(input);
+
+    FieldMapView                   field(params.host_pointers());
+    MagFieldEquation<FieldMapView> equation(field, charge);
+    RungeKuttaStepper<MagFieldEquation<FieldMapView>> stepper(equation);
+    auto geo = this->make_geo_track_view();
+
+    // Half a turn inside the grid
+    const real_type path = constants::pi * radius;
+    geo                  = {{-10, 0, 0}, {1, 0, 0}};
+    FieldPropagator<decltype(stepper), BoxGeoTrackView> propagate(
+        options, stepper, momentum, &geo);
+    auto result = propagate(path);
+    EXPECT_FALSE(result.boundary);
+    EXPECT_SOFT_EQ(path, result.distance);
+    EXPECT_SOFT_NEAR(-10, geo.pos()[0], 1e-4);
+    EXPECT_SOFT_NEAR(2 * radius, geo.pos()[1], 1e-4);
+    EXPECT_VEC_NEAR(Real3({-1, 0, 0}), geo.dir(), 1e-3);
+
+    // Outside the grid the track moves in a straight line
+    geo    = {{30, 30, 0}, {0, 1, 0}};
+    result = propagate(10);
+    EXPECT_SOFT_EQ(10, result.distance);
+    EXPECT_VEC_SOFT_EQ(Real3({30, 40, 0}), geo.pos());
+    EXPECT_VEC_SOFT_EQ(Real3({0, 1, 0}), geo.dir());
+    EXPECT_EQ(1, result.num_substeps);
+}
+
+TEST_F(FieldPropagatorTest, boundary)
+{
+    UniformField field = this->uniform_field();
+    HelixStepper stepper(field, charge);
+    auto         geo = this->make_geo_track_view();
+
+    // Start at the origin along +x: the helix reaches x = 2 at an angle of
+    // asin(2 / R)
+    geo = {{0, 0, 0}, {1, 0, 0}};
+    FieldPropagator<HelixStepper, BoxGeoTrackView> propagate(
+        options, stepper, momentum, &geo);
+
+    auto result = propagate(100);
+    EXPECT_TRUE(result.boundary);
+    const real_type expected_dist = radius * std::asin(2 / radius);
+    EXPECT_SOFT_NEAR(expected_dist, result.distance, 1e-3);
+    EXPECT_SOFT_NEAR(2, geo.pos()[0], 1e-6);
+    EXPECT_NEAR(radius - std::sqrt(radius * radius - 4),
+                geo.pos()[1],
+                options.delta_intersection);
+    EXPECT_EQ(VolumeId{1}, geo.volume_id());
+
+    // The direction is tangent to the helix at the boundary
+    OdeState expected = this->analytic_helix(0, result.distance);
+    EXPECT_VEC_NEAR(expected.mom, Real3({momentum.value() * geo.dir()[0],
+                                         momentum.value() * geo.dir()[1],
+                                         momentum.value() * geo.dir()[2]}),
+                    1e-3);
+
+    // The turning point is at x = R, past the back of the detector
+    result = propagate(100);
+    EXPECT_TRUE(result.boundary);
+    EXPECT_SOFT_NEAR(2.5, geo.pos()[0], 1e-6);
+    EXPECT_EQ(VolumeId{0}, geo.volume_id());
+
+    // Short steps within the volume
+    geo    = {{0, 0, 0}, {1, 0, 0}};
+    result = propagate(0.5);
+    EXPECT_FALSE(result.boundary);
+    EXPECT_SOFT_EQ(0.5, result.distance);
+    EXPECT_EQ(VolumeId{0}, geo.volume_id());
+
+    // A high-momentum track is nearly straight
+    geo = {{0, 0, 0}, {0, 1, 0}};
+    FieldPropagator<HelixStepper, BoxGeoTrackView> propagate_fast(
+        options, stepper, MevMomentum{1e4}, &geo);
+    result = propagate_fast(30);
+    EXPECT_FALSE(result.boundary);
+    EXPECT_SOFT_EQ(30, result.distance);
+    EXPECT_EQ(VolumeId{0}, geo.volume_id());
+}
+
+TEST_F(FieldPropagatorTest, stepper_substeps)
+{
+    UniformField                   field = this->uniform_field();
+    MagFieldEquation<UniformField> equation(field, charge);
+    RkStepper                      rk_stepper(equation);
+    HelixStepper                   helix_stepper(field, charge);
+    auto                           geo = this->make_geo_track_view();
+
+    const size_type num_tracks = 1000;
+    const real_type step       = 10;
+
+    // Propagate tracks from random directions with a given stepper, timing
+    // the propagation and reporting the substep rate
+    auto run = [&](const char* label, const auto& stepper) {
+        using Stepper_t = std::decay_t<decltype(stepper)>;
+        std::mt19937                     rng;
+        IsotropicDistribution<real_type> sample_dir;
+        size_type                        num_substeps  = 0;
+        size_type                        num_crossings = 0;
+        Stopwatch                        get_time;
+        for (CELER_MAYBE_UNUSED auto i : range(num_tracks))
+        {
+            geo = {{-30, -30, -30}, sample_dir(rng)};
+            FieldPropagator<Stepper_t, BoxGeoTrackView> propagate(
+                options, stepper, momentum, &geo);
+            auto result = propagate(step);
+            num_substeps += result.num_substeps;
+            num_crossings += result.boundary;
+        }
+        double time = get_time();
+        cout << label << ": " << num_substeps << " substeps in " << time
+             << " s (" << num_substeps / time << " substeps/s)"
+             << std::endl;
+        EXPECT_EQ(0, num_crossings);
+        return num_substeps;
+    };
+
+    // The exact helix needs no more substeps than Runge-Kutta
+    size_type num_helix = run("Helix", helix_stepper);
+    size_type num_rk    = run("RK4", rk_stepper);
+    EXPECT_LE(num_helix, num_rk);
+}
@@ -0,0 +1,375 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BoxGeoTrackView.test.cc
+//---------------------------------------------------------------------------//
+#include "geometry/BoxGeoTrackView.hh"
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include "base/CollectionStateStore.hh"
+#include "base/Range.hh"
+#include "geometry/BoxGeoParams.hh"
+#include "random/distributions/IsotropicDistribution.hh"
+#include "random/distributions/UniformRealDistribution.hh"
+#include "celeritas_test.hh"
+
+using namespace celeritas;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class BoxGeoTest : public celeritas::Test
+{
+  protected:
+    using Input      = BoxGeoParams::Input;
+    using BoxInput   = BoxGeoParams::BoxInput;
+    using StateStore = CollectionStateStore<BoxGeoStateData, MemSpace::host>;
+
+    void SetUp() override
+    {
+        input  = this->build_input();
+        params = std::make_shared<BoxGeoParams>(input);
+        states = StateStore(*params, 1);
+    }
+
+    virtual Input build_input() const = 0;
+
+    BoxGeoTrackView make_geo_track_view()
+    {
+        return {params->host_pointers(), states.ref(), ThreadId{0}};
+    }
+
+    Input                               input;
+    std::shared_ptr<const BoxGeoParams> params;
+    StateStore                          states;
+};
+
+//---------------------------------------------------------------------------//
+//! Equivalent to twoBoxes.gdml
+class TwoBoxesTest : public BoxGeoTest
+{
+  protected:
+    Input build_input() const override
+    {
+        Input result;
+        result.volume_labels = {"World", "Detector"};
+        result.boxes         = {
+            {VolumeId{0}, {-50, -50, -50}, {50, 50, 50}, {}},
+            {VolumeId{1}, {-5, -5, -5}, {5, 5, 5}, BoxId{0}},
+        };
+        return result;
+    }
+};
+
+//---------------------------------------------------------------------------//
+//! Equivalent to slabsGeometry.gdml
+class SlabsTest : public BoxGeoTest
+{
+  protected:
+    Input build_input() const override
+    {
+        Input result;
+        result.volume_labels = {"World", "box0", "box1", "box2", "box3"};
+        result.boxes.push_back(
+            {VolumeId{0}, {-500, -500, -500}, {500, 500, 500}, {}});
+        for (auto i : range(4))
+        {
+            const real_type z = 6 * i;
+            result.boxes.push_back({VolumeId(i + 1),
+                                    {-10, -10, z - 2},
+                                    {10, 10, z + 2},
+                                    BoxId{0}});
+        }
+        return result;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * A grid of cells that each contain a smaller box.
+ *
+ * Every cell shares a volume ID, as does every inner box.
+ */
+class GridTest : public BoxGeoTest
+{
+  protected:
+    static constexpr int num_cells = 10;
+
+    Input build_input() const override
+    {
+        Input result;
+        result.volume_labels = {"world", "cell", "inner"};
+        result.boxes.push_back(
+            {VolumeId{0}, {-100, -100, -100}, {100, 100, 100}, {}});
+        for (auto i : range(num_cells))
+        {
+            for (auto j : range(num_cells))
+            {
+                for (auto k : range(num_cells))
+                {
+                    Real3 center = {real_type(-90 + 20 * i),
+                                    real_type(-90 + 20 * j),
+                                    real_type(-90 + 20 * k)};
+                    BoxId cell_id(result.boxes.size());
+                    result.boxes.push_back(
+                        {VolumeId{1},
+                         {center[0] - 8, center[1] - 8, center[2] - 8},
+                         {center[0] + 8, center[1] + 8, center[2] + 8},
+                         BoxId{0}});
+                    result.boxes.push_back(
+                        {VolumeId{2},
+                         {center[0] - 2, center[1] - 3, center[2] - 4},
+                         {center[0] + 2, center[1] + 3, center[2] + 4},
+                         cell_id});
+                }
+            }
+        }
+        return result;
+    }
+
+    //! Distance to the nearest boundary of any box, by brute force
+    real_type calc_next_step(const Real3& pos, const Real3& dir) const
+    {
+        real_type result = std::numeric_limits<real_type>::infinity();
+        for (const BoxInput& box : input.boxes)
+        {
+            for (int ax = 0; ax < 3; ++ax)
+            {
+                for (real_type plane : {box.lower[ax], box.upper[ax]})
+                {
+                    real_type dist = (plane - pos[ax]) / dir[ax];
+                    if (!(dist > 1e-3) || !(dist < result))
+                    {
+                        continue;
+                    }
+                    bool on_face = true;
+                    for (int other = 0; other < 3; ++other)
+                    {
+                        real_type x = pos[other] + dist * dir[other];
+                        if (other != ax
+                            && (x < box.lower[other] || x > box.upper[other]))
+                        {
+                            on_face = false;
+                        }
+                    }
+                    if (on_face)
+                    {
+                        result = dist;
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+    //! Volume of the innermost box containing a point, by brute force
+    VolumeId calc_volume(const Real3& pos) const
+    {
+        VolumeId result;
+        for (const BoxInput& box : input.boxes)
+        {
+            bool inside = true;
+            for (int ax = 0; ax < 3; ++ax)
+            {
+                inside = inside && box.lower[ax] < pos[ax]
+                         && pos[ax] < box.upper[ax];
+            }
+            if (inside && (!result || result < box.volume))
+            {
+                // Volume IDs increase with depth
+                result = box.volume;
+            }
+        }
+        return result;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(TwoBoxesTest, accessors)
+{
+    EXPECT_EQ(2, params->num_volumes());
+    EXPECT_EQ(2, params->num_boxes());
+    EXPECT_EQ(2, params->max_depth());
+    EXPECT_EQ("Detector", params->id_to_label(VolumeId{1}));
+    EXPECT_EQ(VolumeId{0}, params->label_to_id("World"));
+    EXPECT_EQ(VolumeId{}, params->label_to_id("nonexistent"));
+}
+
+TEST_F(TwoBoxesTest, track_line)
+{
+    BoxGeoTrackView geo = this->make_geo_track_view();
+
+    {
+        // Track from outside detector, moving right
+        geo = {{-10, 0, 0}, {1, 0, 0}};
+        EXPECT_EQ(VolumeId{0}, geo.volume_id());
+
+        geo.find_next_step();
+        EXPECT_SOFT_EQ(5, geo.next_step());
+        geo.move_next_step();
+        EXPECT_SOFT_EQ(-5, geo.pos()[0]);
+        EXPECT_EQ(VolumeId{1}, geo.volume_id());
+
+        geo.find_next_step();
+        EXPECT_SOFT_EQ(10, geo.next_step());
+        geo.move_next_step();
+        EXPECT_EQ(VolumeId{0}, geo.volume_id());
+
+        geo.find_next_step();
+        EXPECT_SOFT_EQ(45, geo.next_step());
+        geo.move_next_step();
+        EXPECT_TRUE(geo.is_outside());
+    }
+    {
+        // Track from the outside edge fails
+        geo = {{50, 0, 0}, {-1, 0, 0}};
+        EXPECT_TRUE(geo.is_outside());
+    }
+    {
+        // Track passing beside the detector
+        geo = {{-10, 6, 0}, {1, 0, 0}};
+        geo.find_next_step();
+        EXPECT_SOFT_EQ(60, geo.next_step());
+    }
+    {
+        // Track from inside the detector, moving diagonally
+        const real_type inv_sqrt_two = 1 / std::sqrt(real_type(2));
+        geo = {{0, 0, 1}, {inv_sqrt_two, inv_sqrt_two, 0}};
+        EXPECT_EQ(VolumeId{1}, geo.volume_id());
+        geo.find_next_step();
+        EXPECT_SOFT_EQ(5 * std::sqrt(real_type(2)), geo.next_step());
+        EXPECT_SOFT_EQ(0, geo.safety());
+        EXPECT_SOFT_EQ(4, geo.find_safety());
+        geo.move_next_step();
+        EXPECT_EQ(VolumeId{0}, geo.volume_id());
+    }
+}
+
+TEST_F(TwoBoxesTest, safety)
+{
+    BoxGeoTrackView geo = this->make_geo_track_view();
+
+    geo = {{-8, 1, 0}, {0, 0, 1}};
+    EXPECT_SOFT_EQ(3, geo.find_safety());
+    geo = {{-8, 8, 0}, {0, 0, 1}};
+    EXPECT_SOFT_EQ(3 * std::sqrt(real_type(2)), geo.find_safety());
+    geo = {{-48, 8, 0}, {0, 0, 1}};
+    EXPECT_SOFT_EQ(2, geo.find_safety());
+
+    // Propagate within and past the safety sphere
+    geo = {{-8, 1, 0}, {1, 0, 0}};
+    auto result = geo.propagate(1);
+    EXPECT_FALSE(result.safety_hit);
+    EXPECT_FALSE(result.boundary);
+    EXPECT_SOFT_EQ(2, geo.safety());
+    result = geo.propagate(1.5);
+    EXPECT_TRUE(result.safety_hit);
+    EXPECT_SOFT_EQ(0.5, geo.safety());
+    result = geo.propagate(1);
+    EXPECT_FALSE(result.safety_hit);
+    EXPECT_TRUE(result.boundary);
+    EXPECT_SOFT_EQ(0.5, result.distance);
+    EXPECT_EQ(VolumeId{1}, geo.volume_id());
+
+    // Copy the state with a new direction
+    geo = BoxGeoTrackView::DetailedInitializer{geo, {-1, 0, 0}};
+    EXPECT_EQ(VolumeId{1}, geo.volume_id());
+    result = geo.propagate(20);
+    EXPECT_TRUE(result.boundary);
+    EXPECT_SOFT_NEAR(0, result.distance, 1e-6);
+    EXPECT_EQ(VolumeId{0}, geo.volume_id());
+}
+
+TEST_F(SlabsTest, track_line)
+{
+    BoxGeoTrackView geo = this->make_geo_track_view();
+    geo = {{1, 2, -10}, {0, 0, 1}};
+
+    std::vector<int>    volumes;
+    std::vector<double> steps;
+    while (!geo.is_outside())
+    {
+        volumes.push_back(geo.volume_id().get());
+        geo.find_next_step();
+        steps.push_back(geo.next_step());
+        geo.move_next_step();
+    }
+
+    const int    expected_volumes[] = {0, 1, 0, 2, 0, 3, 0, 4, 0};
+    const double expected_steps[]   = {8, 4, 2, 4, 2, 4, 2, 4, 480};
+    EXPECT_VEC_EQ(expected_volumes, volumes);
+    EXPECT_VEC_SOFT_EQ(expected_steps, steps);
+}
+
+TEST_F(SlabsTest, move_and_relocate)
+{
+    BoxGeoTrackView geo = this->make_geo_track_view();
+    geo = {{1, 2, -10}, {0, 0, 1}};
+    EXPECT_EQ(VolumeId{0}, geo.volume_id());
+
+    geo.move_and_relocate(11);
+    EXPECT_EQ(VolumeId{1}, geo.volume_id());
+    geo.move_and_relocate(12);
+    EXPECT_EQ(VolumeId{3}, geo.volume_id());
+    geo.move_and_relocate(3);
+    EXPECT_EQ(VolumeId{0}, geo.volume_id());
+    geo.move_and_relocate(1000);
+    EXPECT_TRUE(geo.is_outside());
+}
+
+TEST_F(SlabsTest, errors)
+{
+    // Overlapping siblings
+    Input inp = this->build_input();
+    inp.boxes.push_back({VolumeId{1}, {-1, -1, 3}, {1, 1, 5}, BoxId{0}});
+    EXPECT_THROW(BoxGeoParams{inp}, celeritas::RuntimeError);
+
+    // Daughter outside its parent
+    inp = this->build_input();
+    inp.boxes.push_back({VolumeId{1}, {-1, -1, 1}, {1, 1, 3}, BoxId{1}});
+    EXPECT_THROW(BoxGeoParams{inp}, celeritas::RuntimeError);
+}
+
+TEST_F(GridTest, accessors)
+{
+    EXPECT_EQ(3, params->num_volumes());
+    EXPECT_EQ(1 + 2 * 1000, params->num_boxes());
+    EXPECT_EQ(3, params->max_depth());
+}
+
+TEST_F(GridTest, random_rays)
+{
+    BoxGeoTrackView                    geo = this->make_geo_track_view();
+    std::mt19937                       rng;
+    UniformRealDistribution<real_type> sample_coord(-99, 99);
+    IsotropicDistribution<real_type>   sample_dir;
+    size_type                          num_crossings = 0;
+    for (CELER_MAYBE_UNUSED auto i : range(100))
+    {
+        Real3 pos = {sample_coord(rng), sample_coord(rng), sample_coord(rng)};
+        geo       = {pos, sample_dir(rng)};
+        ASSERT_EQ(this->calc_volume(pos), geo.volume_id());
+        while (!geo.is_outside())
+        {
+            geo.find_next_step();
+            EXPECT_SOFT_EQ(this->calc_next_step(geo.pos(), geo.dir()),
+                           geo.next_step());
+            geo.move_next_step();
+            ++num_crossings;
+
+            Real3 bumped = geo.pos();
+            axpy(real_type(1e-3), geo.dir(), &bumped);
+            ASSERT_EQ(this->calc_volume(bumped),
+                      geo.is_outside() ? VolumeId{} : geo.volume_id());
+        }
+    }
+    EXPECT_GT(num_crossings, 500);
+}
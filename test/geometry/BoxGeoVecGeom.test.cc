@@ -0,0 +1,214 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BoxGeoVecGeom.test.cc
+//---------------------------------------------------------------------------//
+#include <memory>
+#include <random>
+#include <string>
+#include <VecGeom/management/GeoManager.h>
+#include <VecGeom/navigation/NavigationState.h>
+#include <VecGeom/volumes/PlacedVolume.h>
+#include <VecGeom/volumes/UnplacedBox.h>
+#include "base/CollectionStateStore.hh"
+#include "base/Range.hh"
+#include "geometry/BoxGeoParams.hh"
+#include "geometry/BoxGeoTrackView.hh"
+#include "geometry/GeoParams.hh"
+#include "geometry/GeoTrackView.hh"
+#include "random/distributions/IsotropicDistribution.hh"
+#include "random/distributions/UniformRealDistribution.hh"
+#include "celeritas_test.hh"
+
+using namespace celeritas;
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+namespace
+{
+/*!
+ * Add a VecGeom box placement and its daughters.
+ */
+void add_box(const vecgeom::VPlacedVolume&        placed,
+             const Real3&                         offset,
+             BoxId                                parent,
+             std::vector<BoxGeoParams::BoxInput>* boxes)
+{
+    const vecgeom::Transformation3D* trans = placed.GetTransformation();
+    CELER_VALIDATE(!trans->HasRotation(),
+                   "Placement '" << placed.GetLabel() << "' is rotated");
+    const auto* box
+        = dynamic_cast<const vecgeom::UnplacedBox*>(placed.GetUnplacedVolume());
+    CELER_VALIDATE(box, "Placement '" << placed.GetLabel() << "' is not a box");
+
+    // Translation is from the parent origin to the box center
+    const Real3 center = {offset[0] + trans->Translation(0),
+                          offset[1] + trans->Translation(1),
+                          offset[2] + trans->Translation(2)};
+    const Real3 half   = {box->x(), box->y(), box->z()};
+
+    BoxGeoParams::BoxInput inp;
+    inp.volume = VolumeId{placed.id()};
+    inp.parent = parent;
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        inp.lower[ax] = center[ax] - half[ax];
+        inp.upper[ax] = center[ax] + half[ax];
+    }
+    boxes->push_back(inp);
+
+    const BoxId box_id(boxes->size() - 1);
+    for (const vecgeom::VPlacedVolume* daughter :
+         placed.GetLogicalVolume()->GetDaughters())
+    {
+        add_box(*daughter, center, box_id, boxes);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert the loaded VecGeom geometry to a box geometry.
+ *
+ * The VecGeom placed volume IDs are preserved.
+ */
+BoxGeoParams::Input to_box_input(const GeoParams& geo)
+{
+    BoxGeoParams::Input result;
+    for (auto vol_id : range(VolumeId{geo.num_volumes()}))
+    {
+        result.volume_labels.push_back(geo.id_to_label(vol_id));
+    }
+    const vecgeom::VPlacedVolume* world
+        = vecgeom::GeoManager::Instance().GetWorld();
+    CELER_ASSERT(world);
+    add_box(*world, {0, 0, 0}, {}, &result.boxes);
+    return result;
+}
+} // namespace
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class BoxGeoVecGeomTest : public celeritas::Test
+{
+  protected:
+    using NavState   = vecgeom::cxx::NavigationState;
+    using StateStore = CollectionStateStore<BoxGeoStateData, MemSpace::host>;
+
+    void load(const char* filename)
+    {
+        std::string test_file
+            = celeritas::Test::test_data_path("geometry", filename);
+        vg_params  = std::make_shared<GeoParams>(test_file.c_str());
+        box_params = std::make_shared<BoxGeoParams>(to_box_input(*vg_params));
+
+        // Single-track VecGeom state
+        int max_depth = vg_params->max_depth();
+        state.reset(NavState::MakeInstance(max_depth));
+        next_state.reset(NavState::MakeInstance(max_depth));
+        vg_state.size       = 1;
+        vg_state.vgmaxdepth = max_depth;
+        vg_state.pos        = &this->pos;
+        vg_state.dir        = &this->dir;
+        vg_state.next_step  = &this->next_step;
+        vg_state.safety     = &this->safety;
+        vg_state.vgstate    = this->state.get();
+        vg_state.vgnext     = this->next_state.get();
+        vg_ref              = vg_params->host_pointers();
+
+        // Single-track box state
+        box_states = StateStore(*box_params, 1);
+    }
+
+    void TearDown() override
+    {
+        box_params.reset();
+        vg_params.reset();
+    }
+
+    //! Trace random rays from random points in a cube with both geometries
+    void compare_rays(real_type half_width, size_type num_rays)
+    {
+        GeoTrackView    vg(vg_ref, vg_state, ThreadId{0});
+        BoxGeoTrackView box(
+            box_params->host_pointers(), box_states.ref(), ThreadId{0});
+
+        using UniformDist = UniformRealDistribution<real_type>;
+
+        std::mt19937                     rng;
+        UniformDist                      sample_coord(-half_width, half_width);
+        IsotropicDistribution<real_type> sample_dir;
+        size_type                        num_steps = 0;
+        for (CELER_MAYBE_UNUSED auto i : range(num_rays))
+        {
+            Real3 pos
+                = {sample_coord(rng), sample_coord(rng), sample_coord(rng)};
+            Real3 dir = sample_dir(rng);
+            vg        = {pos, dir};
+            box       = {pos, dir};
+            while (!vg.is_outside())
+            {
+                ASSERT_FALSE(box.is_outside());
+                ASSERT_EQ(vg.volume_id(), box.volume_id())
+                    << "at " << vg.pos()[0] << ", " << vg.pos()[1] << ", "
+                    << vg.pos()[2];
+                vg.find_next_step();
+                box.find_next_step();
+                EXPECT_SOFT_NEAR(vg.next_step(), box.next_step(), 1e-8);
+                // VecGeom's safety may be an underestimate
+                real_type box_safety = box.find_safety();
+                EXPECT_LE(vg.find_safety(), box_safety + 1e-8);
+                EXPECT_LE(box_safety, box.next_step() + 1e-8);
+                vg.move_next_step();
+                box.move_next_step();
+                ++num_steps;
+            }
+            EXPECT_TRUE(box.is_outside());
+        }
+        EXPECT_GE(num_steps, num_rays);
+    }
+
+    std::shared_ptr<GeoParams>    vg_params;
+    std::shared_ptr<BoxGeoParams> box_params;
+
+    // VecGeom state data
+    Real3                     pos;
+    Real3                     dir;
+    real_type                 next_step;
+    real_type                 safety;
+    std::unique_ptr<NavState> state;
+    std::unique_ptr<NavState> next_state;
+    GeoStatePointers          vg_state;
+    GeoParamsPointers         vg_ref;
+
+    // Box state data
+    StateStore box_states;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(BoxGeoVecGeomTest, TwoBoxes)
+{
+    this->load("twoBoxes.gdml");
+    EXPECT_EQ(vg_params->num_volumes(), box_params->num_volumes());
+    EXPECT_EQ(vg_params->max_depth(), box_params->max_depth());
+
+    this->compare_rays(49, 1000);
+}
+
+TEST_F(BoxGeoVecGeomTest, Slabs)
+{
+    this->load("slabsGeometry.gdml");
+    EXPECT_EQ(vg_params->num_volumes(), box_params->num_volumes());
+    EXPECT_EQ(vg_params->max_depth(), box_params->max_depth());
+
+    // Most rays start near the slabs
+    this->compare_rays(30, 1000);
+    this->compare_rays(499, 100);
+}
@@ -0,0 +1,119 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file GeoMaterial.test.cc
+//---------------------------------------------------------------------------//
+#include "geometry/GeoMaterialParams.hh"
+#include "geometry/GeoMaterialView.hh"
+
+#include <memory>
+#include "base/Range.hh"
+#include "io/GdmlGeometryMap.hh"
+#include "celeritas_test.hh"
+
+using namespace celeritas;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class GeoMaterialTest : public celeritas::Test
+{
+  protected:
+    void SetUp() override
+    {
+        MaterialParams::Input inp;
+        inp.elements  = {{1, units::AmuMass{1.008}, "H"}};
+        inp.materials = {
+            {0.0, 0.0, MatterState::unspecified, {}, "hard_vacuum"},
+            {1e20, 293.0, MatterState::gas, {{ElementId{0}, 1.0}}, "H2"},
+            {1e23, 20.0, MatterState::liquid, {{ElementId{0}, 1.0}}, "LH2"},
+        };
+        materials = std::make_shared<MaterialParams>(std::move(inp));
+    }
+
+    std::shared_ptr<const MaterialParams> materials;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(GeoMaterialTest, view)
+{
+    GeoMaterialParams::Input inp;
+    inp.materials     = materials;
+    inp.num_volumes   = 3;
+    inp.volume_to_mat = {MaterialId{2}, MaterialId{0}, MaterialId{1}};
+    GeoMaterialParams geo_mat(inp);
+    EXPECT_EQ(3, geo_mat.num_volumes());
+
+    GeoMaterialView view(geo_mat.host_pointers());
+    for (auto vol_id : range(VolumeId{3}))
+    {
+        EXPECT_EQ(inp.volume_to_mat[vol_id.get()], view.material_id(vol_id));
+    }
+}
+
+TEST_F(GeoMaterialTest, errors)
+{
+    GeoMaterialParams::Input inp;
+    inp.materials   = materials;
+    inp.num_volumes = 3;
+
+    // Unassigned volume
+    inp.volume_to_mat = {MaterialId{2}, MaterialId{}, MaterialId{1}};
+    EXPECT_THROW(GeoMaterialParams{inp}, celeritas::RuntimeError);
+
+    // Undefined material
+    inp.volume_to_mat = {MaterialId{2}, MaterialId{3}, MaterialId{1}};
+    EXPECT_THROW(GeoMaterialParams{inp}, celeritas::RuntimeError);
+
+    // Map size doesn't match the number of volumes
+    inp.volume_to_mat = {MaterialId{2}, MaterialId{0}};
+    EXPECT_THROW(GeoMaterialParams{inp}, celeritas::RuntimeError);
+    inp.volume_to_mat
+        = {MaterialId{2}, MaterialId{0}, MaterialId{1}, MaterialId{1}};
+    EXPECT_THROW(GeoMaterialParams{inp}, celeritas::RuntimeError);
+}
+
+TEST_F(GeoMaterialTest, from_gdml)
+{
+    // Exported IDs need not be contiguous
+    GdmlGeometryMap geometry;
+    for (mat_id id : {10, 20, 30})
+    {
+        geometry.add_material(id, ImportMaterial{});
+    }
+    geometry.link_volume_material(0, 30);
+    geometry.link_volume_material(1, 10);
+    geometry.link_volume_material(3, 10);
+
+    // Trailing volumes without a material link are kept
+    auto volume_to_mat = to_volume_materials(geometry, 5);
+    const MaterialId expected[] = {MaterialId{2},
+                                   MaterialId{0},
+                                   MaterialId{},
+                                   MaterialId{0},
+                                   MaterialId{}};
+    ASSERT_EQ(5, volume_to_mat.size());
+    for (auto i : range(5))
+    {
+        EXPECT_EQ(expected[i], volume_to_mat[i]) << "for volume " << i;
+    }
+
+    // Links to volumes outside the geometry are rejected
+    EXPECT_THROW(to_volume_materials(geometry, 3), celeritas::RuntimeError);
+
+    // The missing volume link is caught on construction
+    EXPECT_THROW(
+        GeoMaterialParams({materials, 4, to_volume_materials(geometry, 4)}),
+        celeritas::RuntimeError);
+    geometry.link_volume_material(2, 20);
+    GeoMaterialParams geo_mat(
+        {materials, 4, to_volume_materials(geometry, 4)});
+    GeoMaterialView   view(geo_mat.host_pointers());
+    EXPECT_EQ(MaterialId{1}, view.material_id(VolumeId{2}));
+}
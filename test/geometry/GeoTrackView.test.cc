@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #include "geometry/GeoTrackView.hh"
 
+#include <random>
 #include <VecGeom/navigation/NavigationState.h>
 #include "geometry/GeoParams.hh"
 #include "geometry/GeoStateStore.hh"
@@ -18,6 +19,9 @@
 #endif
 
 #include "base/ArrayIO.hh"
+#include "base/Range.hh"
+#include "random/distributions/ExponentialDistribution.hh"
+#include "random/distributions/IsotropicDistribution.hh"
 
 using namespace celeritas;
 using namespace celeritas_test;
@@ -42,6 +46,7 @@ class GeoTrackViewHostTest : public GeoParamsTest
         state_view.pos        = &this->pos;
         state_view.dir        = &this->dir;
         state_view.next_step  = &this->next_step;
+        state_view.safety     = &this->safety;
         state_view.vgstate    = this->state.get();
         state_view.vgnext     = this->next_state.get();
 
@@ -54,6 +59,7 @@ class GeoTrackViewHostTest : public GeoParamsTest
     Real3                     pos;
     Real3                     dir;
     real_type                 next_step;
+    real_type                 safety;
     std::unique_ptr<NavState> state;
     std::unique_ptr<NavState> next_state;
 
@@ -126,6 +132,78 @@ TEST_F(GeoTrackViewHostTest, track_line)
     }
 }
 
+TEST_F(GeoTrackViewHostTest, safety)
+{
+    GeoTrackView geo(params_view, state_view, ThreadId(0));
+
+    // Start in the center of Shape2, 5 cm from each face
+    geo = {{-10, 10, 10}, {1, 0, 0}};
+    EXPECT_SOFT_EQ(0, geo.safety());
+
+    // Finding the boundary distance doesn't calculate the safety
+    geo.find_next_step();
+    EXPECT_SOFT_EQ(5, geo.next_step());
+    EXPECT_SOFT_EQ(0, geo.safety());
+    EXPECT_SOFT_EQ(5, geo.find_safety());
+
+    // Steps within the safety don't navigate
+    auto result = geo.propagate(1);
+    EXPECT_TRUE(result.safety_hit);
+    EXPECT_FALSE(result.boundary);
+    EXPECT_SOFT_EQ(1, result.distance);
+    EXPECT_SOFT_EQ(-9, geo.pos()[0]);
+    EXPECT_SOFT_EQ(4, geo.safety());
+
+    result = geo.propagate(3.5);
+    EXPECT_TRUE(result.safety_hit);
+    EXPECT_SOFT_EQ(0.5, geo.safety());
+    EXPECT_EQ(VolumeId{0}, geo.volume_id());
+
+    // Step past the boundary stops at the boundary
+    result = geo.propagate(2);
+    EXPECT_FALSE(result.safety_hit);
+    EXPECT_TRUE(result.boundary);
+    EXPECT_SOFT_EQ(0.5, result.distance);
+    EXPECT_EQ(VolumeId{1}, geo.volume_id()); // Shape2 -> Shape1
+    EXPECT_SOFT_EQ(0, geo.safety());
+
+    // Step short of the boundary updates the safety
+    result = geo.propagate(0.25);
+    EXPECT_FALSE(result.safety_hit);
+    EXPECT_FALSE(result.boundary);
+    EXPECT_SOFT_NEAR(0.75, geo.next_step(), 1e-10);
+}
+
+TEST_F(GeoTrackViewHostTest, safety_hit_rate)
+{
+    GeoTrackView geo(params_view, state_view, ThreadId(0));
+
+    // Move tracks from Shape2 out of the world with short physics-limited
+    // steps (e.g. from continuous energy loss)
+    std::mt19937              rng;
+    ExponentialDistribution<> sample_step(10.0); // 1 mm mean step
+    IsotropicDistribution<>   sample_dir;
+    size_type                 num_steps      = 0;
+    size_type                 num_hits       = 0;
+    size_type                 num_boundaries = 0;
+    for (CELER_MAYBE_UNUSED auto i : range(100))
+    {
+        geo = {{-10, 10, 10}, sample_dir(rng)};
+        while (!geo.is_outside())
+        {
+            auto result = geo.propagate(sample_step(rng));
+            ++num_steps;
+            num_hits += result.safety_hit;
+            num_boundaries += result.boundary;
+        }
+    }
+    cout << "Safety cache hit fraction: " << double(num_hits) / num_steps
+         << " (" << num_hits << " of " << num_steps << " steps, "
+         << num_boundaries << " boundary crossings)" << std::endl;
+    EXPECT_GT(num_hits, num_steps / 2);
+    EXPECT_GT(num_boundaries, 0);
+}
+
 #if CELERITAS_USE_CUDA
 //---------------------------------------------------------------------------//
 // DEVICE TESTS
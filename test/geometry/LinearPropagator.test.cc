@@ -7,6 +7,12 @@
 //---------------------------------------------------------------------------//
 #include "geometry/LinearPropagator.hh"
 
+#include <random>
+#include <vector>
+#include "celeritas_config.h"
+#if CELERITAS_USE_OPENMP
+#    include <omp.h>
+#endif
 #include "geometry/GeoStateStore.hh"
 
 #include "GeoParamsTest.hh"
@@ -15,7 +21,12 @@
 #endif
 
 #include "base/ArrayIO.hh"
+#include "base/ParallelFor.hh"
+#include "base/Range.hh"
+#include "base/Stopwatch.hh"
 #include "comm/Device.hh"
+#include "random/distributions/IsotropicDistribution.hh"
+#include "random/distributions/UniformRealDistribution.hh"
 
 using namespace celeritas;
 using namespace celeritas_test;
@@ -40,6 +51,7 @@ class LinearPropagatorHostTest : public GeoParamsTest
         state_view.pos        = &this->pos;
         state_view.dir        = &this->dir;
         state_view.next_step  = &this->next_step;
+        state_view.safety     = &this->safety;
         state_view.vgstate    = this->state.get();
         state_view.vgnext     = this->next_state.get();
 
@@ -52,6 +64,7 @@ class LinearPropagatorHostTest : public GeoParamsTest
     Real3                     pos;
     Real3                     dir;
     real_type                 next_step;
+    real_type                 safety;
     std::unique_ptr<NavState> state;
     std::unique_ptr<NavState> next_state;
 
@@ -187,6 +200,121 @@ TEST_F(LinearPropagatorHostTest, track_intraVolume)
     }
 }
 
+//---------------------------------------------------------------------------//
+// MULTITHREADED HOST TESTS
+//---------------------------------------------------------------------------//
+
+class LinearPropagatorThreadedTest : public GeoParamsTest
+{
+  public:
+    //! Result of propagating a single track out of the world
+    struct Result
+    {
+        size_type num_steps = 0;
+        real_type distance  = 0;
+    };
+
+    Result propagate_to_exit(GeoStatePointers           state_view,
+                             ThreadId                   tid,
+                             const GeoStateInitializer& init) const
+    {
+        GeoTrackView     geo(params_view, state_view, tid);
+        LinearPropagator propagate(&geo);
+
+        Result result;
+        geo = init;
+        while (!geo.is_outside())
+        {
+            geo.find_next_step();
+            result.distance += geo.next_step();
+            propagate();
+            ++result.num_steps;
+            CELER_ASSERT(result.num_steps < 1000);
+        }
+        return result;
+    }
+
+    void SetUp() override
+    {
+        params_view = this->params()->host_pointers();
+        CELER_ASSERT(params_view);
+    }
+
+    GeoParamsPointers params_view;
+};
+
+TEST_F(LinearPropagatorThreadedTest, throughput)
+{
+    const size_type num_tracks = 8192;
+
+    // Sample isotropic tracks starting throughout the world
+    std::mt19937                     rng;
+    UniformRealDistribution<>        sample_pos(-20, 20);
+    IsotropicDistribution<>          sample_dir;
+    std::vector<GeoStateInitializer> inits(num_tracks);
+    for (GeoStateInitializer& init : inits)
+    {
+        init.pos = {sample_pos(rng), sample_pos(rng), sample_pos(rng)};
+        init.dir = sample_dir(rng);
+    }
+
+    // Each host thread navigates a separate track state
+    GeoStateStore    states(*this->params(), num_tracks);
+    GeoStatePointers state_view = states.host_pointers();
+
+    // Propagate serially, reusing a single state
+    std::vector<Result> expected(num_tracks);
+    for (auto i : range(num_tracks))
+    {
+        expected[i]
+            = this->propagate_to_exit(state_view, ThreadId{0}, inits[i]);
+    }
+
+    size_type total_steps = 0;
+    for (const Result& r : expected)
+    {
+        total_steps += r.num_steps;
+    }
+    EXPECT_GT(total_steps, num_tracks);
+
+    // Propagate in parallel with one state per track, doubling the number of
+    // threads up to the maximum
+#if CELERITAS_USE_OPENMP
+    const int max_threads = omp_get_max_threads();
+#else
+    const int max_threads = 1;
+#endif
+    cout << "Linear propagation of " << num_tracks << " tracks ("
+         << total_steps << " steps):\n";
+    for (int num_threads = 1; num_threads <= max_threads; num_threads *= 2)
+    {
+        SCOPED_TRACE(std::to_string(num_threads) + " threads");
+#if CELERITAS_USE_OPENMP
+        omp_set_num_threads(num_threads);
+#endif
+        std::vector<Result> actual(num_tracks);
+        Stopwatch           get_time;
+        parallel_for(num_tracks, [&](size_type i) {
+            actual[i]
+                = this->propagate_to_exit(state_view, ThreadId{i}, inits[i]);
+        });
+        double time = get_time();
+        cout << "  " << num_threads << " threads: " << total_steps / time
+             << " steps/s\n";
+
+        for (auto i : range(num_tracks))
+        {
+            EXPECT_EQ(expected[i].num_steps, actual[i].num_steps)
+                << "track " << i;
+            EXPECT_SOFT_EQ(expected[i].distance, actual[i].distance);
+        }
+    }
+#if CELERITAS_USE_OPENMP
+    omp_set_num_threads(max_threads);
+#endif
+    cout << std::flush;
+}
+
 #if CELERITAS_USE_CUDA
 //---------------------------------------------------------------------------//
 // DEVICE TESTS
@@ -22,6 +22,13 @@
     EXPECT_PRED_FORMAT3(                              \
         ::celeritas::detail::IsSoftEquiv, expected, actual, rel_error)
 
+//! Floating point equality (to within 4 ULP) at the build's precision
+#if CELERITAS_SINGLE_PRECISION
+#    define EXPECT_REAL_EQ(expected, actual) EXPECT_FLOAT_EQ(expected, actual)
+#else
+#    define EXPECT_REAL_EQ(expected, actual) EXPECT_DOUBLE_EQ(expected, actual)
+#endif
+
 //! Container soft equivalence macro
 #define EXPECT_VEC_SOFT_EQ(expected, actual) \
     EXPECT_PRED_FORMAT2(::celeritas::detail::IsVecSoftEquiv, expected, actual)
@@ -56,6 +63,13 @@
 #    define TEST_IF_CELERITAS_CUDA(name) DISABLED_##name
 #endif
 
+//! Construct a test name that is disabled in single-precision builds
+#if CELERITAS_SINGLE_PRECISION
+#    define TEST_IF_CELERITAS_DOUBLE(name) DISABLED_##name
+#else
+#    define TEST_IF_CELERITAS_DOUBLE(name) name
+#endif
+
 //! Skip the remainder of the test (only run from the main function!!)
 #define SKIP(msg)                                                      \
     do                                                                 \
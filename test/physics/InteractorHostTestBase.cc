@@ -7,7 +7,10 @@
 //---------------------------------------------------------------------------//
 #include "InteractorHostTestBase.hh"
 
+#include <cmath>
+
 #include "base/ArrayUtils.hh"
+#include "base/SoftEqual.hh"
 #include "physics/base/SecondaryAllocatorView.hh"
 #include "physics/base/Interaction.hh"
 #include "physics/base/Secondary.hh"
@@ -218,14 +221,42 @@ void InteractorHostTestBase::check_momentum_conservation(
     {
         Real3             delta_momentum = exit_momentum;
         axpy(-parent_track.momentum().value(), inc_direction_, &delta_momentum);
+        // Tolerance is 1e-12 in double precision
+        const real_type tol = SoftEqual<real_type>().rel();
         EXPECT_SOFT_NEAR(0.0,
                          dot_product(delta_momentum, delta_momentum),
-                         parent_track.momentum().value() * 1e-12)
+                         parent_track.momentum().value() * tol)
             << "Incident: " << inc_direction_
             << " with p = " << parent_track.momentum().value()
             << "* MeV/c; exiting p = " << exit_momentum;
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Check a sampled mean against a double-precision reference.
+ *
+ * The reference mean and standard deviation of the distribution should be
+ * calculated from many samples in a double-precision build. The sampled mean
+ * must be within five standard errors of the reference, so the same test
+ * passes in single precision unless the sampled distribution changes.
+ */
+void InteractorHostTestBase::check_mean(const std::vector<real_type>& samples,
+                                        double ref_mean,
+                                        double ref_stddev) const
+{
+    CELER_EXPECT(!samples.empty());
+    CELER_EXPECT(ref_stddev > 0);
+
+    double mean = 0;
+    for (real_type v : samples)
+    {
+        mean += v;
+    }
+    mean /= samples.size();
+
+    EXPECT_NEAR(ref_mean, mean, 5 * ref_stddev / std::sqrt(samples.size()));
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas_test
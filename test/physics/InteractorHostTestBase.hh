@@ -88,6 +88,11 @@ class InteractorHostTestBase : public celeritas::Test
     //! Set and get material properties
     void                  set_material_params(MaterialParams::Input inp);
     const MaterialParams& material_params() const;
+    std::shared_ptr<const MaterialParams> get_material_params() const
+    {
+        CELER_EXPECT(material_params_);
+        return material_params_;
+    }
     //!@}
 
     //!@{
@@ -148,6 +153,11 @@ class InteractorHostTestBase : public celeritas::Test
     // Check for momentum conservation
     void check_momentum_conservation(const Interaction& interaction) const;
 
+    // Check a sampled mean against a double-precision reference
+    void check_mean(const std::vector<real_type>& samples,
+                    double                        ref_mean,
+                    double                        ref_stddev) const;
+
   private:
     template<template<celeritas::Ownership, celeritas::MemSpace> class S>
     using StateStore
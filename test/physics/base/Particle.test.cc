@@ -103,7 +103,7 @@ class ParticleTestHost : public ParticleTest
     ParticleStateData<Ownership::reference, MemSpace::host> state_ref;
 };
 
-TEST_F(ParticleTestHost, electron)
+TEST_F(ParticleTestHost, TEST_IF_CELERITAS_DOUBLE(electron))
 {
     ParticleTrackView particle(
         particle_params->host_pointers(), state_ref, ThreadId(0));
@@ -137,7 +137,7 @@ TEST_F(ParticleTestHost, gamma)
     EXPECT_DOUBLE_EQ(10, particle.momentum().value());
 }
 
-TEST_F(ParticleTestHost, neutron)
+TEST_F(ParticleTestHost, TEST_IF_CELERITAS_DOUBLE(neutron))
 {
     ParticleTrackView particle(
         particle_params->host_pointers(), state_ref, ThreadId(0));
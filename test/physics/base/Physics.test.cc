@@ -8,10 +8,24 @@
 #include "physics/base/PhysicsParams.hh"
 #include "physics/base/PhysicsTrackView.hh"
 
+#include <algorithm>
+#include <cmath>
+#include "celeritas_config.h"
+#if CELERITAS_USE_OPENMP
+#    include <omp.h>
+#endif
 #include "celeritas_test.hh"
 #include "base/Range.hh"
 #include "base/CollectionStateStore.hh"
+#include "base/Stopwatch.hh"
 #include "physics/base/ParticleParams.hh"
+#include "io/LivermorePEParamsReader.hh"
+#include "physics/em/EPlusAnnihilationProcess.hh"
+#include "physics/em/LivermorePEMacroXsCalculator.hh"
+#include "physics/em/LivermorePEModel.hh"
+#include "physics/em/LivermorePEParams.hh"
+#include "physics/em/PhotoelectricProcess.hh"
+#include "physics/grid/ValueGridBuilder.hh"
 #include "physics/grid/RangeCalculator.hh"
 #include "physics/grid/XsCalculator.hh"
 
@@ -88,6 +102,120 @@ TEST_F(PhysicsParamsTest, accessors)
     EXPECT_VEC_EQ(expected_process_map, process_map);
 }
 
+//---------------------------------------------------------------------------//
+// SETUP SCALING
+//---------------------------------------------------------------------------//
+
+class PhysicsParamsScalingTest : public PhysicsTestBase
+{
+  protected:
+    //! Build mock physics for the given number of materials
+    SPConstPhysics build_physics(size_type num_mats) const
+    {
+        using namespace celeritas::units;
+        MaterialParams::Input mat_inp;
+        mat_inp.elements = {{1, AmuMass{1.0}, "celerogen"},
+                            {4, AmuMass{10.0}, "celerinium"}};
+        for (auto i : range(num_mats))
+        {
+            mat_inp.materials.push_back({real_type(1e20) * (i + 1),
+                                         300,
+                                         MatterState::solid,
+                                         {{ElementId{i % 2}, 1.0}},
+                                         "mat" + std::to_string(i)});
+        }
+
+        PhysicsParams::Input inp;
+        inp.materials        = std::make_shared<MaterialParams>(mat_inp);
+        inp.particles        = this->particles();
+        inp.options.woodcock = true;
+
+        MockProcess::Input mock_inp;
+        mock_inp.materials = inp.materials;
+        mock_inp.interact  = this->make_model_callback();
+        {
+            mock_inp.label  = "scattering";
+            mock_inp.applic = {this->make_applicability("gamma", 1e-6, 100),
+                               this->make_applicability("celeriton", 1, 100)};
+            mock_inp.xs     = MockProcess::BarnMicroXs{1.0};
+            inp.processes.push_back(std::make_shared<MockProcess>(mock_inp));
+        }
+        {
+            mock_inp.label  = "purrs";
+            mock_inp.applic = {
+                this->make_applicability("celeriton", 1e-3, 1),
+                this->make_applicability("celeriton", 1, 100)};
+            mock_inp.xs          = MockProcess::BarnMicroXs{3.0};
+            mock_inp.energy_loss = 0.2 * 1e-20;
+            inp.processes.push_back(std::make_shared<MockProcess>(mock_inp));
+        }
+        {
+            mock_inp.label  = "hisses";
+            mock_inp.applic = {
+                this->make_applicability("anti-celeriton", 1e-3, 1),
+                this->make_applicability("anti-celeriton", 1, 100)};
+            mock_inp.xs          = MockProcess::BarnMicroXs{4.0};
+            mock_inp.energy_loss = 0.3 * 1e-20;
+            inp.processes.push_back(std::make_shared<MockProcess>(mock_inp));
+        }
+        return std::make_shared<PhysicsParams>(std::move(inp));
+    }
+
+    //! Build mock physics using a single thread
+    SPConstPhysics build_serial_physics(size_type num_mats) const
+    {
+#if CELERITAS_USE_OPENMP
+        const int max_threads = omp_get_max_threads();
+        omp_set_num_threads(1);
+#endif
+        auto result = this->build_physics(num_mats);
+#if CELERITAS_USE_OPENMP
+        omp_set_num_threads(max_threads);
+#endif
+        return result;
+    }
+};
+
+TEST_F(PhysicsParamsScalingTest, setup_time)
+{
+#if CELERITAS_USE_OPENMP
+    const int num_threads = omp_get_max_threads();
+#else
+    const int num_threads = 1;
+#endif
+    cout << "Physics setup time with 1 and " << num_threads
+         << " threads:\n";
+
+    for (size_type num_mats : {1, 16, 256, 1024})
+    {
+        SCOPED_TRACE(std::to_string(num_mats) + " materials");
+
+        Stopwatch get_serial_time;
+        auto      serial      = this->build_serial_physics(num_mats);
+        double    serial_time = get_serial_time();
+
+        Stopwatch get_parallel_time;
+        auto      parallel      = this->build_physics(num_mats);
+        double    parallel_time = get_parallel_time();
+
+        cout << "  " << num_mats << " materials: serial " << serial_time
+             << " s, parallel " << parallel_time << " s (speedup "
+             << serial_time / parallel_time << ")\n";
+
+        // Parallel construction must give identical results
+        const auto& expected = serial->host_pointers();
+        const auto& actual   = parallel->host_pointers();
+        EXPECT_EQ(expected.value_grids.size(), actual.value_grids.size());
+        EXPECT_EQ(expected.value_grid_ids.size(),
+                  actual.value_grid_ids.size());
+        ASSERT_EQ(expected.reals.size(), actual.reals.size());
+        EXPECT_TRUE(std::equal(expected.reals.data(),
+                               expected.reals.data() + expected.reals.size(),
+                               actual.reals.data()));
+    }
+    cout << std::flush;
+}
+
 //---------------------------------------------------------------------------//
 // PHYSICS TRACK VIEW (HOST)
 //---------------------------------------------------------------------------//
@@ -173,8 +301,8 @@ TEST_F(PhysicsTrackViewHostTest, accessors)
 
         gamma.interaction_mfp(1.234);
         celer.interaction_mfp(2.345);
-        EXPECT_DOUBLE_EQ(1.234, gamma_cref.interaction_mfp());
-        EXPECT_DOUBLE_EQ(2.345, celer.interaction_mfp());
+        EXPECT_REAL_EQ(1.234, gamma_cref.interaction_mfp());
+        EXPECT_REAL_EQ(2.345, celer.interaction_mfp());
     }
 
     // Cross sections
@@ -182,9 +310,9 @@ TEST_F(PhysicsTrackViewHostTest, accessors)
         gamma.per_process_xs(ParticleProcessId{0}) = 1.2;
         gamma.per_process_xs(ParticleProcessId{1}) = 10.0;
         celer.per_process_xs(ParticleProcessId{0}) = 100.0;
-        EXPECT_DOUBLE_EQ(1.2, gamma_cref.per_process_xs(ParticleProcessId{0}));
-        EXPECT_DOUBLE_EQ(10.0, gamma_cref.per_process_xs(ParticleProcessId{1}));
-        EXPECT_DOUBLE_EQ(100.0, celer.per_process_xs(ParticleProcessId{0}));
+        EXPECT_REAL_EQ(1.2, gamma_cref.per_process_xs(ParticleProcessId{0}));
+        EXPECT_REAL_EQ(10.0, gamma_cref.per_process_xs(ParticleProcessId{1}));
+        EXPECT_REAL_EQ(100.0, celer.per_process_xs(ParticleProcessId{0}));
     }
 }
 
@@ -252,16 +380,36 @@ TEST_F(PhysicsTrackViewHostTest, value_grids)
         }
     }
 
-    // Grid IDs should be unique if they exist. Gammas should have fewer
-    // because there aren't any slowing down/range limiters.
+    // Grid IDs should be unique unless the grids are identical: the "meows"
+    // process has the same tables for celeritons and anti-celeritons. Gammas
+    // should have fewer because there aren't any slowing down/range limiters.
     const int expected_grid_ids[]
         = {0,  -1, -1, 3,  -1, -1, 1,  -1, -1, 4,  -1, -1, 2,  -1, -1, 5,
            -1, -1, 6,  -1, -1, 9,  10, 11, 18, 19, 20, 7,  -1, -1, 12, 13,
            14, 21, 22, 23, 8,  -1, -1, 15, 16, 17, 24, 25, 26, 27, 28, 29,
-           36, 37, 38, 30, 31, 32, 39, 40, 41, 33, 34, 35, 42, 43, 44};
+           18, 19, 20, 30, 31, 32, 21, 22, 23, 33, 34, 35, 24, 25, 26};
     EXPECT_VEC_EQ(expected_grid_ids, grid_ids);
 }
 
+TEST_F(PhysicsTrackViewHostTest, production_cuts)
+{
+    std::vector<real_type> cuts;
+    for (auto mat_id : range(MaterialId{this->materials()->size()}))
+    {
+        const PhysicsTrackView phys = this->make_track_view("gamma", mat_id);
+        for (const char* secondary : {"gamma", "celeriton", "anti-celeriton"})
+        {
+            auto pid = this->particles()->find(secondary);
+            cuts.push_back(phys.production_cut(pid).value());
+        }
+    }
+
+    // Anti-celeritons have no production threshold
+    const double expected_cuts[]
+        = {0.001, 0.1, 0, 0.002, 0.2, 0, 0.003, 0.3, 0};
+    EXPECT_VEC_SOFT_EQ(expected_cuts, cuts);
+}
+
 TEST_F(PhysicsTrackViewHostTest, calc_xs)
 {
     // Cross sections: same across particle types, constant in energy, scale
@@ -331,6 +479,50 @@ TEST_F(PhysicsTrackViewHostTest, model_finder)
     EXPECT_EQ(4, find_model(MevEnergy{5}).unchecked_get());
     EXPECT_EQ(5, find_model(MevEnergy{50}).unchecked_get());
     EXPECT_FALSE(find_model(MevEnergy{100.1}));
+
+    // Grid points are attached to the model above, except the end point
+    EXPECT_EQ(3, find_model(MevEnergy{1e-3}).unchecked_get());
+    EXPECT_EQ(3, find_model(MevEnergy{0.999999}).unchecked_get());
+    EXPECT_EQ(4, find_model(MevEnergy{1}).unchecked_get());
+    EXPECT_EQ(4, find_model(MevEnergy{9.99999}).unchecked_get());
+    EXPECT_EQ(5, find_model(MevEnergy{10}).unchecked_get());
+    EXPECT_EQ(5, find_model(MevEnergy{100}).unchecked_get());
+}
+
+TEST_F(PhysicsTrackViewHostTest, model_lookup)
+{
+    // Multi-model groups should have a uniform lookup table; the results
+    // must be identical to the binary search
+    for (const char* particle : {"gamma", "celeriton", "anti-celeriton"})
+    {
+        const PhysicsTrackView phys
+            = this->make_track_view(particle, MaterialId{0});
+        for (auto pp_id :
+             range(ParticleProcessId{phys.num_particle_processes()}))
+        {
+            const ProcessGroup& pgroup
+                = params_ref.process_groups[this->particles()->find(particle)];
+            const ModelGroup& mg
+                = params_ref.model_groups[pgroup.models[pp_id.get()]];
+            EXPECT_EQ(mg.model.size() > 1, !mg.lookup_index.empty());
+
+            auto find_model = phys.make_model_finder(pp_id);
+            PhysicsTrackView::ModelFinder find_model_search(
+                params_ref.reals[mg.energy], params_ref.model_ids[mg.model]);
+            for (real_type energy = 1e-7; energy < 1e3; energy *= 1.01)
+            {
+                EXPECT_EQ(find_model_search(MevEnergy{energy}),
+                          find_model(MevEnergy{energy}))
+                    << "for " << particle << " at " << energy << " MeV";
+            }
+            for (real_type energy : params_ref.reals[mg.energy])
+            {
+                EXPECT_EQ(find_model_search(MevEnergy{energy}),
+                          find_model(MevEnergy{energy}))
+                    << "for " << particle << " at " << energy << " MeV";
+            }
+        }
+    }
 }
 
 TEST_F(PhysicsTrackViewHostTest, cuda_surrogate)
@@ -359,6 +551,388 @@ TEST_F(PhysicsTrackViewHostTest, cuda_surrogate)
     EXPECT_VEC_SOFT_EQ(expected_step, step);
 }
 
+//---------------------------------------------------------------------------//
+
+class PhysicsUsedMaterialsTest : public PhysicsTrackViewHostTest
+{
+  protected:
+    VecMaterialId build_used_materials() const override
+    {
+        return {MaterialId{2}};
+    }
+};
+
+TEST_F(PhysicsUsedMaterialsTest, value_grids)
+{
+    EXPECT_FALSE(this->physics()->has_material_tables(MaterialId{0}));
+    EXPECT_FALSE(this->physics()->has_material_tables(MaterialId{1}));
+    EXPECT_TRUE(this->physics()->has_material_tables(MaterialId{2}));
+
+    // Only the tables for the used material should be built
+    std::vector<int> grid_ids;
+    for (const char* particle : {"gamma", "celeriton", "anti-celeriton"})
+    {
+        const PhysicsTrackView phys
+            = this->make_track_view(particle, MaterialId{2});
+        EXPECT_TRUE(phys.has_material_tables());
+        for (auto pp_id :
+             range(ParticleProcessId{phys.num_particle_processes()}))
+        {
+            for (ValueGridType vgt : range(ValueGridType::size_))
+            {
+                auto id = phys.value_grid(vgt, pp_id);
+                grid_ids.push_back(id ? id.get() : -1);
+            }
+        }
+    }
+    const int expected_grid_ids[] = {0,  -1, -1, 1,  -1, -1, 2, -1, -1, 3,
+                                     4,  5,  6,  7,  8,  9,  10, 11, 6, 7, 8};
+    EXPECT_VEC_EQ(expected_grid_ids, grid_ids);
+    EXPECT_EQ(12, params_ref.value_grids.size());
+
+    // Cross sections are unchanged in the used material
+    const PhysicsTrackView phys
+        = this->make_track_view("celeriton", MaterialId{2});
+    auto scat_ppid = this->find_ppid(phys, "scattering");
+    auto calc_xs   = phys.make_calculator<XsCalculator>(
+        phys.value_grid(ValueGridType::macro_xs, scat_ppid));
+    EXPECT_SOFT_EQ(0.1, calc_xs(MevEnergy{1.0}));
+
+    const PhysicsTrackView unused
+        = this->make_track_view("celeriton", MaterialId{0});
+    EXPECT_FALSE(unused.has_material_tables());
+#if CELERITAS_DEBUG
+    EXPECT_THROW(unused.value_grid(ValueGridType::macro_xs, scat_ppid),
+                 celeritas::DebugError);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+
+class PhysicsHardwiredTest : public PhysicsTrackViewHostTest
+{
+  protected:
+    SPConstParticles build_particles() const override
+    {
+        using namespace celeritas::units;
+        constexpr auto zero   = celeritas::zero_quantity();
+        constexpr auto stable = ParticleDef::stable_decay_constant();
+
+        ParticleParams::Input inp;
+        inp.push_back({"gamma", pdg::gamma(), zero, zero, stable});
+        inp.push_back({"electron",
+                       pdg::electron(),
+                       MevMass{0.5109989461},
+                       ElementaryCharge{-1},
+                       stable});
+        inp.push_back({"positron",
+                       pdg::positron(),
+                       MevMass{0.5109989461},
+                       ElementaryCharge{1},
+                       stable});
+        return std::make_shared<ParticleParams>(std::move(inp));
+    }
+
+    PhysicsOptions build_physics_options() const override
+    {
+        PhysicsOptions opts;
+        opts.tabulate_hardwired = tabulate_hardwired;
+        return opts;
+    }
+
+    SPConstPhysics build_physics() const override
+    {
+        PhysicsParams::Input inp;
+        inp.materials = this->materials();
+        inp.particles = this->particles();
+        inp.options   = this->build_physics_options();
+
+        // Every particle needs at least one process
+        MockProcess::Input mock_inp;
+        mock_inp.materials = this->materials();
+        mock_inp.interact  = this->make_model_callback();
+        mock_inp.label     = "scattering";
+        mock_inp.applic    = {make_applicability("gamma", 1e-6, 100),
+                           make_applicability("electron", 1e-6, 100)};
+        mock_inp.xs        = MockProcess::BarnMicroXs{1.0};
+        inp.processes.push_back(std::make_shared<MockProcess>(mock_inp));
+        inp.processes.push_back(
+            std::make_shared<EPlusAnnihilationProcess>(this->particles()));
+        return std::make_shared<PhysicsParams>(std::move(inp));
+    }
+
+    bool tabulate_hardwired = true;
+};
+
+TEST_F(PhysicsHardwiredTest, calc_xs)
+{
+    // Build the same physics without tabulating
+    tabulate_hardwired = false;
+    auto       otf_physics = this->build_physics();
+    StateStore otf_state(*otf_physics, this->particles()->size());
+    ParamsHostRef otf_params_ref = otf_physics->host_pointers();
+    EXPECT_FALSE(otf_params_ref.hardwired.eplusgg_xs);
+    EXPECT_TRUE(params_ref.hardwired.eplusgg_xs);
+    EXPECT_EQ(params_ref.hardwired.eplusgg, otf_params_ref.hardwired.eplusgg);
+
+    const auto positron = this->particles()->find(pdg::positron());
+    for (auto mat_id : range(MaterialId{this->materials()->size()}))
+    {
+        SCOPED_TRACE(this->materials()->id_to_label(mat_id));
+        const MaterialView material(this->materials()->host_pointers(),
+                                    mat_id);
+
+        const PhysicsTrackView phys
+            = this->make_track_view("positron", mat_id);
+        PhysicsTrackView otf_phys(
+            otf_params_ref, otf_state.ref(), positron, mat_id, ThreadId{0});
+        otf_phys = PhysicsTrackInitializer{};
+
+        auto ppid = this->find_ppid(phys, "Positron annihiliation");
+        ASSERT_TRUE(ppid);
+        EXPECT_TRUE(phys.hardwired_value_grid(params_ref.hardwired.eplusgg));
+        EXPECT_FALSE(
+            otf_phys.hardwired_value_grid(otf_params_ref.hardwired.eplusgg));
+
+        // Tabulated cross sections agree with the on-the-fly calculation to
+        // within the tolerance used to refine the grid
+        for (real_type energy :
+             {1e-5, 3.3e-4, 0.01, 0.511, 2.7, 45.6, 1e3, 1e7})
+        {
+            real_type expected
+                = otf_phys.calc_xs(ppid, material, MevEnergy{energy});
+            real_type actual = phys.calc_xs(ppid, material, MevEnergy{energy});
+            ASSERT_GT(expected, 0);
+            EXPECT_SOFT_NEAR(expected, actual, 2e-3) << "at " << energy
+                                                      << " MeV";
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+class PhysicsHardwiredPETest : public PhysicsHardwiredTest
+{
+  protected:
+    SPConstMaterials build_materials() const override
+    {
+        using namespace celeritas::units;
+        MaterialParams::Input inp;
+        inp.elements  = {{19, AmuMass{39.0983}, "K"}};
+        inp.materials = {
+            {1e20, 293, MatterState::gas, {{ElementId{0}, 1.0}}, "K gas"},
+            {1e22, 293, MatterState::solid, {{ElementId{0}, 1.0}}, "K solid"}};
+        return std::make_shared<MaterialParams>(std::move(inp));
+    }
+
+    SPConstPhysics build_physics() const override
+    {
+        PhysicsParams::Input inp;
+        inp.materials = this->materials();
+        inp.particles = this->particles();
+        inp.options   = this->build_physics_options();
+
+        // Every particle needs at least one process
+        MockProcess::Input mock_inp;
+        mock_inp.materials = this->materials();
+        mock_inp.interact  = this->make_model_callback();
+        mock_inp.label     = "scattering";
+        mock_inp.applic    = {make_applicability("electron", 1e-6, 100),
+                           make_applicability("positron", 1e-6, 100)};
+        mock_inp.xs        = MockProcess::BarnMicroXs{1.0};
+        inp.processes.push_back(std::make_shared<MockProcess>(mock_inp));
+
+        // Photoelectric effect with tables above the hardwired threshold
+        LivermorePEParams::Input li;
+        LivermorePEParamsReader  read_element_data(
+            this->test_data_path("physics/em", "").c_str());
+        li.elements.push_back(read_element_data(19));
+
+        ImportPhysicsTable xs_lo;
+        xs_lo.table_type = ImportTableType::lambda;
+        ImportPhysicsTable xs_hi;
+        xs_hi.table_type = ImportTableType::lambda_prim;
+        for (CELER_MAYBE_UNUSED auto mat_id :
+             range(MaterialId{this->materials()->size()}))
+        {
+            xs_lo.physics_vectors.push_back({ImportPhysicsVectorType::log,
+                                             {1e-2, 1, 1e2},
+                                             {1e-1, 1e-3, 1e-5}});
+            xs_hi.physics_vectors.push_back({ImportPhysicsVectorType::log,
+                                             {1e2, 1e4, 1e6},
+                                             {1e-3, 1e-3, 1e-3}});
+        }
+        inp.processes.push_back(std::make_shared<PhotoelectricProcess>(
+            this->particles(),
+            this->materials(),
+            xs_lo,
+            xs_hi,
+            std::make_shared<LivermorePEParams>(li)));
+        return std::make_shared<PhysicsParams>(std::move(inp));
+    }
+};
+
+TEST_F(PhysicsHardwiredPETest, calc_xs)
+{
+    ASSERT_TRUE(params_ref.hardwired.livermore_pe);
+    EXPECT_TRUE(params_ref.hardwired.livermore_pe_xs);
+
+    // The track view's on-the-fly cross sections use device data if a device
+    // is available, so calculate them directly from the model's host data
+    auto pe_model = dynamic_cast<const LivermorePEModel*>(
+        &this->physics()->model(params_ref.hardwired.livermore_pe));
+    ASSERT_TRUE(pe_model);
+    const detail::LivermorePEPointers pe_data = pe_model->host_pointers();
+
+    for (auto mat_id : range(MaterialId{this->materials()->size()}))
+    {
+        SCOPED_TRACE(this->materials()->id_to_label(mat_id));
+        const MaterialView material(this->materials()->host_pointers(),
+                                    mat_id);
+        const PhysicsTrackView phys = this->make_track_view("gamma", mat_id);
+
+        auto ppid = this->find_ppid(phys, "Photoelectric effect");
+        ASSERT_TRUE(ppid);
+        EXPECT_TRUE(
+            phys.hardwired_value_grid(params_ref.hardwired.livermore_pe));
+
+        // Tabulated cross sections agree with the on-the-fly calculation to
+        // within the tolerance used to refine the grid, away from the
+        // absorption edges (the K edge is at 3.6 keV)
+        LivermorePEMacroXsCalculator calc_otf_xs(pe_data, material);
+        for (real_type energy :
+             {1e-6, 1e-5, 1e-4, 1e-3, 2e-3, 5e-3, 0.02, 0.1, 0.19})
+        {
+            real_type expected = calc_otf_xs(MevEnergy{energy});
+            real_type actual = phys.calc_xs(ppid, material, MevEnergy{energy});
+            ASSERT_GT(expected, 0);
+            EXPECT_SOFT_NEAR(expected, actual, 2e-3) << "at " << energy
+                                                      << " MeV";
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+class PhysicsThinningTest : public PhysicsTrackViewHostTest
+{
+  protected:
+    //! Process with a finely tabulated, energy-dependent cross section
+    class DenseProcess : public celeritas::Process
+    {
+      public:
+        explicit DenseProcess(MockProcess::Input inp)
+            : materials_(inp.materials), models_(std::move(inp))
+        {
+        }
+
+        VecModel build_models(ModelIdGenerator next_id) const final
+        {
+            return models_.build_models(next_id);
+        }
+
+        StepLimitBuilders step_limits(Applicability applic) const final
+        {
+            MaterialView mat(materials_->host_pointers(), applic.material);
+            const real_type log_emin = std::log(applic.lower.value());
+            const real_type log_emax = std::log(applic.upper.value());
+            std::vector<real_type> xs(1025);
+            for (auto i : range(xs.size()))
+            {
+                real_type energy = std::exp(
+                    log_emin + i * (log_emax - log_emin) / (xs.size() - 1));
+                xs[i] = mat.number_density() * 1e-24 / std::sqrt(energy);
+            }
+
+            StepLimitBuilders builders;
+            builders[size_type(ValueGridType::macro_xs)]
+                = std::make_unique<ValueGridLogBuilder>(applic.lower.value(),
+                                                        applic.upper.value(),
+                                                        std::move(xs));
+            return builders;
+        }
+
+        std::string label() const final { return "dense"; }
+
+      private:
+        MockProcess::SPConstMaterials materials_;
+        MockProcess                   models_;
+    };
+
+    PhysicsOptions build_physics_options() const override
+    {
+        PhysicsOptions opts;
+        opts.thinning_tolerance = thinning_tolerance;
+        return opts;
+    }
+
+    SPConstPhysics build_physics() const override
+    {
+        PhysicsParams::Input inp;
+        inp.materials = this->materials();
+        inp.particles = this->particles();
+        inp.options   = this->build_physics_options();
+
+        MockProcess::Input mock_inp;
+        mock_inp.materials = this->materials();
+        mock_inp.interact  = this->make_model_callback();
+        mock_inp.label     = "dense";
+        mock_inp.applic    = {make_applicability("gamma", 1e-3, 100),
+                           make_applicability("celeriton", 1e-3, 100),
+                           make_applicability("anti-celeriton", 1e-3, 100)};
+        inp.processes.push_back(std::make_shared<DenseProcess>(mock_inp));
+        return std::make_shared<PhysicsParams>(std::move(inp));
+    }
+
+    real_type thinning_tolerance = 0;
+};
+
+TEST_F(PhysicsThinningTest, calc_xs)
+{
+    // Build the same physics with thinned tables
+    thinning_tolerance      = 1e-3;
+    auto       thin_physics = this->build_physics();
+    StateStore thin_state(*thin_physics, this->particles()->size());
+    ParamsHostRef thin_params_ref = thin_physics->host_pointers();
+
+    // Tables shrink by at least half
+    EXPECT_EQ(params_ref.value_grids.size(),
+              thin_params_ref.value_grids.size());
+    EXPECT_LT(2 * thin_params_ref.reals.size(), params_ref.reals.size());
+
+    const auto gamma = this->particles()->find("gamma");
+    for (auto mat_id : range(MaterialId{this->materials()->size()}))
+    {
+        SCOPED_TRACE(this->materials()->id_to_label(mat_id));
+        const MaterialView material(this->materials()->host_pointers(),
+                                    mat_id);
+
+        const PhysicsTrackView phys = this->make_track_view("gamma", mat_id);
+        PhysicsTrackView       thin_phys(
+            thin_params_ref, thin_state.ref(), gamma, mat_id, ThreadId{0});
+        thin_phys = PhysicsTrackInitializer{};
+
+        auto ppid = this->find_ppid(phys, "dense");
+        ASSERT_TRUE(ppid);
+
+        // Interpolated cross sections (both at and between the original grid
+        // points) agree with the unthinned tables to within the tolerance
+        real_type max_error = 0;
+        for (auto i : range(1000))
+        {
+            MevEnergy energy{real_type(1e-3)
+                             * std::pow(real_type(10), real_type(i) / 200)};
+            real_type expected = phys.calc_xs(ppid, material, energy);
+            real_type actual   = thin_phys.calc_xs(ppid, material, energy);
+            ASSERT_GT(expected, 0);
+            max_error = std::max(max_error,
+                                 std::fabs(actual - expected) / expected);
+        }
+        EXPECT_LE(max_error, thinning_tolerance);
+        EXPECT_GT(max_error, 0);
+    }
+}
+
 //---------------------------------------------------------------------------//
 // PHYSICS TRACK VIEW (DEVICE)
 //---------------------------------------------------------------------------//
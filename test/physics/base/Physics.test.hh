@@ -99,7 +99,7 @@ inline CELER_FUNCTION celeritas::real_type
     }
 
     // Take minimum of step and half the MFP
-    step = min(step, 0.5 * phys.interaction_mfp());
+    step = min(step, real_type(0.5) * phys.interaction_mfp());
     return step;
 }
 
@@ -7,9 +7,11 @@
 //---------------------------------------------------------------------------//
 #include "physics/base/PhysicsStepUtils.hh"
 
+#include <random>
 #include "base/CollectionStateStore.hh"
 #include "physics/base/ParticleParams.hh"
 #include "physics/base/PhysicsParams.hh"
+#include "random/distributions/ExponentialDistribution.hh"
 #include "celeritas_test.hh"
 #include "PhysicsTestBase.hh"
 
@@ -193,3 +195,93 @@ TEST_F(PhysicsStepUtilsTest, calc_energy_loss)
 }
 
 TEST_F(PhysicsStepUtilsTest, select_model) {}
+
+//---------------------------------------------------------------------------//
+// WOODCOCK TRACKING
+//---------------------------------------------------------------------------//
+
+class WoodcockStepTest : public PhysicsStepUtilsTest
+{
+  protected:
+    PhysicsOptions build_physics_options() const override
+    {
+        PhysicsOptions opts;
+        opts.woodcock        = true;
+        opts.majorant_size   = 32;
+        opts.majorant_safety = 1.1;
+        return opts;
+    }
+
+    std::mt19937 rng;
+};
+
+TEST_F(WoodcockStepTest, majorant)
+{
+    MaterialTrackView material(
+        this->materials()->host_pointers(), mat_state.ref(), ThreadId{0});
+    ParticleTrackView particle(
+        this->particles()->host_pointers(), par_state.ref(), ThreadId{0});
+
+    {
+        // Charged particles with energy loss have no majorant
+        PhysicsTrackView phys = this->init_track(
+            &material, MaterialId{0}, &particle, "celeriton", MevEnergy{1});
+        EXPECT_FALSE(phys.majorant_grid());
+    }
+
+    for (real_type energy : {1e-6, 1e-3, 1.0, 50.0, 100.0})
+    {
+        real_type max_xs = 0;
+        for (auto mat_id : range(MaterialId{this->materials()->size()}))
+        {
+            PhysicsTrackView phys = this->init_track(
+                &material, mat_id, &particle, "gamma", MevEnergy{energy});
+            ASSERT_TRUE(phys.majorant_grid());
+            phys.interaction_mfp(1);
+            celeritas::calc_tabulated_physics_step(material, particle, phys);
+            max_xs = std::max(max_xs, phys.macro_xs());
+
+            // Majorant is independent of the current material and includes
+            // the safety factor
+            real_type step = celeritas::calc_majorant_step(particle, phys);
+            EXPECT_SOFT_EQ(0.33, 1 / step);
+            EXPECT_SOFT_EQ(0.33, phys.macro_xs());
+        }
+        EXPECT_SOFT_EQ(0.3, max_xs);
+    }
+}
+
+TEST_F(WoodcockStepTest, sampling)
+{
+    MaterialTrackView material(
+        this->materials()->host_pointers(), mat_state.ref(), ThreadId{0});
+    ParticleTrackView particle(
+        this->particles()->host_pointers(), par_state.ref(), ThreadId{0});
+    PhysicsTrackView phys = this->init_track(
+        &material, MaterialId{1}, &particle, "gamma", MevEnergy{1});
+    celeritas::ExponentialDistribution<real_type> sample_num_mfp;
+
+    // Distance to a real collision in a material with 1/110 of the majorant
+    // cross section should be exponential with the true mean free path
+    const int num_samples   = 10000;
+    int       num_tentative = 0;
+    real_type distance      = 0;
+    for (CELER_MAYBE_UNUSED int i : range(num_samples))
+    {
+        phys.interaction_mfp(sample_num_mfp(rng));
+        do
+        {
+            distance += celeritas::calc_majorant_step(particle, phys);
+            ++num_tentative;
+        } while (!celeritas::sample_real_collision(
+            material, particle, phys, rng));
+
+        // Cross sections are calculated for the real collision
+        EXPECT_SOFT_EQ(3e-3, phys.macro_xs());
+        EXPECT_SOFT_EQ(1e-3, phys.per_process_xs(ParticleProcessId{0}));
+        EXPECT_SOFT_EQ(2e-3, phys.per_process_xs(ParticleProcessId{1}));
+    }
+    EXPECT_SOFT_NEAR(1 / 3e-3, distance / num_samples, 0.05);
+    EXPECT_SOFT_NEAR(
+        0.01 / 1.1, real_type(num_samples) / num_tentative, 0.05);
+}
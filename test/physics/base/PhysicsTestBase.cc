@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #include "PhysicsTestBase.hh"
 
+#include "base/Range.hh"
 #include "physics/material/MaterialParams.hh"
 #include "physics/base/ParticleParams.hh"
 #include "physics/base/PhysicsParams.hh"
@@ -78,14 +79,31 @@ auto PhysicsTestBase::build_physics_options() const -> PhysicsOptions
     return {};
 }
 
+//---------------------------------------------------------------------------//
+auto PhysicsTestBase::build_used_materials() const -> VecMaterialId
+{
+    return {};
+}
+
 //---------------------------------------------------------------------------//
 auto PhysicsTestBase::build_physics() const -> SPConstPhysics
 {
     using Barn = MockProcess::BarnMicroXs;
     PhysicsParams::Input physics_inp;
-    physics_inp.materials = this->materials();
-    physics_inp.particles = this->particles();
-    physics_inp.options   = this->build_physics_options();
+    physics_inp.materials      = this->materials();
+    physics_inp.particles      = this->particles();
+    physics_inp.options        = this->build_physics_options();
+    physics_inp.used_materials = this->build_used_materials();
+
+    // Production thresholds for gammas and celeritons
+    for (auto i : celeritas::range(this->materials()->size()))
+    {
+        using celeritas::units::MevEnergy;
+        physics_inp.production_cuts[pdg::gamma()].push_back(
+            MevEnergy{real_type(1e-3) * (i + 1)});
+        physics_inp.production_cuts[PDGNumber{1337}].push_back(
+            MevEnergy{real_type(0.1) * (i + 1)});
+    }
 
     // Add a few processes
     MockProcess::Input inp;
@@ -148,8 +166,8 @@ auto PhysicsTestBase::make_applicability(const char* name,
     CELER_EXPECT(lo_energy <= hi_energy);
     Applicability result;
     result.particle = particles_->find(name);
-    result.lower    = MevEnergy{lo_energy};
-    result.upper    = MevEnergy{hi_energy};
+    result.lower    = MevEnergy{real_type(lo_energy)};
+    result.upper    = MevEnergy{real_type(hi_energy)};
     return result;
 }
 
@@ -40,6 +40,7 @@ class PhysicsTestBase : public celeritas::Test
     using SPConstParticles = std::shared_ptr<celeritas::ParticleParams>;
     using SPConstPhysics   = std::shared_ptr<celeritas::PhysicsParams>;
     using PhysicsOptions   = celeritas::PhysicsParams::Options;
+    using VecMaterialId    = celeritas::PhysicsParams::VecMaterialId;
     using Applicability    = celeritas::Applicability;
     using ModelId          = celeritas::ModelId;
     using ModelCallback    = std::function<void(ModelId)>;
@@ -51,6 +52,7 @@ class PhysicsTestBase : public celeritas::Test
     virtual SPConstMaterials build_materials() const;
     virtual SPConstParticles build_particles() const;
     virtual PhysicsOptions   build_physics_options() const;
+    virtual VecMaterialId    build_used_materials() const;
     virtual SPConstPhysics   build_physics() const;
 
     const SPConstMaterials& materials() const { return materials_; }
@@ -57,13 +57,6 @@ class BetheHeitlerInteractorTest : public celeritas_test::InteractorHostTestBase
               ElementaryCharge{1},
               stable},
              {"gamma", pdg::gamma(), zero, zero, stable}});
-        const auto& params    = this->particle_params();
-        pointers_.electron_id = params.find(pdg::electron());
-        pointers_.positron_id = params.find(pdg::positron());
-        pointers_.gamma_id    = params.find(pdg::gamma());
-        pointers_.inv_electron_mass
-            = 1 / (params.get(pointers_.electron_id).mass().value());
-
         // Set default particle to photon with energy of 100 MeV
         this->set_inc_particle(pdg::gamma(), MevEnergy{100.0});
         this->set_inc_direction({0, 0, 1});
@@ -80,6 +73,11 @@ class BetheHeitlerInteractorTest : public celeritas_test::InteractorHostTestBase
         };
         this->set_material_params(inp);
         this->set_material("Cu");
+
+        // Construct model to precalculate element data
+        model_ = std::make_shared<celeritas::BetheHeitlerModel>(
+            ModelId{0}, this->particle_params(), this->material_params());
+        pointers_ = model_->host_pointers();
     }
 
     void sanity_check(const Interaction& interaction) const
@@ -115,23 +113,24 @@ class BetheHeitlerInteractorTest : public celeritas_test::InteractorHostTestBase
     }
 
   protected:
-    celeritas::detail::BetheHeitlerPointers pointers_;
+    std::shared_ptr<celeritas::BetheHeitlerModel> model_;
+    celeritas::detail::BetheHeitlerPointers       pointers_;
 };
 
 //---------------------------------------------------------------------------//
 // TESTS
 //---------------------------------------------------------------------------//
 
-TEST_F(BetheHeitlerInteractorTest, basic)
+TEST_F(BetheHeitlerInteractorTest, TEST_IF_CELERITAS_DOUBLE(basic))
 {
     // Reserve 4 secondaries, two for each sample
     const int num_samples = 4;
     this->resize_secondaries(2 * num_samples);
 
-    // Get the ElementView
-    const celeritas::ElementView element(
-        this->material_track().material_view().element_view(
-            celeritas::ElementComponentId{0}));
+    // Get the element ID
+    const celeritas::ElementId element
+        = this->material_track().material_view().element_id(
+            celeritas::ElementComponentId{0});
 
     // Create the interactor
     BetheHeitlerInteractor interact(pointers_,
@@ -186,7 +185,37 @@ TEST_F(BetheHeitlerInteractorTest, basic)
     }
 }
 
-TEST_F(BetheHeitlerInteractorTest, stress_test)
+TEST_F(BetheHeitlerInteractorTest, reference_moments)
+{
+    const int num_samples = 10000;
+    this->resize_secondaries(2 * num_samples);
+    const celeritas::ElementId element
+        = this->material_track().material_view().element_id(
+            celeritas::ElementComponentId{0});
+    BetheHeitlerInteractor interact(pointers_,
+                                    this->particle_track(),
+                                    this->direction(),
+                                    this->secondary_allocator(),
+                                    element);
+
+    std::vector<real_type> eps;
+    std::vector<real_type> costheta;
+    for (CELER_MAYBE_UNUSED int i : celeritas::range(num_samples))
+    {
+        Interaction result = interact(this->rng());
+        ASSERT_TRUE(result);
+        ASSERT_EQ(2, result.secondaries.size());
+        const auto& electron = result.secondaries.front();
+        eps.push_back(electron.energy.value() / 100);
+        costheta.push_back(electron.direction[2]);
+    }
+
+    // Moments of the electron distribution from a 100 MeV photon in copper
+    this->check_mean(eps, 0.49940413, 0.29586403);
+    this->check_mean(costheta, 0.99543767, 0.042218793);
+}
+
+TEST_F(BetheHeitlerInteractorTest, TEST_IF_CELERITAS_DOUBLE(stress_test))
 {
     RandomEngine& rng_engine = this->rng();
 
@@ -194,7 +223,7 @@ TEST_F(BetheHeitlerInteractorTest, stress_test)
     std::vector<double> avg_engine_samples;
 
     // Loop over a set of incident gamma energies
-    for (double inc_e : {1.5, 5.0, 10.0, 50.0, 100.0})
+    for (real_type inc_e : {1.5, 5.0, 10.0, 50.0, 100.0})
     {
         SCOPED_TRACE("Incident energy: " + std::to_string(inc_e));
         this->set_inc_particle(pdg::gamma(), MevEnergy{inc_e});
@@ -208,10 +237,10 @@ TEST_F(BetheHeitlerInteractorTest, stress_test)
             this->set_inc_direction(inc_dir);
             this->resize_secondaries(2 * num_samples);
 
-            // Get the ElementView
-            const celeritas::ElementView element(
-                this->material_track().material_view().element_view(
-                    celeritas::ElementComponentId{0}));
+            // Get the element ID
+            const celeritas::ElementId element
+                = this->material_track().material_view().element_id(
+                    celeritas::ElementComponentId{0});
 
             // Create interactor
             BetheHeitlerInteractor interact(pointers_,
@@ -244,7 +273,8 @@ TEST_F(BetheHeitlerInteractorTest, stress_test)
 // TODO: Test all models for a given process?
 TEST_F(BetheHeitlerInteractorTest, model)
 {
-    GammaConversionProcess process(this->get_particle_params());
+    GammaConversionProcess process(this->get_particle_params(),
+                                   this->get_material_params());
     ModelIdGenerator       next_id;
 
     // Construct the models associated with gamma annihilation
@@ -263,4 +293,11 @@ TEST_F(BetheHeitlerInteractorTest, model)
     EXPECT_EQ(ParticleId{2}, applic.particle);
     EXPECT_EQ(celeritas::units::MevEnergy{1.5}, applic.lower);
     EXPECT_EQ(celeritas::units::MevEnergy{1e5}, applic.upper);
+
+    // Check precalculated element data for copper
+    ASSERT_EQ(1, pointers_.elements.size());
+    const auto& cu = pointers_.elements.front();
+    EXPECT_SOFT_EQ(44.2662680043228, cu.screening_factor);
+    EXPECT_SOFT_EQ(0.0518403919961882, cu.coulomb_correction);
+    EXPECT_SOFT_EQ(153.766304277658, cu.delta_max);
 }
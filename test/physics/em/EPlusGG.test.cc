@@ -115,7 +115,7 @@ class EPlusGGInteractorTest : public celeritas_test::InteractorHostTestBase
 // TESTS
 //---------------------------------------------------------------------------//
 
-TEST_F(EPlusGGInteractorTest, basic)
+TEST_F(EPlusGGInteractorTest, TEST_IF_CELERITAS_DOUBLE(basic))
 {
     const int num_samples = 4;
 
@@ -211,14 +211,40 @@ TEST_F(EPlusGGInteractorTest, at_rest)
     }
 }
 
-TEST_F(EPlusGGInteractorTest, stress_test)
+TEST_F(EPlusGGInteractorTest, reference_moments)
+{
+    const int num_samples = 10000;
+    this->resize_secondaries(2 * num_samples);
+    EPlusGGInteractor interact(pointers_,
+                               this->particle_track(),
+                               this->direction(),
+                               this->secondary_allocator());
+
+    std::vector<real_type> eps;
+    std::vector<real_type> costheta;
+    for (CELER_MAYBE_UNUSED int i : celeritas::range(num_samples))
+    {
+        Interaction result = interact(this->rng());
+        ASSERT_TRUE(result);
+        ASSERT_EQ(2, result.secondaries.size());
+        const auto& gamma = result.secondaries.front();
+        eps.push_back(gamma.energy.value() / 10);
+        costheta.push_back(gamma.direction[2]);
+    }
+
+    // Moments of the first annihilation photon from a 10 MeV positron
+    this->check_mean(eps, 0.61904113, 0.2782);
+    this->check_mean(costheta, 0.91390633, 0.18899286);
+}
+
+TEST_F(EPlusGGInteractorTest, TEST_IF_CELERITAS_DOUBLE(stress_test))
 {
     RandomEngine& rng_engine = this->rng();
 
     const int           num_samples = 8192;
     std::vector<double> avg_engine_samples;
 
-    for (double inc_e : {0.0, 0.01, 1.0, 10.0, 1000.0})
+    for (real_type inc_e : {0.0, 0.01, 1.0, 10.0, 1000.0})
     {
         SCOPED_TRACE("Incident energy: " + std::to_string(inc_e));
         this->set_inc_particle(pdg::positron(), MevEnergy{inc_e});
@@ -261,7 +287,7 @@ TEST_F(EPlusGGInteractorTest, stress_test)
     EXPECT_VEC_SOFT_EQ(expected_avg_engine_samples, avg_engine_samples);
 }
 
-TEST_F(EPlusGGInteractorTest, macro_xs)
+TEST_F(EPlusGGInteractorTest, TEST_IF_CELERITAS_DOUBLE(macro_xs))
 {
     using celeritas::units::MevEnergy;
 
@@ -282,7 +308,7 @@ TEST_F(EPlusGGInteractorTest, macro_xs)
     {
         double e = std::exp(loge);
         energy.push_back(e);
-        macro_xs.push_back(calc_macro_xs(MevEnergy{e}));
+        macro_xs.push_back(calc_macro_xs(MevEnergy{real_type(e)}));
         loge += delta;
     }
     const double expected_macro_xs[]
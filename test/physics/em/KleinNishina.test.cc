@@ -7,14 +7,17 @@
 //---------------------------------------------------------------------------//
 #include "physics/em/detail/KleinNishinaInteractor.hh"
 
+#include <cmath>
 #include "celeritas_test.hh"
 #include "base/ArrayUtils.hh"
 #include "base/Range.hh"
 #include "physics/base/Units.hh"
+#include "physics/em/KleinNishinaModel.hh"
 #include "../InteractorHostTestBase.hh"
 #include "../InteractionIO.hh"
 
 using celeritas::detail::KleinNishinaInteractor;
+using celeritas::zero_quantity;
 namespace pdg = celeritas::pdg;
 
 //---------------------------------------------------------------------------//
@@ -86,7 +89,7 @@ class KleinNishinaInteractorTest : public celeritas_test::InteractorHostTestBase
 // TESTS
 //---------------------------------------------------------------------------//
 
-TEST_F(KleinNishinaInteractorTest, ten_mev)
+TEST_F(KleinNishinaInteractorTest, TEST_IF_CELERITAS_DOUBLE(ten_mev))
 {
     // Reserve 4 secondaries
     this->resize_secondaries(4);
@@ -95,7 +98,8 @@ TEST_F(KleinNishinaInteractorTest, ten_mev)
     KleinNishinaInteractor interact(pointers_,
                                     this->particle_track(),
                                     this->direction(),
-                                    this->secondary_allocator());
+                                    this->secondary_allocator(),
+                                    zero_quantity());
     RandomEngine&          rng_engine = this->rng();
 
     std::vector<double> energy;
@@ -146,14 +150,77 @@ TEST_F(KleinNishinaInteractorTest, ten_mev)
     }
 }
 
-TEST_F(KleinNishinaInteractorTest, stress_test)
+TEST_F(KleinNishinaInteractorTest, TEST_IF_CELERITAS_DOUBLE(production_cut))
+{
+    this->resize_secondaries(4);
+
+    // Electrons below 1 MeV should be deposited locally
+    KleinNishinaInteractor interact(pointers_,
+                                    this->particle_track(),
+                                    this->direction(),
+                                    this->secondary_allocator(),
+                                    MevEnergy{1.0});
+    RandomEngine&          rng_engine = this->rng();
+
+    std::vector<double> energy_electron;
+    std::vector<double> energy_deposition;
+    for (CELER_MAYBE_UNUSED int i : celeritas::range(4))
+    {
+        Interaction result = interact(rng_engine);
+        SCOPED_TRACE(result);
+        ASSERT_TRUE(result);
+        this->check_energy_conservation(result);
+        energy_electron.push_back(
+            result.secondaries.empty()
+                ? 0
+                : result.secondaries.front().energy.value());
+        energy_deposition.push_back(result.energy_deposition.value());
+    }
+
+    // The sub-threshold electron was never allocated
+    EXPECT_EQ(3, this->secondary_allocator().get().size());
+
+    // Same samples as the ten_mev test
+    const double expected_energy_electron[]
+        = {9.541849736377, 8.674147490143, 0, 9.474970218303};
+    const double expected_energy_deposition[] = {0, 0, 0.1627494285554, 0};
+    EXPECT_VEC_SOFT_EQ(expected_energy_electron, energy_electron);
+    EXPECT_VEC_SOFT_EQ(expected_energy_deposition, energy_deposition);
+}
+
+TEST_F(KleinNishinaInteractorTest, reference_moments)
+{
+    const int num_samples = 10000;
+    this->resize_secondaries(num_samples);
+    KleinNishinaInteractor interact(pointers_,
+                                    this->particle_track(),
+                                    this->direction(),
+                                    this->secondary_allocator(),
+                                    zero_quantity());
+
+    std::vector<real_type> eps;
+    std::vector<real_type> costheta;
+    for (CELER_MAYBE_UNUSED int i : celeritas::range(num_samples))
+    {
+        Interaction result = interact(this->rng());
+        ASSERT_TRUE(result);
+        eps.push_back(result.energy.value() / 10);
+        costheta.push_back(result.direction[2]);
+    }
+
+    // Moments of the 10 MeV scattered photon distribution
+    this->check_mean(eps, 0.3160727, 0.28855561);
+    this->check_mean(costheta, 0.55954576, 0.52046205);
+}
+
+TEST_F(KleinNishinaInteractorTest, TEST_IF_CELERITAS_DOUBLE(stress_test))
 {
     RandomEngine& rng_engine = this->rng();
 
     const int           num_samples = 8192;
     std::vector<double> avg_engine_samples;
 
-    for (double inc_e : {0.01, 1.0, 10.0, 1000.0})
+    for (real_type inc_e : {0.01, 1.0, 10.0, 1000.0})
     {
         SCOPED_TRACE("Incident energy: " + std::to_string(inc_e));
         this->set_inc_particle(pdg::gamma(), MevEnergy{inc_e});
@@ -172,7 +239,8 @@ TEST_F(KleinNishinaInteractorTest, stress_test)
             KleinNishinaInteractor interact(pointers_,
                                             this->particle_track(),
                                             this->direction(),
-                                            this->secondary_allocator());
+                                            this->secondary_allocator(),
+                                            zero_quantity());
 
             // Loop over many particles
             for (int i = 0; i < num_samples; ++i)
@@ -196,13 +264,13 @@ TEST_F(KleinNishinaInteractorTest, stress_test)
     EXPECT_VEC_SOFT_EQ(expected_avg_engine_samples, avg_engine_samples);
 }
 
-TEST_F(KleinNishinaInteractorTest, distributions)
+TEST_F(KleinNishinaInteractorTest, TEST_IF_CELERITAS_DOUBLE(distributions))
 {
     RandomEngine& rng_engine = this->rng();
 
-    const int    num_samples   = 10000;
-    const double inc_energy    = 1;
-    Real3        inc_direction = {0, 0, 1};
+    const int       num_samples   = 10000;
+    const real_type inc_energy    = 1;
+    Real3           inc_direction = {0, 0, 1};
     this->set_inc_particle(pdg::gamma(), MevEnergy{inc_energy});
     this->set_inc_direction(inc_direction);
     this->resize_secondaries(num_samples);
@@ -211,7 +279,8 @@ TEST_F(KleinNishinaInteractorTest, distributions)
     KleinNishinaInteractor interact(pointers_,
                                     this->particle_track(),
                                     this->direction(),
-                                    this->secondary_allocator());
+                                    this->secondary_allocator(),
+                                    zero_quantity());
 
     int              nbins = 10;
     std::vector<int> eps_dist(nbins);
@@ -247,3 +316,60 @@ TEST_F(KleinNishinaInteractorTest, distributions)
     EXPECT_VEC_EQ(expected_eps_dist, eps_dist);
     EXPECT_VEC_EQ(expected_costheta_dist, costheta_dist);
 }
+
+TEST_F(KleinNishinaInteractorTest, TEST_IF_CELERITAS_DOUBLE(tabulated))
+{
+    RandomEngine& rng_engine = this->rng();
+
+    celeritas::KleinNishinaModel model(
+        celeritas::ModelId{0}, this->particle_params(), true);
+    const auto tab_pointers = model.host_pointers();
+    ASSERT_TRUE(tab_pointers.epsilon_table);
+
+    const int num_samples = 100000;
+    const int nbins       = 10;
+    this->resize_secondaries(2 * num_samples);
+
+    // Histogram log(epsilon) / log(epsilon_0), which is in [0, 1]
+    auto sample_dist = [&](const celeritas::detail::KleinNishinaPointers& ptr,
+                           double inc_energy) {
+        KleinNishinaInteractor interact(ptr,
+                                        this->particle_track(),
+                                        this->direction(),
+                                        this->secondary_allocator(),
+                                        zero_quantity());
+        const double log_eps0 = -std::log(
+            1 + 2 * inc_energy * pointers_.inv_electron_mass);
+        std::vector<double> result(nbins);
+        for (CELER_MAYBE_UNUSED int i : celeritas::range(num_samples))
+        {
+            Interaction out = interact(rng_engine);
+            double scaled = std::log(out.energy.value() / inc_energy)
+                            / log_eps0;
+            int bin = std::min<int>(scaled * nbins, nbins - 1);
+            result[bin] += 1.0 / num_samples;
+        }
+        return result;
+    };
+
+    // Compare analytic and tabulated distributions, and check that the
+    // tabulated sampling uses exactly two random numbers per interaction
+    for (real_type inc_energy : {0.01, 0.0314, 1.0, 12.3, 1e3, 1e5, 1e9})
+    {
+        SCOPED_TRACE("Incident energy: " + std::to_string(inc_energy));
+        this->set_inc_particle(pdg::gamma(), MevEnergy{inc_energy});
+        this->resize_secondaries(2 * num_samples);
+
+        rng_engine.reset_count();
+        auto tab_dist = sample_dist(tab_pointers, inc_energy);
+        if (inc_energy < 1e8)
+        {
+            EXPECT_EQ(4 * num_samples, rng_engine.count());
+        }
+        auto ref_dist = sample_dist(pointers_, inc_energy);
+        for (auto i : celeritas::range(nbins))
+        {
+            EXPECT_NEAR(ref_dist[i], tab_dist[i], 0.01) << "in bin " << i;
+        }
+    }
+}
@@ -8,11 +8,13 @@
 #include "physics/em/detail/LivermorePEInteractor.hh"
 
 #include <cmath>
+#include <cstdlib>
 #include <fstream>
 #include <map>
 #include "celeritas_test.hh"
 #include "base/ArrayUtils.hh"
 #include "base/Range.hh"
+#include "base/Stopwatch.hh"
 #include "comm/Device.hh"
 #include "io/AtomicRelaxationReader.hh"
 #include "io/ImportPhysicsTable.hh"
@@ -26,8 +28,14 @@
 #include "physics/grid/XsCalculator.hh"
 #include "physics/grid/ValueGridBuilder.hh"
 #include "physics/grid/ValueGridInserter.hh"
+#include "physics/material/ElementCdfBuilder.hh"
+#include "physics/material/ElementSelector.hh"
 #include "physics/material/MaterialTrackView.hh"
+#include "physics/material/TabulatedElementSelector.hh"
+#include "physics/em/detail/LivermorePEMicroXsCalculator.hh"
 #include "physics/em/detail/Utils.hh"
+#include "random/distributions/AliasSampler.hh"
+#include "random/distributions/GenerateCanonical.hh"
 #include "../InteractorHostTestBase.hh"
 #include "../InteractionIO.hh"
 
@@ -45,6 +53,7 @@ using celeritas::PhotoelectricProcess;
 using celeritas::SubshellId;
 using celeritas::ValueGridInserter;
 using celeritas::detail::LivermorePEInteractor;
+using celeritas::zero_quantity;
 namespace pdg = celeritas::pdg;
 
 //---------------------------------------------------------------------------//
@@ -168,7 +177,7 @@ class LivermorePEInteractorTest : public celeritas_test::InteractorHostTestBase
 // TESTS
 //---------------------------------------------------------------------------//
 
-TEST_F(LivermorePEInteractorTest, basic)
+TEST_F(LivermorePEInteractorTest, TEST_IF_CELERITAS_DOUBLE(basic))
 {
     RandomEngine& rng_engine = this->rng();
 
@@ -183,7 +192,8 @@ TEST_F(LivermorePEInteractorTest, basic)
                                    el_id,
                                    this->particle_track(),
                                    this->direction(),
-                                   this->secondary_allocator());
+                                   this->secondary_allocator(),
+                                   zero_quantity());
 
     std::vector<double> energy_electron;
     std::vector<double> costheta_electron;
@@ -226,7 +236,7 @@ TEST_F(LivermorePEInteractorTest, basic)
     }
 }
 
-TEST_F(LivermorePEInteractorTest, stress_test)
+TEST_F(LivermorePEInteractorTest, TEST_IF_CELERITAS_DOUBLE(stress_test))
 {
     RandomEngine& rng_engine = this->rng();
 
@@ -235,7 +245,7 @@ TEST_F(LivermorePEInteractorTest, stress_test)
 
     ElementId el_id{0};
 
-    for (double inc_e : {0.0001, 0.01, 1.0, 10.0, 1000.0})
+    for (real_type inc_e : {0.0001, 0.01, 1.0, 10.0, 1000.0})
     {
         SCOPED_TRACE("Incident energy: " + std::to_string(inc_e));
         this->set_inc_particle(pdg::gamma(), MevEnergy{inc_e});
@@ -255,7 +265,8 @@ TEST_F(LivermorePEInteractorTest, stress_test)
                                            el_id,
                                            this->particle_track(),
                                            this->direction(),
-                                           this->secondary_allocator());
+                                           this->secondary_allocator(),
+                                           zero_quantity());
 
             // Loop over many particles
             for (int i = 0; i < num_samples; ++i)
@@ -278,7 +289,7 @@ TEST_F(LivermorePEInteractorTest, stress_test)
     EXPECT_VEC_SOFT_EQ(expected_avg_engine_samples, avg_engine_samples);
 }
 
-TEST_F(LivermorePEInteractorTest, distributions_all)
+TEST_F(LivermorePEInteractorTest, TEST_IF_CELERITAS_DOUBLE(distributions_all))
 {
     RandomEngine& rng_engine = this->rng();
 
@@ -312,7 +323,8 @@ TEST_F(LivermorePEInteractorTest, distributions_all)
                                    el_id,
                                    this->particle_track(),
                                    this->direction(),
-                                   this->secondary_allocator());
+                                   this->secondary_allocator(),
+                                   zero_quantity());
 
     int                   nbins           = 10;
     int                   num_secondaries = 0;
@@ -347,7 +359,7 @@ TEST_F(LivermorePEInteractorTest, distributions_all)
     }
     EXPECT_EQ(max_secondary * num_samples,
               this->secondary_allocator().get().size());
-    EXPECT_EQ(2180, num_secondaries);
+    EXPECT_EQ(2165, num_secondaries);
 
     for (const auto& it : energy_to_count)
     {
@@ -355,24 +367,25 @@ TEST_F(LivermorePEInteractorTest, distributions_all)
         count.push_back(it.second);
     }
     const double expected_costheta_dist[]
-        = {23, 61, 83, 129, 135, 150, 173, 134, 85, 27};
+        = {24, 54, 90, 126, 145, 146, 167, 135, 87, 26};
     const double expected_energy[] = {
         2.901e-05,  3.202e-05,  4.576e-05,  4.604e-05,  4.877e-05,  4.905e-05,
-        6.529e-05,  6.83e-05,   0.00021764, 0.00022065, 0.00023439, 0.00023467,
-        0.0002374,  0.00023768, 0.00025114, 0.00025142, 0.0002517,  0.00025392,
-        0.00025415, 0.00025443, 0.00025471, 0.00027095, 0.00027368, 0.00029016,
-        0.00030691, 0.00030719, 0.00034347, 0.00062884, 0.00069835, 0.00070136,
+        6.529e-05,  6.83e-05,   7.252e-05,  0.00021764, 0.00022065, 0.00023439,
+        0.00023467, 0.0002374,  0.00023768, 0.00025114, 0.00025142, 0.0002517,
+        0.00025415, 0.00025443, 0.00025471, 0.00027095, 0.00027368, 0.00027396,
+        0.00029016, 0.00030691, 0.00030719, 0.00062884, 0.00069835, 0.00070136,
         0.0009595,  0.00097625, 0.00097653,
     };
     const int expected_count[] = {
-        42, 80, 26,  24, 27, 54, 2, 5, 5,  5, 4,   141, 61,  3,  2,  169, 260,
-        1,  39, 195, 2,  8,  5,  3, 2, 14, 1, 280, 216, 424, 32, 16, 32};
+        37,  83, 19,  32, 22, 57, 1, 4, 1, 5,  4,   5,   137, 61, 3,  4,  166,
+        256, 53, 176, 6,  8,  4,  1, 3, 7, 10, 276, 219, 414, 33, 24, 34};
     EXPECT_VEC_EQ(expected_costheta_dist, costheta_dist);
     EXPECT_VEC_SOFT_EQ(expected_energy, energy);
     EXPECT_VEC_EQ(expected_count, count);
 }
 
-TEST_F(LivermorePEInteractorTest, distributions_radiative)
+TEST_F(LivermorePEInteractorTest,
+       TEST_IF_CELERITAS_DOUBLE(distributions_radiative))
 {
     RandomEngine& rng_engine = this->rng();
 
@@ -404,7 +417,8 @@ TEST_F(LivermorePEInteractorTest, distributions_radiative)
                                    el_id,
                                    this->particle_track(),
                                    this->direction(),
-                                   this->secondary_allocator());
+                                   this->secondary_allocator(),
+                                   zero_quantity());
 
     int                   num_secondaries = 0;
     std::map<double, int> energy_to_count;
@@ -428,7 +442,7 @@ TEST_F(LivermorePEInteractorTest, distributions_radiative)
     }
     EXPECT_EQ(max_secondary * num_samples,
               this->secondary_allocator().get().size());
-    EXPECT_EQ(10007, num_secondaries);
+    EXPECT_EQ(10008, num_secondaries);
 
     for (const auto& it : energy_to_count)
     {
@@ -437,10 +451,9 @@ TEST_F(LivermorePEInteractorTest, distributions_radiative)
     }
     const double expected_energy[] = {
         6.951e-05,
+        7.252e-05,
         0.00025814,
         0.00026115,
-        0.00034741,
-        0.00034769,
         0.00062884,
         0.00069835,
         0.00070136,
@@ -450,11 +463,92 @@ TEST_F(LivermorePEInteractorTest, distributions_radiative)
         0.00099578,
     };
     const int expected_count[]
-        = {2, 1, 1, 1, 2, 2525, 2228, 4358, 337, 181, 361, 10};
+        = {2, 2, 1, 3, 2525, 2228, 4357, 337, 182, 361, 10};
     EXPECT_VEC_SOFT_EQ(expected_energy, energy);
     EXPECT_VEC_EQ(expected_count, count);
 }
 
+TEST_F(LivermorePEInteractorTest, production_cut)
+{
+    RandomEngine& rng_engine  = this->rng();
+    const int     num_samples = 1000;
+    ElementId     el_id{0};
+
+    // Suppress L-shell photoelectrons (0.629 keV) but not M-shell (~0.7 keV)
+    const MevEnergy electron_cut{0.00065};
+    {
+        // Without relaxation, suppressed photoelectrons are never allocated
+        this->resize_secondaries(num_samples);
+        LivermorePEInteractor interact(pointers_,
+                                       el_id,
+                                       this->particle_track(),
+                                       this->direction(),
+                                       this->secondary_allocator(),
+                                       electron_cut);
+
+        int num_emitted = 0;
+        for (CELER_MAYBE_UNUSED int i : celeritas::range(num_samples))
+        {
+            Interaction out = interact(rng_engine);
+            SCOPED_TRACE(out);
+            ASSERT_TRUE(out);
+            this->check_energy_conservation(out);
+            if (out.secondaries.empty())
+            {
+                EXPECT_SOFT_EQ(this->particle_track().energy().value(),
+                               out.energy_deposition.value());
+            }
+            else
+            {
+                ASSERT_EQ(1, out.secondaries.size());
+                EXPECT_LE(electron_cut, out.secondaries.front().energy);
+                ++num_emitted;
+            }
+        }
+        EXPECT_EQ(num_emitted, this->secondary_allocator().get().size());
+        EXPECT_LT(0, num_emitted);
+        EXPECT_GT(num_samples, num_emitted);
+    }
+    {
+        // With relaxation, the suppressed photoelectron slot is left null
+        relax_inp_.is_auger_enabled = false;
+        set_relaxation_params(relax_inp_);
+        pointers_.atomic_relaxation = relax_params_->host_pointers();
+        const auto& el_relax = pointers_.atomic_relaxation.elements[0];
+        vacancies_.resize(num_samples * el_relax.max_stack_size);
+        pointers_.vacancies = vacancies_.host_pointers();
+        this->resize_secondaries(num_samples * (el_relax.max_secondary + 1));
+
+        LivermorePEInteractor interact(pointers_,
+                                       el_id,
+                                       this->particle_track(),
+                                       this->direction(),
+                                       this->secondary_allocator(),
+                                       electron_cut);
+
+        int num_suppressed = 0;
+        for (CELER_MAYBE_UNUSED int i : celeritas::range(num_samples))
+        {
+            Interaction out = interact(rng_engine);
+            SCOPED_TRACE(out);
+            ASSERT_TRUE(out);
+            ASSERT_FALSE(out.secondaries.empty());
+            this->check_energy_conservation(out);
+            const auto& photoelectron = out.secondaries.front();
+            if (!photoelectron)
+            {
+                EXPECT_EQ(0, photoelectron.energy.value());
+                ++num_suppressed;
+            }
+            else
+            {
+                EXPECT_LE(electron_cut, photoelectron.energy);
+            }
+        }
+        EXPECT_LT(0, num_suppressed);
+    }
+}
+
 TEST_F(LivermorePEInteractorTest, model)
 {
     using celeritas::Collection;
@@ -484,6 +578,7 @@ TEST_F(LivermorePEInteractorTest, model)
     auto vacancies = std::make_shared<celeritas::SubshellIdAllocatorStore>(10);
 
     PhotoelectricProcess process(this->get_particle_params(),
+                                 this->get_material_params(),
                                  xs_lo,
                                  xs_hi,
                                  livermore_params_,
@@ -496,7 +591,7 @@ TEST_F(LivermorePEInteractorTest, model)
                            celeritas::max_quantity()};
     auto          builders = process.step_limits(range);
 
-    Collection<double, Ownership::value, MemSpace::host> real_storage;
+    Collection<real_type, Ownership::value, MemSpace::host> real_storage;
     Collection<celeritas::XsGridData, Ownership::value, MemSpace::host>
         grid_storage;
 
@@ -505,8 +600,8 @@ TEST_F(LivermorePEInteractorTest, model)
     EXPECT_EQ(1, grid_storage.size());
 
     // Test cross sections calculated from tables
-    Collection<double, Ownership::const_reference, MemSpace::host> real_ref{
-        real_storage};
+    Collection<real_type, Ownership::const_reference, MemSpace::host>
+        real_ref{real_storage};
     celeritas::XsCalculator calc_xs(
         grid_storage[ValueGridInserter::XsIndex{0}], real_ref);
     EXPECT_SOFT_EQ(0.1, calc_xs(MevEnergy{1e-3}));
@@ -521,6 +616,15 @@ TEST_F(LivermorePEInteractorTest, model)
     auto livermore_pe = models.front();
     EXPECT_EQ(ModelId{0}, livermore_pe->model_id());
 
+    // Element selection tables are built for every material
+    auto pe_model
+        = std::dynamic_pointer_cast<const celeritas::LivermorePEModel>(
+            livermore_pe);
+    ASSERT_TRUE(pe_model);
+    const auto& element_cdf = pe_model->host_element_cdf();
+    ASSERT_EQ(1, element_cdf.materials.size());
+    EXPECT_EQ(1, element_cdf.materials[MaterialId{0}].num_elements);
+
     // Get the particle types and energy ranges this model applies to
     auto set_applic = livermore_pe->applicability();
     EXPECT_EQ(1, set_applic.size());
@@ -532,7 +636,379 @@ TEST_F(LivermorePEInteractorTest, model)
     EXPECT_EQ(celeritas::max_quantity(), applic.upper);
 }
 
-TEST_F(LivermorePEInteractorTest, macro_xs)
+TEST_F(LivermorePEInteractorTest, tabulated_subshell)
+{
+    RandomEngine& rng_engine = this->rng();
+
+    // Construct data without subshell selection tables
+    LivermorePEParams::Input li;
+    LivermorePEParamsReader  read_element_data(
+        this->test_data_path("physics/em", "").c_str());
+    li.elements.push_back(read_element_data(19));
+    li.shell_cdf_per_decade = 0;
+    LivermorePEParams otf_params(li);
+    EXPECT_TRUE(otf_params.host_pointers().elements[0].shell_cdfs.empty());
+
+    // Check table sizes
+    const auto& el = livermore_params_->host_pointers().elements[0];
+    ASSERT_EQ(el.shells.size() - 1, el.shell_cdfs.size());
+    std::vector<int> grid_sizes;
+    for (const auto& shell_cdf : el.shell_cdfs)
+    {
+        grid_sizes.push_back(shell_cdf.log_energy.size);
+    }
+    const int expected_grid_sizes[] = {374, 51, 6, 2, 45, 13, 2};
+    EXPECT_VEC_EQ(expected_grid_sizes, grid_sizes);
+
+    celeritas::detail::LivermorePEPointers otf_pointers = pointers_;
+    otf_pointers.data = otf_params.host_pointers();
+
+    // Sample the subshell (from the deposited binding energy) with and
+    // without the tables
+    const int num_samples = 10000;
+    auto      sample_shells
+        = [&](const celeritas::detail::LivermorePEPointers& pointers) {
+              this->resize_secondaries(num_samples);
+              LivermorePEInteractor interact(pointers,
+                                             ElementId{0},
+                                             this->particle_track(),
+                                             this->direction(),
+                                             this->secondary_allocator(),
+                                             zero_quantity());
+              std::map<double, int> binding_to_count;
+              for (int i = 0; i < num_samples; ++i)
+              {
+                  Interaction out = interact(rng_engine);
+                  this->check_energy_conservation(out);
+                  ++binding_to_count[out.energy_deposition.value()];
+              }
+              return binding_to_count;
+          };
+
+    for (real_type inc_e : {0.0001, 0.001, 0.0036, 0.00361, 0.005, 0.1, 1e6})
+    {
+        SCOPED_TRACE("Incident energy: " + std::to_string(inc_e));
+        this->set_inc_particle(pdg::gamma(), MevEnergy{inc_e});
+
+        auto tab_count = sample_shells(pointers_);
+        auto otf_count = sample_shells(otf_pointers);
+
+        // Sampled subshell frequencies should agree to about three standard
+        // deviations
+        std::map<double, int> all_count = otf_count;
+        all_count.insert(tab_count.begin(), tab_count.end());
+        for (const auto& it : all_count)
+        {
+            EXPECT_NEAR(double(otf_count[it.first]) / num_samples,
+                        double(tab_count[it.first]) / num_samples,
+                        0.015)
+                << "for binding energy " << it.first;
+        }
+    }
+}
+
+TEST_F(LivermorePEInteractorTest, element_selection)
+{
+    using celeritas::ElementCdfBuilder;
+    using celeritas::ElementComponentId;
+    using celeritas::ElementSelector;
+    using celeritas::MatterState;
+    using celeritas::TabulatedElementSelector;
+    using celeritas::detail::LivermorePEMicroXsCalculator;
+    using celeritas::units::AmuMass;
+    RandomEngine& rng_engine = this->rng();
+
+    // Add a second element whose energy scale is twice that of potassium, so
+    // that its K edge is at ~7.2 keV rather than ~3.6 keV. The cross sections
+    // and fit parameters are scaled so that xs'(2 E) = xs(E) / 8.
+    const real_type          scale = 2;
+    LivermorePEParams::Input li;
+    LivermorePEParamsReader  read_element_data(
+        this->test_data_path("physics/em", "").c_str());
+    li.elements.push_back(read_element_data(19));
+    li.elements.push_back(li.elements.front());
+    auto& scaled = li.elements.back();
+    for (auto* grid : {&scaled.xs_low, &scaled.xs_high})
+    {
+        for (real_type& e : grid->x)
+            e *= scale;
+    }
+    scaled.thresh_low  = MevEnergy{scale * scaled.thresh_low.value()};
+    scaled.thresh_high = MevEnergy{scale * scaled.thresh_high.value()};
+    for (auto& shell : scaled.shells)
+    {
+        shell.binding_energy = MevEnergy{scale * shell.binding_energy.value()};
+        for (real_type& e : shell.energy)
+            e *= scale;
+        for (auto* param : {&shell.param_low, &shell.param_high})
+        {
+            for (auto i : celeritas::range(param->size()))
+                (*param)[i] *= std::pow(scale, real_type(i) - 2);
+        }
+    }
+    const real_type k_edge = li.elements[0].shells[0].binding_energy.value();
+    const real_type scaled_k_edge = scaled.shells[0].binding_energy.value();
+    set_livermore_params(li);
+    pointers_.data = livermore_params_->host_pointers();
+
+    MaterialParams::Input mi;
+    mi.elements  = {{19, AmuMass{39.0983}, "K"}, {19, AmuMass{39.0983}, "K2"}};
+    mi.materials = {{1e-5 * celeritas::constants::na_avogadro,
+                     293.,
+                     MatterState::solid,
+                     {{ElementId{0}, 0.5}, {ElementId{1}, 0.5}},
+                     "KK2"}};
+    this->set_material_params(mi);
+    this->set_material("KK2");
+
+    // Tabulate the selection probabilities the same way as the model
+    ElementCdfBuilder build_cdf(
+        this->material_params(), [this](ElementId el_id, MevEnergy energy) {
+            return LivermorePEMicroXsCalculator{pointers_, energy}(el_id);
+        });
+    ElementCdfBuilder::HostValue host_cdf;
+    build_cdf(celeritas::UniformGridData::from_bounds(
+                  std::log(1e-5), std::log(1e5), 201),
+              &host_cdf);
+    celeritas::ElementCdfData<celeritas::Ownership::const_reference,
+                              celeritas::MemSpace::host>
+        cdf_ref;
+    cdf_ref = host_cdf;
+
+    // Sample below both K edges, between them, and above both. The energies
+    // avoid the grid cells that contain an edge, where linear interpolation
+    // of the CDF smears the step.
+    const real_type inc_energies[] = {0.001, 0.003, 0.005, 0.006, 0.01, 0.1};
+    const auto&     material = this->material_track().material_view();
+    std::vector<real_type> storage(material.num_elements());
+    std::vector<real_type> probs;
+    const int              num_samples = 10000;
+    for (real_type inc_e : inc_energies)
+    {
+        SCOPED_TRACE("Incident energy: " + std::to_string(inc_e));
+
+        // Exact probability of selecting the scaled element
+        LivermorePEMicroXsCalculator calc_micro_xs{pointers_,
+                                                   MevEnergy{inc_e}};
+        const real_type              xs_k  = calc_micro_xs(ElementId{0});
+        const real_type              xs_k2 = calc_micro_xs(ElementId{1});
+        const real_type              prob  = xs_k2 / (xs_k + xs_k2);
+        probs.push_back(prob);
+
+        ElementSelector select_otf(
+            material, calc_micro_xs, celeritas::make_span(storage));
+        TabulatedElementSelector select_tab(
+            cdf_ref, MaterialId{0}, MevEnergy{inc_e});
+
+        int otf_count = 0;
+        int tab_count = 0;
+        for (CELER_MAYBE_UNUSED int i : celeritas::range(num_samples))
+        {
+            otf_count += (select_otf(rng_engine) == ElementComponentId{1});
+            tab_count += (select_tab(rng_engine) == ElementComponentId{1});
+        }
+        EXPECT_NEAR(prob, double(otf_count) / num_samples, 0.015);
+        EXPECT_NEAR(prob, double(tab_count) / num_samples, 0.015);
+    }
+
+    // The selection probability changes across each edge: only potassium
+    // has its K shell open between the edges
+    EXPECT_LT(inc_energies[1], k_edge);
+    EXPECT_LT(k_edge, inc_energies[2]);
+    EXPECT_LT(inc_energies[3], scaled_k_edge);
+    EXPECT_LT(scaled_k_edge, inc_energies[4]);
+    EXPECT_GT(probs[1] - probs[2], 0.2);
+    EXPECT_GT(probs[4] - probs[3], 0.2);
+}
+
+TEST_F(LivermorePEInteractorTest, tabulated_subshell_high_z)
+{
+    RandomEngine& rng_engine = this->rng();
+
+    // High-Z elements have the most subshells to search: use them if the
+    // Geant4 data are available, and otherwise potassium
+    std::vector<std::string> labels;
+    LivermorePEParams::Input li;
+    if (std::getenv("G4LEDATA"))
+    {
+        LivermorePEParamsReader read_element_data;
+        li.elements.push_back(read_element_data(74));
+        li.elements.push_back(read_element_data(82));
+        labels = {"W", "Pb"};
+    }
+    else
+    {
+        LivermorePEParamsReader read_element_data(
+            this->test_data_path("physics/em", "").c_str());
+        li.elements.push_back(read_element_data(19));
+        labels = {"K"};
+    }
+    LivermorePEParams tab_params(li);
+    li.shell_cdf_per_decade = 0;
+    LivermorePEParams otf_params(li);
+
+    celeritas::detail::LivermorePEPointers tab_pointers = pointers_;
+    tab_pointers.data = tab_params.host_pointers();
+    celeritas::detail::LivermorePEPointers otf_pointers = pointers_;
+    otf_pointers.data = otf_params.host_pointers();
+
+    // Sample and time interactions, tallying the subshell binding energies
+    const int num_samples = 100000;
+    auto      sample_shells
+        = [&](const celeritas::detail::LivermorePEPointers& pointers,
+              ElementId                                     el_id,
+              std::map<double, int>*                        binding_to_count) {
+              this->resize_secondaries(num_samples);
+              LivermorePEInteractor interact(pointers,
+                                             el_id,
+                                             this->particle_track(),
+                                             this->direction(),
+                                             this->secondary_allocator(),
+                                             zero_quantity());
+              celeritas::Stopwatch get_time;
+              for (int i = 0; i < num_samples; ++i)
+              {
+                  Interaction out = interact(rng_engine);
+                  ++(*binding_to_count)[out.energy_deposition.value()];
+              }
+              return get_time();
+          };
+
+    cout << "Time for " << num_samples
+         << " interactions with tabulated and linear subshell sampling:\n";
+    for (auto el_id : celeritas::range(ElementId{labels.size()}))
+    {
+        for (real_type inc_e : {0.01, 0.07, 0.0881, 0.1, 1.0, 100.0})
+        {
+            SCOPED_TRACE(labels[el_id.get()] + " at incident energy "
+                         + std::to_string(inc_e));
+            this->set_inc_particle(pdg::gamma(), MevEnergy{inc_e});
+
+            std::map<double, int> tab_count;
+            std::map<double, int> otf_count;
+            double tab_time = sample_shells(tab_pointers, el_id, &tab_count);
+            double otf_time = sample_shells(otf_pointers, el_id, &otf_count);
+            cout << "  " << labels[el_id.get()] << " at " << inc_e
+                 << " MeV: tabulated " << tab_time << " s, linear "
+                 << otf_time << " s (speedup " << otf_time / tab_time
+                 << ")\n";
+
+            std::map<double, int> all_count = otf_count;
+            all_count.insert(tab_count.begin(), tab_count.end());
+            for (const auto& it : all_count)
+            {
+                EXPECT_NEAR(double(otf_count[it.first]) / num_samples,
+                            double(tab_count[it.first]) / num_samples,
+                            0.005)
+                    << "for binding energy " << it.first;
+            }
+        }
+    }
+    cout << std::flush;
+}
+
+TEST_F(LivermorePEInteractorTest, transition_alias)
+{
+    using celeritas::AliasSampler;
+    using celeritas::AtomicRelaxSubshell;
+
+    RandomEngine& rng_engine = this->rng();
+
+    // Use high-Z EADL data (with many more transitions per shell) if available
+    std::vector<int> atomic_numbers = {19};
+    if (std::getenv("G4LEDATA"))
+    {
+        AtomicRelaxationReader read_transition_data;
+        for (int z : {74, 82})
+        {
+            relax_inp_.elements.push_back(read_transition_data(z));
+            atomic_numbers.push_back(z);
+        }
+    }
+    relax_inp_.is_auger_enabled = true;
+    set_relaxation_params(relax_inp_);
+    auto relax = relax_params_->host_pointers();
+
+    // Previous implementation: walk the transition probabilities
+    auto sample_linear = [&rng_engine](const AtomicRelaxSubshell& shell) {
+        double prob = celeritas::generate_canonical(rng_engine);
+        celeritas::size_type i;
+        for (i = 0; i < shell.transitions.size(); ++i)
+        {
+            if ((prob -= shell.transitions[i].probability) <= 0)
+                break;
+        }
+        return i;
+    };
+
+    const int num_samples = 100000;
+    cout << "Time for " << num_samples
+         << " transitions per shell with linear and alias sampling:\n";
+    for (auto el_idx : celeritas::range(atomic_numbers.size()))
+    {
+        const auto& shells      = relax.elements[el_idx].shells;
+        double      linear_time = 0;
+        double      alias_time  = 0;
+        for (auto shell_idx : celeritas::range(shells.size()))
+        {
+            SCOPED_TRACE("Z=" + std::to_string(atomic_numbers[el_idx])
+                         + " shell " + std::to_string(shell_idx));
+            const AtomicRelaxSubshell& shell = shells[shell_idx];
+            ASSERT_LE(shell.transition_alias.size(),
+                      shell.transitions.size() + 1);
+
+            // Tally sampled transitions (the last bin is "no transition")
+            std::vector<int> linear_count(shell.transitions.size() + 1);
+            std::vector<int> alias_count(shell.transitions.size() + 1);
+
+            celeritas::Stopwatch get_linear_time;
+            for (CELER_MAYBE_UNUSED int i : celeritas::range(num_samples))
+            {
+                ++linear_count[sample_linear(shell)];
+            }
+            linear_time += get_linear_time();
+
+            celeritas::Stopwatch get_alias_time;
+            AliasSampler         sample_alias(shell.transition_alias);
+            for (CELER_MAYBE_UNUSED int i : celeritas::range(num_samples))
+            {
+                ++alias_count[sample_alias(rng_engine)];
+            }
+            alias_time += get_alias_time();
+
+            // Compare both against the exact probabilities (five standard
+            // deviations)
+            double remainder = 1;
+            for (auto i : celeritas::range(linear_count.size()))
+            {
+                double expected = remainder;
+                if (i < shell.transitions.size())
+                {
+                    expected = shell.transitions[i].probability;
+                    remainder -= expected;
+                }
+                expected   = std::fmax(expected, 0.0);
+                double tol = 5 * std::sqrt(expected * (1 - expected)
+                                           / num_samples)
+                             + 1e-4;
+                EXPECT_NEAR(expected,
+                            double(linear_count[i]) / num_samples,
+                            tol)
+                    << "for transition " << i;
+                EXPECT_NEAR(
+                    expected, double(alias_count[i]) / num_samples, tol)
+                    << "for transition " << i;
+            }
+        }
+        cout << "  Z=" << atomic_numbers[el_idx] << " (" << shells.size()
+             << " shells): linear " << linear_time << " s, alias "
+             << alias_time << " s (speedup " << linear_time / alias_time
+             << ")\n";
+    }
+    cout << std::flush;
+}
+
+TEST_F(LivermorePEInteractorTest, TEST_IF_CELERITAS_DOUBLE(macro_xs))
 {
     using celeritas::units::MevEnergy;
 
@@ -553,7 +1029,7 @@ TEST_F(LivermorePEInteractorTest, macro_xs)
     {
         double e = std::exp(loge);
         energy.push_back(e);
-        macro_xs.push_back(calc_macro_xs(MevEnergy{e}));
+        macro_xs.push_back(calc_macro_xs(MevEnergy{real_type(e)}));
         loge += delta;
     }
     const double expected_macro_xs[]
@@ -613,7 +1089,7 @@ TEST_F(LivermorePEInteractorTest, max_secondaries)
             {
                 transition_storage.push_back({SubshellId{j + 1},
                                               SubshellId{j + 1},
-                                              1. / (num_shells - i),
+                                              real_type(1) / (num_shells - i),
                                               1});
             }
             shells[i].transitions
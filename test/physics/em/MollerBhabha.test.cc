@@ -12,6 +12,7 @@
 #include "base/Range.hh"
 #include "base/Types.hh"
 #include "physics/base/Units.hh"
+#include "physics/em/MollerBhabhaModel.hh"
 #include "../InteractorHostTestBase.hh"
 #include "../InteractionIO.hh"
 #include "physics/material/MaterialTrackView.hh"
@@ -20,6 +21,7 @@ using celeritas::Action;
 using celeritas::dot_product;
 using celeritas::normalize_direction;
 using celeritas::detail::MollerBhabhaInteractor;
+using celeritas::zero_quantity;
 using celeritas::units::AmuMass;
 namespace constants = celeritas::constants;
 namespace pdg       = celeritas::pdg;
@@ -108,7 +110,7 @@ class MollerBhabhaInteractorTest : public celeritas_test::InteractorHostTestBase
 // TESTS
 //---------------------------------------------------------------------------//
 
-TEST_F(MollerBhabhaInteractorTest, basic)
+TEST_F(MollerBhabhaInteractorTest, TEST_IF_CELERITAS_DOUBLE(basic))
 {
     // Sample 4 Moller and 4 Bhabha interactors
     this->resize_secondaries(8);
@@ -153,7 +155,8 @@ TEST_F(MollerBhabhaInteractorTest, basic)
         MollerBhabhaInteractor m_interactor(pointers_,
                                             this->particle_track(),
                                             this->direction(),
-                                            this->secondary_allocator());
+                                            this->secondary_allocator(),
+                                            zero_quantity());
 
         Interaction m_result = m_interactor(rng_engine);
         this->sanity_check(m_result);
@@ -173,7 +176,8 @@ TEST_F(MollerBhabhaInteractorTest, basic)
         MollerBhabhaInteractor b_interactor(pointers_,
                                             this->particle_track(),
                                             this->direction(),
-                                            this->secondary_allocator());
+                                            this->secondary_allocator(),
+                                            zero_quantity());
 
         Interaction b_result = b_interactor(rng_engine);
         this->sanity_check(b_result);
@@ -191,29 +195,29 @@ TEST_F(MollerBhabhaInteractorTest, basic)
     //// Moller
     // Gold values based on the host rng. Energies are in MeV
     const double expected_m_inc_exit_cost[]
-        = {0.9981497250995, 0.999993612333, 0.999999995461, 0.9999999999998};
+        = {0.9997390091432, 0.9999843940341, 0.9999999989248, 0.9999999999996};
     const double expected_m_inc_exit_e[]
-        = {0.9927116916645, 9.998622388005, 999.9911084469, 99999.99528134};
+        = {0.998967933738, 9.996634923266, 999.9978936714, 99999.99205698};
     const double expected_m_inc_edep[] = {0, 0, 0, 0};
     const double expected_m_sec_cost[] = {
-        0.1196563201983, 0.03851909820188, 0.09291901073767, 0.06779325842364};
-    const double expected_m_sec_e[] = {0.007288308335526,
-                                       0.001377611995461,
-                                       0.008891553104294,
-                                       0.004718664979811};
+        0.04516478675154, 0.06014351876104, 0.04537459848843, 0.08781909857672};
+    const double expected_m_sec_e[] = {0.001032066262039,
+                                       0.003365076734037,
+                                       0.002106328600539,
+                                       0.007943023046458};
     //// Bhabha
     // Gold values based on the host rng. Energies are in MeV
     const double expected_b_inc_exit_cost[]
-        = {0.9997453107903, 0.999994190499, 0.9999999989865, 0.9999999999999};
+        = {0.9995380336341, 0.9999871668284, 0.9999999993789, 0.9999999999999};
     const double expected_b_inc_exit_e[]
-        = {0.9989928374838, 9.998747065072, 999.9980145461, 99999.99864983};
+        = {0.9981740941878, 9.997232660258, 999.9987833121, 99999.9982787};
     const double expected_b_inc_edep[] = {0, 0, 0, 0};
     const double expected_b_sec_cost[] = {
-        0.04461708949452, 0.03673697288345, 0.04405602044159, 0.03632326062515};
-    const double expected_b_sec_e[] = {0.001007162516187,
-                                       0.001252934927768,
-                                       0.001985453873814,
-                                       0.001350170413359};
+        0.06005054104938, 0.05455684039786, 0.03450071145031, 0.04100529317341};
+    const double expected_b_sec_e[] = {0.001825905812185,
+                                       0.002767339741643,
+                                       0.001216687931695,
+                                       0.001721298732305};
 
     //// Moller
     EXPECT_VEC_SOFT_EQ(expected_m_inc_exit_cost, m_inc_exit_cost);
@@ -229,7 +233,74 @@ TEST_F(MollerBhabhaInteractorTest, basic)
     EXPECT_VEC_SOFT_EQ(expected_b_sec_e, b_sec_e);
 }
 
-TEST_F(MollerBhabhaInteractorTest, stress_test)
+TEST_F(MollerBhabhaInteractorTest, production_cut)
+{
+    RandomEngine& rng_engine  = this->rng();
+    const int     num_samples = 1000;
+    this->resize_secondaries(num_samples);
+    this->set_inc_particle(pdg::electron(), MevEnergy{10});
+
+    // Delta rays below 2 keV should be deposited locally
+    const MevEnergy        electron_cut{0.002};
+    MollerBhabhaInteractor interact(pointers_,
+                                    this->particle_track(),
+                                    this->direction(),
+                                    this->secondary_allocator(),
+                                    electron_cut);
+
+    int num_emitted = 0;
+    for (CELER_MAYBE_UNUSED int i : celeritas::range(num_samples))
+    {
+        Interaction result = interact(rng_engine);
+        SCOPED_TRACE(result);
+        ASSERT_TRUE(result);
+        EXPECT_EQ(Action::scattered, result.action);
+        this->check_energy_conservation(result);
+        if (result.secondaries.empty())
+        {
+            EXPECT_GT(electron_cut, result.energy_deposition);
+        }
+        else
+        {
+            EXPECT_LE(electron_cut, result.secondaries.front().energy);
+            EXPECT_EQ(0, result.energy_deposition.value());
+            ++num_emitted;
+        }
+    }
+    EXPECT_EQ(num_emitted, this->secondary_allocator().get().size());
+    EXPECT_LT(0, num_emitted);
+    EXPECT_GT(num_samples, num_emitted);
+}
+
+TEST_F(MollerBhabhaInteractorTest, reference_moments)
+{
+    const int num_samples = 10000;
+    this->resize_secondaries(num_samples);
+    this->set_inc_particle(pdg::electron(), MevEnergy{10});
+    MollerBhabhaInteractor interact(pointers_,
+                                    this->particle_track(),
+                                    this->direction(),
+                                    this->secondary_allocator(),
+                                    zero_quantity());
+
+    std::vector<real_type> eps;
+    std::vector<real_type> costheta;
+    for (CELER_MAYBE_UNUSED int i : celeritas::range(num_samples))
+    {
+        Interaction result = interact(this->rng());
+        ASSERT_TRUE(result);
+        ASSERT_EQ(1, result.secondaries.size());
+        const auto& secondary = result.secondaries.front();
+        eps.push_back(secondary.energy.value() / 10);
+        costheta.push_back(secondary.direction[2]);
+    }
+
+    // Moments of the delta ray distribution from a 10 MeV electron
+    this->check_mean(eps, 0.00089326832, 0.008005833);
+    this->check_mean(costheta, 0.063497661, 0.057782867);
+}
+
+TEST_F(MollerBhabhaInteractorTest, TEST_IF_CELERITAS_DOUBLE(stress_test))
 {
     RandomEngine& rng = this->rng();
 
@@ -240,10 +311,9 @@ TEST_F(MollerBhabhaInteractorTest, stress_test)
     // Bhabha's max energy fraction is 1.0, which leads to E_K > 1e-3
     // Since this loop encompasses both Moller and Bhabha, the minimum chosen
     // energy is > 2e-3.
-    // NOTE: As E_K -> 2e-3, engine_samples -> infinity
     for (auto particle : {pdg::electron(), pdg::positron()})
     {
-        for (double inc_e : {5e-3, 1.0, 10.0, 100.0, 1000.0})
+        for (real_type inc_e : {5e-3, 1.0, 10.0, 100.0, 1000.0})
         {
             RandomEngine::size_type num_particles_sampled = 0;
 
@@ -262,7 +332,8 @@ TEST_F(MollerBhabhaInteractorTest, stress_test)
                 MollerBhabhaInteractor mb_interact(pointers_,
                                                    this->particle_track(),
                                                    this->direction(),
-                                                   this->secondary_allocator());
+                                                   this->secondary_allocator(),
+                                                   zero_quantity());
 
                 // Loop over half the sample size
                 for (int i = 0; i < num_samples; ++i)
@@ -281,15 +352,79 @@ TEST_F(MollerBhabhaInteractorTest, stress_test)
         }
     }
     // Gold values for average number of calls to rng
-    const double expected_avg_engine_samples[] = {20.8046,
-                                                  13.2538,
-                                                  9.5695,
-                                                  9.2121,
-                                                  9.1693,
-                                                  564.0656,
-                                                  8.7123,
-                                                  7.1706,
-                                                  7.0299,
-                                                  7.0079};
+    const double expected_avg_engine_samples[] = {7.097,
+                                                  8.1948,
+                                                  10.5717,
+                                                  11.0115,
+                                                  10.9643,
+                                                  6.0291,
+                                                  11.9423,
+                                                  19.8972,
+                                                  21.623,
+                                                  21.8879};
     EXPECT_VEC_SOFT_EQ(expected_avg_engine_samples, avg_engine_samples);
 }
+
+TEST_F(MollerBhabhaInteractorTest, TEST_IF_CELERITAS_DOUBLE(tabulated))
+{
+    RandomEngine& rng = this->rng();
+
+    celeritas::MollerBhabhaModel model(
+        celeritas::ModelId{0}, this->particle_params(), true);
+    auto tab_pointers = model.host_pointers();
+    ASSERT_TRUE(tab_pointers.moller_table);
+    ASSERT_TRUE(tab_pointers.bhabha_table);
+
+    const int num_samples = 50000;
+    const int nbins       = 10;
+
+    // Histogram the scaled inverse energy fraction, which is in [0, 1]
+    auto sample_dist = [&](const celeritas::detail::MollerBhabhaPointers& ptr,
+                           double inc_energy,
+                           double max_fraction) {
+        this->resize_secondaries(num_samples);
+        MollerBhabhaInteractor interact(ptr,
+                                        this->particle_track(),
+                                        this->direction(),
+                                        this->secondary_allocator(),
+                                        zero_quantity());
+        const double inv_min = 1 / max_fraction;
+        const double inv_max = inc_energy / pointers_.min_valid_energy;
+        std::vector<double> result(nbins);
+        for (CELER_MAYBE_UNUSED int i : celeritas::range(num_samples))
+        {
+            Interaction out     = interact(rng);
+            double      epsilon = out.secondaries.front().energy.value()
+                             / inc_energy;
+            double scaled = (1 / epsilon - inv_min) / (inv_max - inv_min);
+            int    bin    = std::min<int>(std::max(scaled, 0.0) * nbins,
+                                    nbins - 1);
+            result[bin] += 1.0 / num_samples;
+        }
+        return result;
+    };
+
+    // Compare analytic and tabulated distributions, and check that the
+    // tabulated sampling uses exactly two random numbers per interaction
+    for (auto particle : {pdg::electron(), pdg::positron()})
+    {
+        const double max_fraction = (particle == pdg::electron() ? 0.5 : 1);
+        for (real_type inc_e : {2.5e-3, 5e-3, 0.0432, 1.0, 100.0, 1e4})
+        {
+            SCOPED_TRACE((particle == pdg::electron() ? "Moller at "
+                                                      : "Bhabha at ")
+                         + std::to_string(inc_e));
+            this->set_inc_particle(particle, MevEnergy{inc_e});
+
+            rng.reset_count();
+            auto tab_dist = sample_dist(tab_pointers, inc_e, max_fraction);
+            EXPECT_EQ(4 * num_samples, rng.count());
+            auto ref_dist = sample_dist(pointers_, inc_e, max_fraction);
+            for (auto i : celeritas::range(nbins))
+            {
+                EXPECT_NEAR(ref_dist[i], tab_dist[i], 0.012)
+                    << "in bin " << i;
+            }
+        }
+    }
+}
@@ -29,7 +29,7 @@ void CalculatorTestBase::build(real_type emin, real_type emax, size_type count)
 
     // Interpolate xs grid: linear in bin, log in energy
     Interpolator<Interp::linear, Interp::log, real_type> calc_xs(
-        {0.0, emin}, {count - 1.0, emax});
+        {0, emin}, {real_type(count - 1), emax});
     for (auto i : range(temp_xs.size()))
     {
         temp_xs[i] = calc_xs(i);
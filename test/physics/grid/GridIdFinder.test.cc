@@ -7,7 +7,9 @@
 //---------------------------------------------------------------------------//
 #include "physics/grid/GridIdFinder.hh"
 
+#include <cmath>
 #include "base/OpaqueId.hh"
+#include "base/Range.hh"
 #include "physics/base/Units.hh"
 #include "celeritas_test.hh"
 
@@ -48,6 +50,46 @@ TEST_F(GridIdFinderTest, all)
     EXPECT_EQ(3, find_id(Energy{1}).unchecked_get());
     EXPECT_EQ(3, find_id(Energy{3}).unchecked_get());
     EXPECT_EQ(7, find_id(Energy{10}).unchecked_get());
+    EXPECT_EQ(7, find_id(Energy{10.5}).unchecked_get());
+    EXPECT_EQ(7, find_id(Energy{11}).unchecked_get());
+    EXPECT_EQ(invalid, find_id(Energy{100}).unchecked_get());
+}
+
+TEST_F(GridIdFinderTest, uniform_lookup)
+{
+    constexpr auto invalid = IdT{}.unchecked_get();
+    using celeritas::size_type;
+    using celeritas::UniformGridData;
+
+    grid = {1e-3, 1, 10, 11};
+    ids  = {IdT{5}, IdT{3}, IdT{7}};
+
+    // Lookup bins must be no wider than the narrowest cell (in log space):
+    // the [10, 11] cell has a log width of 0.095, and the bins are 0.093
+    auto log_lookup = UniformGridData::from_bounds(
+        std::log(grid.front()), std::log(grid.back()), 101);
+    ASSERT_LE(log_lookup.delta, std::log(grid[3] / grid[2]));
+    std::vector<size_type> lookup_index;
+    for (auto bin : celeritas::range(log_lookup.size - 1))
+    {
+        double lower = std::exp(log_lookup.front + bin * log_lookup.delta);
+        size_type index = 0;
+        while (index + 2 < grid.size() && grid[index + 1] <= lower)
+        {
+            ++index;
+        }
+        lookup_index.push_back(index);
+    }
+
+    FinderT find_id(
+        make_span(grid), make_span(ids), log_lookup, make_span(lookup_index));
+    EXPECT_EQ(invalid, find_id(Energy{1e-6}).unchecked_get());
+    EXPECT_EQ(5, find_id(Energy{1e-3}).unchecked_get());
+    EXPECT_EQ(5, find_id(Energy{0.1}).unchecked_get());
+    EXPECT_EQ(3, find_id(Energy{1}).unchecked_get());
+    EXPECT_EQ(3, find_id(Energy{3}).unchecked_get());
+    EXPECT_EQ(7, find_id(Energy{10}).unchecked_get());
+    EXPECT_EQ(7, find_id(Energy{10.5}).unchecked_get());
     EXPECT_EQ(7, find_id(Energy{11}).unchecked_get());
     EXPECT_EQ(invalid, find_id(Energy{100}).unchecked_get());
 }
@@ -0,0 +1,104 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file InverseCdfSampler.test.cc
+//---------------------------------------------------------------------------//
+#include "physics/grid/InverseCdfSampler.hh"
+
+#include <cmath>
+#include <random>
+#include <vector>
+#include "celeritas_test.hh"
+#include "base/Range.hh"
+#include "physics/grid/InverseCdfBuilder.hh"
+
+using namespace celeritas;
+using Energy = units::MevEnergy;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class InverseCdfSamplerTest : public celeritas::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // Energy grid at 1, 10, 100 MeV
+        data.log_energy
+            = UniformGridData::from_bounds(std::log(1.0), std::log(100.0), 3);
+        data.num_xi = 5;
+
+        // Uniform below 5 MeV, linearly increasing density above
+        InverseCdfBuilder build(data.log_energy, data.num_xi);
+        values = build([](real_type energy, real_type u) -> real_type {
+            return energy < 5 ? 1 : 2 * u;
+        });
+        data.values = make_span(values);
+    }
+
+    // Mean of many samples
+    real_type sample_mean(real_type energy)
+    {
+        InverseCdfSampler sample(data, Energy{energy});
+        const int         num_samples = 10000;
+        real_type         result      = 0;
+        for (CELER_MAYBE_UNUSED int i : range(num_samples))
+        {
+            real_type u = sample(rng);
+            EXPECT_GE(u, 0);
+            EXPECT_LE(u, 1);
+            result += u;
+        }
+        return result / num_samples;
+    }
+
+    std::vector<real_type> values;
+    InverseCdfGridData     data;
+    std::mt19937           rng;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(InverseCdfSamplerTest, build)
+{
+    ASSERT_TRUE(data);
+    ASSERT_EQ(15, values.size());
+
+    // Uniform distribution: inverse CDF is the identity
+    const double expected_uniform[] = {0, 0.25, 0.5, 0.75, 1};
+    EXPECT_VEC_SOFT_EQ(expected_uniform, make_span(values).subspan(0, 5));
+
+    // Linear density: inverse CDF is sqrt(xi)
+    for (auto j : range(5))
+    {
+        EXPECT_SOFT_NEAR(std::sqrt(0.25 * j), values[5 + j], 1e-3);
+        EXPECT_SOFT_NEAR(std::sqrt(0.25 * j), values[10 + j], 1e-3);
+    }
+}
+
+TEST_F(InverseCdfSamplerTest, in_range)
+{
+    EXPECT_FALSE(InverseCdfSampler::in_range(data, Energy{0.5}));
+    EXPECT_TRUE(InverseCdfSampler::in_range(data, Energy{1}));
+    EXPECT_TRUE(InverseCdfSampler::in_range(data, Energy{50}));
+    EXPECT_FALSE(InverseCdfSampler::in_range(data, Energy{101}));
+    EXPECT_FALSE(InverseCdfSampler::in_range(InverseCdfGridData{}, Energy{1}));
+}
+
+TEST_F(InverseCdfSamplerTest, sample)
+{
+    // Exact means are 1/2 (uniform) and 2/3 (linear); the coarse piecewise
+    // linear inverse CDF of the latter has a mean of 0.643
+    EXPECT_NEAR(0.5, this->sample_mean(0.1), 0.01);
+    EXPECT_NEAR(0.5, this->sample_mean(1), 0.01);
+    EXPECT_NEAR(0.643, this->sample_mean(10), 0.01);
+    EXPECT_NEAR(0.643, this->sample_mean(1000), 0.01);
+
+    // Halfway between the first two rows (in log energy)
+    EXPECT_NEAR(0.572, this->sample_mean(std::sqrt(10.0)), 0.01);
+}
@@ -7,8 +7,10 @@
 //---------------------------------------------------------------------------//
 #include "physics/grid/ValueGridBuilder.hh"
 
+#include <cmath>
 #include <memory>
 #include <vector>
+#include "base/Range.hh"
 #include "physics/grid/XsCalculator.hh"
 #include "physics/grid/ValueGridInserter.hh"
 #include "celeritas_test.hh"
@@ -115,6 +117,137 @@ TEST_F(ValueGridBuilderTest, log_grid)
     }
 }
 
+TEST_F(ValueGridBuilderTest, log_grid_from_function)
+{
+    using Builder_t = ValueGridLogBuilder;
+
+    // Heitler positron annihilation formula (unnormalized)
+    auto calc_heitler = [](real_type energy) {
+        const real_type gamma = energy / 0.5109989461;
+        const real_type g1    = gamma + 1;
+        const real_type g2    = gamma * (gamma + 2);
+        return ((g1 * (g1 + 4) + 1) * std::log(g1 + std::sqrt(g2))
+                - (g1 + 3) * std::sqrt(g2))
+               / (g2 * (g1 + 1));
+    };
+    // Step function with an "absorption edge"
+    auto calc_edge = [](real_type energy) -> real_type {
+        return (energy < 0.0123 ? 1 : 10) / energy;
+    };
+
+    VecBuilder entries;
+    real_type  heitler_error = -1;
+    real_type  edge_error    = -1;
+    {
+        auto b = Builder_t::from_function(
+            1e-6, 1e8, calc_heitler, 1e-3, 4096, &heitler_error);
+        EXPECT_EQ(897, b->value().size());
+        entries.push_back(std::move(b));
+    }
+    {
+        auto b = Builder_t::from_function(
+            1e-3, 1e-1, calc_edge, 1e-3, 100, &edge_error);
+        EXPECT_EQ(65, b->value().size());
+        entries.push_back(std::move(b));
+    }
+    EXPECT_LE(heitler_error, 1e-3);
+    EXPECT_GT(heitler_error, 1e-4);
+    EXPECT_GT(edge_error, 1e-3);
+
+    // Build
+    this->build(entries);
+
+    // Test interpolated results against the exact function
+    ASSERT_EQ(2, grid_storage.size());
+    {
+        XsCalculator calc_xs(grid_storage[XsIndex{0}], real_ref);
+        EXPECT_SOFT_EQ(calc_heitler(1e-6), calc_xs(Energy{1e-6}));
+        EXPECT_SOFT_EQ(calc_heitler(1e8), calc_xs(Energy{1e8}));
+        EXPECT_SOFT_EQ(calc_heitler(1e-6), calc_xs(Energy{1e-7}));
+        for (real_type e : {2.5e-6, 1.234e-3, 0.5, 1.0, 78.9, 1.01e6})
+        {
+            EXPECT_SOFT_NEAR(calc_heitler(e), calc_xs(Energy{e}), 1e-3)
+                << "at " << e << " MeV";
+        }
+    }
+    {
+        XsCalculator calc_xs(grid_storage[XsIndex{1}], real_ref);
+        EXPECT_SOFT_EQ(calc_edge(1e-3), calc_xs(Energy{1e-3}));
+        EXPECT_SOFT_NEAR(calc_edge(1e-2), calc_xs(Energy{1e-2}), 1e-3);
+    }
+}
+
+TEST_F(ValueGridBuilderTest, thin)
+{
+    // Tabulate on a fine grid with 32 bins per decade
+    using CalcValue  = real_type (*)(real_type);
+    auto make_values = [](real_type emin, size_type size, CalcValue f) {
+        VecReal result(size);
+        for (auto i : range(size))
+        {
+            result[i] = f(emin * std::pow(real_type(10), i / real_type(32)));
+        }
+        return result;
+    };
+    CalcValue linear   = [](real_type e) { return 2 * e + 1; };
+    CalcValue inv_sqrt = [](real_type e) { return 1 / std::sqrt(e); };
+
+    VecBuilder entries;
+    {
+        // Linear function is exactly reproduced by two points
+        ValueGridLogBuilder b(1e-2, 1e2, make_values(1e-2, 129, linear));
+        auto thinned = b.thin(1e-6);
+        ASSERT_TRUE(thinned.builder);
+        EXPECT_EQ(129, thinned.input_size);
+        EXPECT_EQ(2, thinned.output_size);
+        EXPECT_SOFT_NEAR(0, thinned.max_error, 1e-6);
+        entries.push_back(std::move(thinned.builder));
+    }
+    {
+        // Prime energy is at point 64 of 97
+        VecReal xs = make_values(1e-2, 97, inv_sqrt);
+        for (auto i : range(64, 97))
+        {
+            xs[i] *= 1e-2 * std::pow(real_type(10), i / real_type(32));
+        }
+        ValueGridXsBuilder b(1e-2, 1e0, 1e1, xs);
+        auto               thinned = b.thin(1e-2);
+        ASSERT_TRUE(thinned.builder);
+        EXPECT_EQ(97, thinned.input_size);
+        EXPECT_EQ(25, thinned.output_size);
+        EXPECT_LE(thinned.max_error, 1e-2);
+        EXPECT_GT(thinned.max_error, 1e-3);
+        entries.push_back(std::move(thinned.builder));
+
+        // Tolerance is too tight to remove any points
+        EXPECT_FALSE(b.thin(1e-8).builder);
+    }
+
+    // Build
+    this->build(entries);
+
+    // Test interpolated results against the exact function
+    ASSERT_EQ(2, grid_storage.size());
+    {
+        XsCalculator calc_xs(grid_storage[XsIndex{0}], real_ref);
+        for (real_type e : {1e-2, 2.5e-2, 0.5, 1.0, 78.9, 1e2})
+        {
+            EXPECT_SOFT_EQ(linear(e), calc_xs(Energy{e}));
+        }
+    }
+    {
+        XsCalculator calc_xs(grid_storage[XsIndex{1}], real_ref);
+        EXPECT_SOFT_EQ(inv_sqrt(1e-2), calc_xs(Energy{1e-2}));
+        EXPECT_SOFT_EQ(inv_sqrt(1e0), calc_xs(Energy{1e0}));
+        EXPECT_SOFT_EQ(inv_sqrt(1e1), calc_xs(Energy{1e1}));
+        for (real_type e : {1.234e-2, 0.1, 0.5, 2.0, 7.0})
+        {
+            EXPECT_SOFT_NEAR(inv_sqrt(e), calc_xs(Energy{e}), 1e-2)
+                << "at " << e << " MeV";
+        }
+    }
+}
+
 TEST_F(ValueGridBuilderTest, DISABLED_generic_grid)
 {
     using Builder_t = ValueGridGenericBuilder;
@@ -58,3 +58,41 @@ TEST_F(ValueGridInserterTest, all)
     }
     EXPECT_EQ(2, grid_storage.size());
 }
+
+TEST_F(ValueGridInserterTest, dedup)
+{
+    const auto      loge_grid = UniformGridData::from_bounds(0.0, 1.0, 3);
+    const real_type values[]  = {10, 20, 3};
+
+    ValueGridInserter insert(&real_storage, &grid_storage);
+    auto              first = insert(loge_grid, 1, make_span(values));
+    EXPECT_EQ(0, insert.bytes_saved());
+
+    // Identical grid should reuse the ID and storage
+    auto second = insert(loge_grid, 1, make_span(values));
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(1, grid_storage.size());
+    EXPECT_EQ(3, real_storage.size());
+    EXPECT_EQ(3 * sizeof(real_type) + sizeof(XsGridData),
+              insert.bytes_saved());
+
+    // Same values with different scaling should share only the values
+    auto third = insert(loge_grid, make_span(values));
+    EXPECT_NE(first, third);
+    EXPECT_EQ(2, grid_storage.size());
+    EXPECT_EQ(3, real_storage.size());
+    EXPECT_EQ(grid_storage[first].value.begin(),
+              grid_storage[third].value.begin());
+
+    // Different values should be stored separately
+    const real_type other_values[] = {10, 20, 4};
+    auto fourth = insert(loge_grid, 1, make_span(other_values));
+    EXPECT_EQ(3, grid_storage.size());
+    EXPECT_EQ(6, real_storage.size());
+    EXPECT_VEC_SOFT_EQ(other_values, real_storage[grid_storage[fourth].value]);
+
+    // A new inserter should find grids already in the collections
+    ValueGridInserter insert_again(&real_storage, &grid_storage);
+    EXPECT_EQ(first, insert_again(loge_grid, 1, make_span(values)));
+    EXPECT_EQ(3, grid_storage.size());
+}
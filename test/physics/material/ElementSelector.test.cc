@@ -138,7 +138,7 @@ TEST_F(ElementSelectorTest, single)
 }
 
 //! Equal number densities but unequal cross sections
-TEST_F(ElementSelectorTest, everything_even)
+TEST_F(ElementSelectorTest, TEST_IF_CELERITAS_DOUBLE(everything_even))
 {
     MaterialView    material(host_mats, mats->find("everything_even"));
     ElementSelector select_el(material, mock_micro_xs, make_span(storage));
@@ -164,7 +164,7 @@ TEST_F(ElementSelectorTest, everything_even)
 }
 
 //! Number densities scaled to 1/xs so equiprobable
-TEST_F(ElementSelectorTest, everything_weighted)
+TEST_F(ElementSelectorTest, TEST_IF_CELERITAS_DOUBLE(everything_weighted))
 {
     MaterialView    material(host_mats, mats->find("everything_weighted"));
     ElementSelector select_el(material, mock_micro_xs, make_span(storage));
@@ -0,0 +1,193 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TabulatedElementSelector.test.cc
+//---------------------------------------------------------------------------//
+#include "physics/material/TabulatedElementSelector.hh"
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include "celeritas_test.hh"
+#include "base/Range.hh"
+#include "physics/material/ElementCdfBuilder.hh"
+#include "physics/material/ElementSelector.hh"
+#include "physics/material/MaterialParams.hh"
+
+using namespace celeritas;
+using Energy = units::MevEnergy;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class TabulatedElementSelectorTest : public celeritas::Test
+{
+  public:
+    //!@{
+    //! Type aliases
+    using RandomEngine = std::mt19937;
+    using HostValue    = ElementCdfData<Ownership::value, MemSpace::host>;
+    using HostRef
+        = ElementCdfData<Ownership::const_reference, MemSpace::host>;
+    //!@}
+
+  protected:
+    void SetUp() override
+    {
+        using celeritas::units::AmuMass;
+
+        MaterialParams::Input inp;
+        inp.elements = {
+            {1, AmuMass{1.008}, "H"},
+            {11, AmuMass{22.98976928}, "Na"},
+            {13, AmuMass{26.9815385}, "Al"},
+            {53, AmuMass{126.90447}, "I"},
+        };
+        inp.materials = {
+            {0.0, 0.0, MatterState::unspecified, {}, "hard_vacuum"},
+            {0.1 * constants::na_avogadro,
+             293.0,
+             MatterState::gas,
+             {{ElementId{2}, 1.0}},
+             "Al"},
+            {1 * constants::na_avogadro,
+             293.0,
+             MatterState::solid,
+             {{ElementId{0}, 0.48},
+              {ElementId{1}, 0.24},
+              {ElementId{2}, 0.16},
+              {ElementId{3}, 0.12}},
+             "everything_weighted"},
+        };
+        mats = std::make_shared<MaterialParams>(std::move(inp));
+
+        ElementCdfBuilder build_cdf(*mats, calc_micro_xs);
+        build_cdf(
+            UniformGridData::from_bounds(std::log(1e-3), std::log(1e3), 61),
+            &host_data);
+        host_ref = host_data;
+    }
+
+    // Cross section that changes the relative weights as a function of energy
+    static real_type calc_micro_xs(ElementId el_id, Energy energy)
+    {
+        CELER_EXPECT(el_id < 4);
+        real_type result = static_cast<real_type>(el_id.get() + 1);
+        if (el_id.get() % 2 == 1)
+        {
+            result /= std::sqrt(energy.value());
+        }
+        return result;
+    }
+
+    std::shared_ptr<MaterialParams> mats;
+    HostValue                       host_data;
+    HostRef                         host_ref;
+    RandomEngine                    rng;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(TabulatedElementSelectorTest, construction)
+{
+    ASSERT_EQ(mats->size(), host_ref.materials.size());
+
+    const ElementCdfGrid& vacuum = host_ref.materials[MaterialId{0}];
+    EXPECT_EQ(0, vacuum.num_elements);
+    EXPECT_TRUE(vacuum.cdf.empty());
+
+    const ElementCdfGrid& al = host_ref.materials[MaterialId{1}];
+    EXPECT_TRUE(al);
+    EXPECT_EQ(1, al.num_elements);
+    EXPECT_TRUE(al.cdf.empty());
+
+    const ElementCdfGrid& mixed = host_ref.materials[MaterialId{2}];
+    EXPECT_TRUE(mixed);
+    EXPECT_EQ(4, mixed.num_elements);
+    EXPECT_EQ(61 * 3, mixed.cdf.size());
+
+    // At 1 MeV (grid point 30) the weights are 0.48, 0.48, 0.48, 0.48
+    auto cdf = host_ref.reals[mixed.cdf];
+    const double expected_cdf[] = {0.25, 0.5, 0.75};
+    EXPECT_VEC_SOFT_EQ(expected_cdf, cdf.subspan(30 * 3, 3));
+}
+
+TEST_F(TabulatedElementSelectorTest, single)
+{
+    TabulatedElementSelector select_el(host_ref, MaterialId{1}, Energy{1.0});
+    for (CELER_MAYBE_UNUSED auto i : range(100))
+    {
+        EXPECT_EQ(ElementComponentId{0}, select_el(rng));
+    }
+}
+
+TEST_F(TabulatedElementSelectorTest, equivalence)
+{
+    // Compare sampled distributions against the exact probabilities and the
+    // on-the-fly selector (tolerance is about three standard deviations)
+    const MaterialId       mat_id{2};
+    const MaterialView     material(mats->host_pointers(), mat_id);
+    std::vector<real_type> storage(mats->max_element_components());
+
+    const int num_samples = 20000;
+    for (real_type energy : {1e-4, 1e-3, 0.0123, 1.0, 45.6, 1e3, 1e4})
+    {
+        ElementSelector select_otf(
+            material,
+            [energy](ElementId el) {
+                return calc_micro_xs(el, Energy{energy});
+            },
+            make_span(storage));
+        TabulatedElementSelector select_tab(host_ref, mat_id, Energy{energy});
+
+        // Expected probability of each element
+        real_type clamped = std::fmin(std::fmax(energy, real_type(1e-3)),
+                                      real_type(1e3));
+        std::vector<real_type> expected(material.num_elements());
+        real_type              total = 0;
+        for (auto i : range(expected.size()))
+        {
+            const auto& comp = material.elements()[i];
+            expected[i]
+                = comp.fraction * calc_micro_xs(comp.element, Energy{clamped});
+            total += expected[i];
+        }
+
+        std::vector<int> tally(material.num_elements(), 0);
+        for (CELER_MAYBE_UNUSED auto i : range(num_samples))
+        {
+            auto el_id = select_tab(rng);
+            ASSERT_LT(el_id.get(), tally.size());
+            ++tally[el_id.get()];
+        }
+        for (auto i : range(expected.size()))
+        {
+            EXPECT_NEAR(expected[i] / total,
+                        real_type(tally[i]) / num_samples,
+                        0.01)
+                << "for element " << i << " at " << energy << " MeV";
+        }
+
+        if (energy >= 1e-3 && energy <= 1e3)
+        {
+            // Within the table bounds, the on-the-fly calculation should give
+            // the same distribution
+            std::fill(tally.begin(), tally.end(), 0);
+            for (CELER_MAYBE_UNUSED auto i : range(num_samples))
+            {
+                ++tally[select_otf(rng).get()];
+            }
+            for (auto i : range(expected.size()))
+            {
+                EXPECT_NEAR(expected[i] / total,
+                            real_type(tally[i]) / num_samples,
+                            0.01);
+            }
+        }
+    }
+}
@@ -0,0 +1,108 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AliasSampler.test.cc
+//---------------------------------------------------------------------------//
+#include "random/distributions/AliasSampler.hh"
+
+#include <random>
+#include <vector>
+#include "celeritas_test.hh"
+#include "base/Range.hh"
+#include "random/distributions/AliasTableBuilder.hh"
+
+using namespace celeritas;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class AliasSamplerTest : public celeritas::Test
+{
+  protected:
+    using AliasItems = AliasTableBuilder::AliasItems;
+
+    // Reconstruct the normalized probability of each index from a table
+    static std::vector<double> reconstruct(Span<const AliasEntry> table)
+    {
+        std::vector<double> result(table.size(), 0.0);
+        for (auto i : range(table.size()))
+        {
+            const AliasEntry& entry = table[i];
+            CELER_ASSERT(entry.alias < table.size());
+            result[i] += entry.probability / table.size();
+            result[entry.alias] += (1 - entry.probability) / table.size();
+        }
+        return result;
+    }
+
+    AliasItems   entries;
+    std::mt19937 rng;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(AliasSamplerTest, TEST_IF_CELERITAS_DOUBLE(build))
+{
+    AliasTableBuilder build_table(&entries);
+    const real_type   weights[] = {1, 0, 4, 2, 0.5, 0.5};
+    auto              items     = build_table(make_span(weights));
+    EXPECT_EQ(6, items.size());
+
+    auto table = entries[items];
+    for (const AliasEntry& entry : table)
+    {
+        EXPECT_GE(entry.probability, 0);
+        EXPECT_LE(entry.probability, 1);
+    }
+
+    // The table should exactly reproduce the normalized weights
+    const double expected[] = {0.125, 0, 0.5, 0.25, 0.0625, 0.0625};
+    EXPECT_VEC_SOFT_EQ(expected, reconstruct(table));
+
+    // Append a second table
+    const real_type uniform[] = {3, 3, 3};
+    auto            second    = build_table(make_span(uniform));
+    EXPECT_EQ(6, second.begin()->get());
+    EXPECT_EQ(9, entries.size());
+    for (const AliasEntry& entry : entries[second])
+    {
+        EXPECT_SOFT_EQ(1, entry.probability);
+    }
+}
+
+TEST_F(AliasSamplerTest, single)
+{
+    AliasTableBuilder build_table(&entries);
+    const real_type   weights[] = {0.3};
+    AliasSampler      sample(entries[build_table(make_span(weights))]);
+    for (CELER_MAYBE_UNUSED auto i : range(100))
+    {
+        EXPECT_EQ(0, sample(rng));
+    }
+}
+
+TEST_F(AliasSamplerTest, sample)
+{
+    AliasTableBuilder build_table(&entries);
+    const real_type   weights[] = {0.1, 0.4, 0, 0.02, 0.3, 0.18};
+    AliasSampler      sample(entries[build_table(make_span(weights))]);
+
+    const int        num_samples = 100000;
+    std::vector<int> tally(6, 0);
+    for (CELER_MAYBE_UNUSED auto i : range(num_samples))
+    {
+        auto idx = sample(rng);
+        ASSERT_LT(idx, tally.size());
+        ++tally[idx];
+    }
+    EXPECT_EQ(0, tally[2]);
+    for (auto i : range(tally.size()))
+    {
+        EXPECT_NEAR(weights[i], double(tally[i]) / num_samples, 0.005);
+    }
+}
@@ -17,7 +17,7 @@ using celeritas::BernoulliDistribution;
 // TESTS
 //---------------------------------------------------------------------------//
 
-TEST(BernoulliDistributionTest, single_constructor)
+TEST(BernoulliDistributionTest, TEST_IF_CELERITAS_DOUBLE(single_constructor))
 {
     std::mt19937          rng;
     BernoulliDistribution quarter_true(0.25);
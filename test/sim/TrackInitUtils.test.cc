@@ -0,0 +1,87 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TrackInitUtils.test.cc
+//---------------------------------------------------------------------------//
+#include "sim/detail/TrackInitUtils.hh"
+
+#include <vector>
+#include "base/Range.hh"
+#include "celeritas_test.hh"
+
+using namespace celeritas;
+using celeritas::detail::find_vertex_thread;
+using celeritas::detail::flag_id;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class TrackInitUtilsTest : public celeritas::Test
+{
+  protected:
+    using VecSize = std::vector<size_type>;
+
+    //! Find the vertex thread for every thread in a batch
+    VecSize find_vertex_threads(const VecSize& vertex,
+                                size_type      num_parents,
+                                size_type      num_vacancies) const
+    {
+        VecSize result;
+        for (auto thread_id : range(num_vacancies))
+        {
+            result.push_back(find_vertex_thread(
+                make_span(vertex), num_parents, thread_id, num_vacancies));
+        }
+        return result;
+    }
+
+    const size_type flag = flag_id();
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(TrackInitUtilsTest, primaries)
+{
+    // Three primaries at one vertex, two at a second, and one at a third
+    const VecSize vertex = {0, 0, 0, 3, 3, 5};
+
+    // Thread i initializes from initializer 5 - i: the primary at each vertex
+    // with the lowest initializer index is located and the others copy it
+    const VecSize expected = {flag, 2, flag, 5, 5, flag};
+    EXPECT_VEC_EQ(expected, this->find_vertex_threads(vertex, 0, 6));
+}
+
+TEST_F(TrackInitUtilsTest, partial_batch)
+{
+    const VecSize vertex = {0, 0, 0, 3, 3, 5};
+
+    // Only initializers 2-5 fit: initializer 2 is the first of its vertex in
+    // this batch, so it must be located even though 0 and 1 share its vertex
+    const VecSize expected = {flag, 2, flag, flag};
+    EXPECT_VEC_EQ(expected, this->find_vertex_threads(vertex, 0, 4));
+
+    // The remaining initializers are initialized in the next batch
+    const VecSize next_vertex   = {0, 0};
+    const VecSize next_expected = {1, flag};
+    EXPECT_VEC_EQ(next_expected, this->find_vertex_threads(next_vertex, 0, 2));
+}
+
+TEST_F(TrackInitUtilsTest, secondaries)
+{
+    // Two primaries at one vertex followed by three secondaries; the last
+    // two secondaries have parents in the track vector
+    const VecSize vertex = {0, 0, flag, flag, flag};
+
+    // Secondaries never copy a vertex state
+    const VecSize expected = {flag, flag, flag, 4, flag};
+    EXPECT_VEC_EQ(expected, this->find_vertex_threads(vertex, 2, 5));
+
+    // Secondaries whose parents are gone also never copy a vertex state
+    const VecSize expected_partial = {flag, flag, flag};
+    EXPECT_VEC_EQ(expected_partial, this->find_vertex_threads(vertex, 0, 3));
+}
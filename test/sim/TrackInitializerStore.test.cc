@@ -10,6 +10,7 @@
 #include <algorithm>
 #include <numeric>
 #include "celeritas_test.hh"
+#include "base/Range.hh"
 #include "geometry/GeoParams.hh"
 #include "physics/base/SecondaryAllocatorStore.hh"
 #include "physics/base/ParticleParams.hh"
@@ -17,6 +18,7 @@
 #include "sim/TrackInterface.hh"
 #include "sim/StateStore.hh"
 #include "sim/TrackInitializerStore.hh"
+#include "sim/detail/TrackInitUtils.hh"
 #include "TrackInitializerStore.test.hh"
 
 namespace celeritas_test
@@ -139,6 +141,19 @@ TEST_F(TrackInitTest, run)
     expected.track_id = {2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
     EXPECT_VEC_EQ(expected.track_id, output.track_id);
 
+    // All primaries start at the origin: the threads that found another
+    // thread's vertex copied its state instead of locating the track
+    const std::vector<size_type> vertex(primaries.size(), 0);
+    size_type                    num_vertex_copies = 0;
+    for (auto thread_id : range(num_tracks))
+    {
+        num_vertex_copies += detail::find_vertex_thread(
+                                 make_span(vertex), 0, thread_id, num_tracks)
+                             != detail::flag_id();
+    }
+    EXPECT_EQ(num_vertex_copies, track_init.num_vertex_copies());
+    EXPECT_EQ(0, track_init.num_parent_copies());
+
     // Allocate input device data (number of secondaries to produce for each
     // track and whether the track survives the interaction)
     std::vector<size_type> alloc = {1, 1, 0, 0, 1, 1, 0, 0, 1, 1};
@@ -177,6 +192,18 @@ TEST_F(TrackInitTest, run)
     std::sort(std::begin(output.track_id), std::end(output.track_id));
     expected.track_id = {3, 5, 7, 9, 11, 12, 13, 14, 16, 17};
     EXPECT_VEC_EQ(expected.track_id, output.track_id);
+
+    // Secondaries of surviving tracks are initialized first and copy their
+    // parents' states; secondaries that replaced their dead parents in place
+    // kept the parents' states and aren't counted
+    size_type num_living_parents = 0;
+    for (auto i : range(num_tracks))
+    {
+        num_living_parents += (alloc[i] > 0 && alive[i]);
+    }
+    EXPECT_EQ(num_vertex_copies, track_init.num_vertex_copies());
+    EXPECT_EQ(std::min<size_type>(num_living_parents, expected.vacancy.size()),
+              track_init.num_parent_copies());
 }
 
 TEST_F(TrackInitTest, primaries)
@@ -0,0 +1,212 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file VarianceReducer.test.cc
+//---------------------------------------------------------------------------//
+#include "sim/VarianceReducer.hh"
+
+#include <memory>
+#include <vector>
+#include "celeritas_test.hh"
+#include "base/Range.hh"
+#include "sim/VarianceReductionParams.hh"
+#include "physics/InteractorHostTestBase.hh"
+
+using namespace celeritas;
+using celeritas_test::InteractorHostTestBase;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class VarianceReducerTest : public InteractorHostTestBase
+{
+    using Base = InteractorHostTestBase;
+
+  protected:
+    void SetUp() override
+    {
+        using namespace celeritas::units;
+        constexpr auto zero   = zero_quantity();
+        constexpr auto stable = ParticleDef::stable_decay_constant();
+
+        Base::set_particle_params(
+            {{"electron",
+              pdg::electron(),
+              MevMass{0.5109989461},
+              ElementaryCharge{-1},
+              stable},
+             {"gamma", pdg::gamma(), zero, zero, stable}});
+
+        VarianceReductionParams::Input inp;
+        inp.roulette[pdg::gamma()]  = {MevEnergy{1}, 0.25};
+        inp.roulette[pdg::proton()] = {MevEnergy{1}, 0.5};
+        inp.importance              = {1, 2.5, 0.5, 4};
+        inp.max_split               = 8;
+        params_ = std::make_shared<VarianceReductionParams>(
+            this->particle_params(), inp);
+
+        this->set_inc_particle(pdg::gamma(), MevEnergy{0.1});
+        this->reset_sim();
+    }
+
+    //! Revive the test track with unit weight
+    void reset_sim() { sim_states_ = {{TrackId{0}, {}, EventId{0}, true}}; }
+
+    SimTrackView sim_track()
+    {
+        SimStatePointers ptrs;
+        ptrs.vars = make_span(sim_states_);
+        return SimTrackView(ptrs, ThreadId{0});
+    }
+
+    std::shared_ptr<VarianceReductionParams> params_;
+    std::vector<SimTrackState>               sim_states_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(VarianceReducerTest, params)
+{
+    const auto& host = params_->host_pointers();
+    ASSERT_EQ(2, host.roulette.size());
+    EXPECT_FALSE(host.roulette[ParticleId{0}]);
+    const RouletteParams& gamma = host.roulette[ParticleId{1}];
+    EXPECT_TRUE(gamma);
+    EXPECT_SOFT_EQ(1.0, gamma.energy_threshold);
+    EXPECT_SOFT_EQ(0.25, gamma.survival_probability);
+    EXPECT_EQ(4, host.importance.size());
+    EXPECT_EQ(8, host.max_split);
+}
+
+TEST_F(VarianceReducerTest, roulette)
+{
+    const int num_samples = 4000;
+    int       num_alive   = 0;
+    real_type total_weight = 0;
+    for (CELER_MAYBE_UNUSED int i : range(num_samples))
+    {
+        this->reset_sim();
+        SimTrackView    sim = this->sim_track();
+        VarianceReducer reduce(
+            params_->host_pointers(), this->particle_track(), sim);
+        bool survived = reduce.roulette(this->rng());
+        EXPECT_EQ(survived, sim.alive());
+        if (survived)
+        {
+            EXPECT_SOFT_EQ(4.0, sim.weight());
+            ++num_alive;
+            total_weight += sim.weight();
+        }
+    }
+    // Mean weight is conserved (5 sigma tolerance)
+    EXPECT_NEAR(0.25, real_type(num_alive) / num_samples, 0.035);
+    EXPECT_NEAR(1.0, total_weight / num_samples, 0.14);
+
+    // Above the threshold there is no roulette
+    this->set_inc_particle(pdg::gamma(), MevEnergy{10});
+    this->reset_sim();
+    SimTrackView    sim = this->sim_track();
+    VarianceReducer reduce(
+        params_->host_pointers(), this->particle_track(), sim);
+    EXPECT_TRUE(reduce.roulette(this->rng()));
+    EXPECT_EQ(1.0, sim.weight());
+
+    // Electrons are never rouletted
+    this->set_inc_particle(pdg::electron(), MevEnergy{0.1});
+    VarianceReducer reduce_el(
+        params_->host_pointers(), this->particle_track(), sim);
+    EXPECT_TRUE(reduce_el.roulette(this->rng()));
+    EXPECT_EQ(1.0, sim.weight());
+}
+
+TEST_F(VarianceReducerTest, TEST_IF_CELERITAS_DOUBLE(split))
+{
+    const Real3 dir{0, 0, 1};
+
+    std::vector<size_type> num_tracks;
+    for (CELER_MAYBE_UNUSED int i : range(8))
+    {
+        this->reset_sim();
+        SimTrackView    sim = this->sim_track();
+        VarianceReducer reduce(
+            params_->host_pointers(), this->particle_track(), sim);
+        Interaction result = reduce.cross_boundary(
+            VolumeId{0}, VolumeId{1}, dir, this->secondary_allocator(), rng());
+        ASSERT_TRUE(result);
+        EXPECT_EQ(Action::split, result.action);
+        EXPECT_SOFT_EQ(0.1, result.energy.value());
+        EXPECT_TRUE(sim.alive());
+
+        const size_type n = result.secondaries.size() + 1;
+        num_tracks.push_back(n);
+        EXPECT_SOFT_EQ(1.0, n * sim.weight());
+        for (const Secondary& copy : result.secondaries)
+        {
+            EXPECT_EQ(this->particle_track().particle_id(), copy.particle_id);
+            EXPECT_SOFT_EQ(0.1, copy.energy.value());
+            EXPECT_VEC_SOFT_EQ(dir, copy.direction);
+        }
+    }
+    const size_type expected_num_tracks[] = {3, 2, 2, 3, 3, 2, 3, 2};
+    EXPECT_VEC_EQ(expected_num_tracks, num_tracks);
+
+    // No change within the same importance
+    this->reset_sim();
+    SimTrackView    sim = this->sim_track();
+    VarianceReducer reduce(
+        params_->host_pointers(), this->particle_track(), sim);
+    Interaction result = reduce.cross_boundary(
+        VolumeId{0}, VolumeId{0}, dir, this->secondary_allocator(), rng());
+    EXPECT_EQ(Action::entered_volume, result.action);
+    EXPECT_TRUE(result.secondaries.empty());
+    EXPECT_EQ(1.0, sim.weight());
+
+    // Volumes without importance are ignored
+    result = reduce.cross_boundary(
+        VolumeId{0}, VolumeId{10}, dir, this->secondary_allocator(), rng());
+    EXPECT_EQ(Action::entered_volume, result.action);
+
+    // Not enough space for three copies
+    this->resize_secondaries(2);
+    result = reduce.cross_boundary(
+        VolumeId{0}, VolumeId{3}, dir, this->secondary_allocator(), rng());
+    EXPECT_FALSE(result);
+    EXPECT_EQ(1.0, sim.weight());
+}
+
+TEST_F(VarianceReducerTest, boundary_roulette)
+{
+    const Real3 dir{0, 0, 1};
+
+    const int num_samples = 4000;
+    int       num_alive   = 0;
+    for (CELER_MAYBE_UNUSED int i : range(num_samples))
+    {
+        this->reset_sim();
+        SimTrackView    sim = this->sim_track();
+        VarianceReducer reduce(
+            params_->host_pointers(), this->particle_track(), sim);
+        Interaction result = reduce.cross_boundary(
+            VolumeId{1}, VolumeId{2}, dir, this->secondary_allocator(), rng());
+        ASSERT_TRUE(result);
+        EXPECT_TRUE(result.secondaries.empty());
+        if (sim.alive())
+        {
+            EXPECT_EQ(Action::entered_volume, result.action);
+            EXPECT_SOFT_EQ(5.0, sim.weight());
+            ++num_alive;
+        }
+        else
+        {
+            EXPECT_EQ(Action::rouletted, result.action);
+            EXPECT_TRUE(action_killed(result.action));
+        }
+    }
+    // Importance ratio is 0.2 (5 sigma tolerance)
+    EXPECT_NEAR(0.2, real_type(num_alive) / num_samples, 0.032);
+}